@@ -16,8 +16,8 @@
   0 - off
   1 - build Abc serial but no inherit code
   2 - build Abc serial and inherit code
-  3 - build Abc cilk parallel but no inherit code
-  4 - build Abc cilk parallel and inherit code
+  3 - build Abc threaded parallel but no inherit code
+  4 - build Abc threaded parallel and inherit code
  */
 #ifdef CLP_HAS_ABC
 #if CLP_HAS_ABC == 1
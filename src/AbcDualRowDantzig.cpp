@@ -131,15 +131,14 @@ static void choose(CoinIndexedVector *infeasible,
   int &chosenRowSave, double &largestSave, int first, int last,
   double tolerance)
 {
-  if (last - first > 256) {
+  if (last - first > ABC_PARALLEL_GRAIN) {
     int mid = (last + first) >> 1;
     int chosenRow2 = chosenRowSave;
     double largest2 = largestSave;
-    cilk_spawn choose(infeasible, chosenRow2, largest2, first, mid,
-      tolerance);
-    choose(infeasible, chosenRowSave, largestSave, mid, last,
-      tolerance);
-    cilk_sync;
+    clpParallelInvoke([&]() { choose(infeasible, chosenRow2, largest2, first, mid,
+                                tolerance); },
+      [&]() { choose(infeasible, chosenRowSave, largestSave, mid, last,
+                tolerance); });
     if (largest2 > largestSave) {
       largestSave = largest2;
       chosenRowSave = chosenRow2;
@@ -281,13 +280,12 @@ static void update(int first, int last,
   const double *COIN_RESTRICT lowerBasic, double *COIN_RESTRICT solutionBasic,
   const double *COIN_RESTRICT upperBasic, double theta, double tolerance)
 {
-  if (last - first > 256) {
+  if (last - first > ABC_PARALLEL_GRAIN) {
     int mid = (last + first) >> 1;
-    cilk_spawn update(first, mid, which, work, lowerBasic, solutionBasic,
-      upperBasic, theta, tolerance);
-    update(mid, last, which, work, lowerBasic, solutionBasic,
-      upperBasic, theta, tolerance);
-    cilk_sync;
+    clpParallelInvoke([=]() { update(first, mid, which, work, lowerBasic, solutionBasic,
+                                upperBasic, theta, tolerance); },
+      [=]() { update(mid, last, which, work, lowerBasic, solutionBasic,
+                upperBasic, theta, tolerance); });
   } else {
     for (int i = first; i < last; i++) {
       int iRow = which[i];
@@ -194,15 +194,14 @@ static void choose(AbcDualRowSteepest *steepest,
   int &chosenRowSave, double &largestSave, int first, int last,
   double tolerance)
 {
-  if (last - first > 256) {
+  if (last - first > ABC_PARALLEL_GRAIN) {
     int mid = (last + first) >> 1;
     int chosenRow2 = chosenRowSave;
     double largest2 = largestSave;
-    cilk_spawn choose(steepest, chosenRow2, largest2, first, mid,
-      tolerance);
-    choose(steepest, chosenRowSave, largestSave, mid, last,
-      tolerance);
-    cilk_sync;
+    clpParallelInvoke([&]() { choose(steepest, chosenRow2, largest2, first, mid,
+                                tolerance); },
+      [&]() { choose(steepest, chosenRowSave, largestSave, mid, last,
+                tolerance); });
     if (largest2 > largestSave) {
       largestSave = largest2;
       chosenRowSave = chosenRow2;
@@ -257,15 +256,14 @@ static void choose2(AbcDualRowSteepest *steepest,
   int &chosenRowSave, double &largestSave, int first, int last,
   double tolerance)
 {
-  if (last - first > 256) {
+  if (last - first > ABC_PARALLEL_GRAIN) {
     int mid = (last + first) >> 1;
     int chosenRow2 = chosenRowSave;
     double largest2 = largestSave;
-    cilk_spawn choose2(steepest, chosenRow2, largest2, first, mid,
-      tolerance);
-    choose2(steepest, chosenRowSave, largestSave, mid, last,
-      tolerance);
-    cilk_sync;
+    clpParallelInvoke([&]() { choose2(steepest, chosenRow2, largest2, first, mid,
+                                tolerance); },
+      [&]() { choose2(steepest, chosenRowSave, largestSave, mid, last,
+                tolerance); });
     if (largest2 > largestSave) {
       largestSave = largest2;
       chosenRowSave = chosenRow2;
@@ -912,13 +910,12 @@ static void update(int first, int last,
   double multiplier, double multiplier2,
   double norm, double theta, double tolerance)
 {
-  if (last - first > 256) {
+  if (last - first > ABC_PARALLEL_GRAIN) {
     int mid = (last + first) >> 1;
-    cilk_spawn update(first, mid, which, work, work2, weights, lowerBasic, solutionBasic,
-      upperBasic, multiplier, multiplier2, norm, theta, tolerance);
-    update(mid, last, which, work, work2, weights, lowerBasic, solutionBasic,
-      upperBasic, multiplier, multiplier2, norm, theta, tolerance);
-    cilk_sync;
+    clpParallelInvoke([=]() { update(first, mid, which, work, work2, weights, lowerBasic, solutionBasic,
+                                upperBasic, multiplier, multiplier2, norm, theta, tolerance); },
+      [=]() { update(mid, last, which, work, work2, weights, lowerBasic, solutionBasic,
+                upperBasic, multiplier, multiplier2, norm, theta, tolerance); });
   } else {
     for (int i = first; i < last; i++) {
       int iRow = which[i];
@@ -1199,8 +1196,6 @@ void AbcDualRowSteepest::saveWeights(AbcSimplex *model, int mode)
 	}
 	int nSlack=0;
 #endif
-        //#undef ABC_PARALLEL
-        // for now just with cilk
 #if ABC_PARALLEL == 2
         if (model_->parallelMode() == 0) {
 #endif
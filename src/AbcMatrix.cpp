@@ -2480,11 +2480,22 @@ int AbcMatrix::pivotColumnDantzig(const CoinIndexedVector &updates,
   spare.setPartitions(numberBlocks, starts);
   int which[NUMBER_BLOCKS];
   double best[NUMBER_BLOCKS];
+#if ABC_PARALLEL == 2
+  ClpTaskGroup group;
+  for (int i = 0; i < numberBlocks - 1; i++) {
+    group.spawn([&, i]() {
+      which[i] = pivotColumnDantzig(i, useRowCopy, updates, spare, best[i]);
+    });
+  }
+#else
   for (int i = 0; i < numberBlocks - 1; i++)
-    which[i] = cilk_spawn pivotColumnDantzig(i, useRowCopy, updates, spare, best[i]);
+    which[i] = pivotColumnDantzig(i, useRowCopy, updates, spare, best[i]);
+#endif
   which[numberBlocks - 1] = pivotColumnDantzig(numberBlocks - 1, useRowCopy, updates,
     spare, best[numberBlocks - 1]);
-  cilk_sync;
+#if ABC_PARALLEL == 2
+  group.wait();
+#endif
   int bestSequence = -1;
   double bestValue = model_->dualTolerance();
   for (int i = 0; i < numberBlocks; i++) {
@@ -3190,25 +3201,30 @@ int AbcMatrix::primalColumnDouble(CoinPartitionedVector &updateForTableauRow,
     starts = startColumnBlock_;
     numberBlocks = numberColumnBlocks_;
   }
-  if (useRowCopy) {
-    for (int i = 0; i < numberBlocks; i++)
-#ifdef PRICE_IN_ABC_MATRIX
-      which[i] =
+  // each block only touches its own partitions
+#if ABC_PARALLEL == 2
+  ClpTaskGroup group;
+#endif
+  for (int i = 0; i < numberBlocks; i++) {
+#if ABC_PARALLEL == 2
+    group.spawn([&, i]() {
 #endif
-        cilk_spawn primalColumnSparseDouble(i, updateForTableauRow, updateForDjs, updateForWeights,
-          spareColumn1,
-          infeasibilities, referenceIn, devex, reference, weights, scaleFactor);
-    cilk_sync;
-  } else {
-    for (int i = 0; i < numberBlocks; i++)
 #ifdef PRICE_IN_ABC_MATRIX
       which[i] =
 #endif
-        cilk_spawn primalColumnDouble(i, updateForTableauRow, updateForDjs, updateForWeights,
-          spareColumn1,
-          infeasibilities, referenceIn, devex, reference, weights, scaleFactor);
-    cilk_sync;
+        useRowCopy ? primalColumnSparseDouble(i, updateForTableauRow, updateForDjs, updateForWeights,
+                       spareColumn1,
+                       infeasibilities, referenceIn, devex, reference, weights, scaleFactor)
+                   : primalColumnDouble(i, updateForTableauRow, updateForDjs, updateForWeights,
+                       spareColumn1,
+                       infeasibilities, referenceIn, devex, reference, weights, scaleFactor);
+#if ABC_PARALLEL == 2
+    });
+#endif
   }
+#if ABC_PARALLEL == 2
+  group.wait();
+#endif
 #ifdef PRICE_IN_ABC_MATRIX
   double bestValue = model_->dualTolerance();
   int sequenceIn[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };
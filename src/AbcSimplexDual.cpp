@@ -559,11 +559,20 @@ static void updateDualsInDualBit(CoinPartitionedVector &row,
   double *djs,
   double theta, int numberBlocks)
 {
+#if ABC_PARALLEL == 2
+  // blocks are disjoint so can all go at once
+  ClpTaskGroup group;
   for (int iBlock = 1; iBlock < numberBlocks; iBlock++) {
-    cilk_spawn updateDualsInDualBit2(row, djs, theta, iBlock);
+    group.spawn([&row, djs, theta, iBlock]() {
+      updateDualsInDualBit2(row, djs, theta, iBlock);
+    });
   }
   updateDualsInDualBit2(row, djs, theta, 0);
-  cilk_sync;
+  group.wait();
+#else
+  for (int iBlock = 0; iBlock < numberBlocks; iBlock++)
+    updateDualsInDualBit2(row, djs, theta, iBlock);
+#endif
 }
 /// The duals are updated by the given arrays.
 
@@ -1441,11 +1450,18 @@ XXXX
 static void dualColumn2Bit(AbcSimplexDual *dual, dualColumnResult *result,
   int numberBlocks)
 {
+#if ABC_PARALLEL == 2
+  ClpTaskGroup group;
   for (int iBlock = 1; iBlock < numberBlocks; iBlock++) {
-    cilk_spawn dual->dualColumn2First(result[iBlock]);
+    dualColumnResult *resultI = result + iBlock;
+    group.spawn([dual, resultI]() { dual->dualColumn2First(*resultI); });
   }
   dual->dualColumn2First(result[0]);
-  cilk_sync;
+  group.wait();
+#else
+  for (int iBlock = 0; iBlock < numberBlocks; iBlock++)
+    dual->dualColumn2First(result[iBlock]);
+#endif
 }
 void AbcSimplexDual::dualColumn2First(dualColumnResult &result)
 {
@@ -1612,12 +1628,7 @@ void AbcSimplexDual::dualColumn2Most(dualColumnResult &result)
       //result2[iBlock].numberSwapped=numberSwapped;
       //result2[iBlock].numberLastSwapped=numberLastSwapped;
     }
-    for (int iBlock = 1; iBlock < numberBlocks; iBlock++) {
-      cilk_spawn dualColumn2First(result2[iBlock]);
-    }
-    dualColumn2First(result2[0]);
-    cilk_sync;
-    //dualColumn2Bit(this,result2,numberBlocks);
+    dualColumn2Bit(this, result2, numberBlocks);
     numberSwapped = 0;
     numberRemaining = 0;
     for (int iBlock = 0; iBlock < numberBlocks; iBlock++) {
@@ -2358,13 +2369,15 @@ int AbcSimplex::gutsOfSolution(int type)
       info.status = 1;
       info.stuff[0] = whichArray[1];
       info.stuff[1] = whichArray[2];
-      int n = cilk_spawn computeDualsAndCheck(dual, whichArray + 1);
+      int n = 0;
+      ClpTaskGroup group;
+      group.spawn([&]() { n = computeDualsAndCheck(dual, whichArray + 1); });
 #endif
       numberRefinements = computePrimalsAndCheck(dual, whichArray + 3);
 #if ABC_PARALLEL == 1
       numberRefinements += stopParallelStuff(1);
 #else
-      cilk_sync;
+      group.wait();
       numberRefinements += n;
 #endif
     }
@@ -1633,15 +1633,18 @@ double parallelDual4(AbcSimplexDual *dual)
 #if ABC_PARALLEL
     if (numberBlocks > 1) {
 #if ABC_PARALLEL == 2
+      ClpTaskGroup group;
       for (int i = 0; i < numberBlocks; i++) {
         info[i].stuff[1] = i;
         info[i].stuff[2] = -1;
         info[i].result = upperTheta;
-        info[i].result = cilk_spawn
-                           matrix->dualColumn1Row(info[i].stuff[1], COIN_DBL_MAX, info[i].stuff[2],
-                             update, tableauRow, candidateList);
+        CoinThreadInfo *infoI = info + i;
+        group.spawn([=, &update, &tableauRow, &candidateList]() {
+          infoI->result = matrix->dualColumn1Row(infoI->stuff[1], COIN_DBL_MAX, infoI->stuff[2],
+            update, tableauRow, candidateList);
+        });
       }
-      cilk_sync;
+      group.wait();
 #else
       // parallel 1
       for (int i = 0; i < numberBlocks; i++) {
@@ -1684,15 +1687,18 @@ double parallelDual4(AbcSimplexDual *dual)
     if (numberBlocks > 1) {
 #if ABC_PARALLEL == 2
       // do by column
+      ClpTaskGroup group;
       for (int i = 0; i < numberBlocks; i++) {
         info[i].stuff[1] = i;
         info[i].result = upperTheta;
-        cilk_spawn
-          matrix->dualColumn1Part(info[i].stuff[1], info[i].stuff[2],
-            info[i].result,
+        CoinThreadInfo *infoI = info + i;
+        group.spawn([=, &update, &tableauRow, &candidateList]() {
+          matrix->dualColumn1Part(infoI->stuff[1], infoI->stuff[2],
+            infoI->result,
             update, tableauRow, candidateList);
+        });
       }
-      cilk_sync;
+      group.wait();
 #else
       // parallel 1
       // do by column
@@ -1835,13 +1841,15 @@ void parallelDual5(AbcSimplexFactorization *factorization,
   int whichCpu,
   double *weights)
 {
-  if (whichCpu) {
-    cilk_spawn parallelDual5(factorization, whichVector, numberCpu, whichCpu - 1, weights);
-    parallelDual5a(factorization, whichVector[whichCpu], numberCpu, whichCpu, weights);
-    cilk_sync;
-  } else {
-    parallelDual5a(factorization, whichVector[whichCpu], numberCpu, whichCpu, weights);
+  // cpu 0 on this thread - each cpu has its own work area in factorization
+  ClpTaskGroup group;
+  for (int iCpu = 1; iCpu <= whichCpu; iCpu++) {
+    group.spawn([=]() {
+      parallelDual5a(factorization, whichVector[iCpu], numberCpu, iCpu, weights);
+    });
   }
+  parallelDual5a(factorization, whichVector[0], numberCpu, 0, weights);
+  group.wait();
 }
 #endif
 // cilk seems a bit fragile
@@ -29,8 +29,22 @@
 #include "CoinHelperFunctions.hpp"
 #include "CoinSort.hpp"
 #include "ClpCholeskyDense.hpp"
+#include "ClpCholeskySymbolic.hpp"
 #include "ClpMessage.hpp"
 #include "ClpQuadraticObjective.hpp"
+#include "ClpThreadPool.hpp"
+// Aim for this many subtrees (independent of number of threads)
+#ifndef CLP_SUBTREES
+#define CLP_SUBTREES 64
+#endif
+// Not worth splitting if less work than this
+#ifndef CLP_SUBTREE_WORK
+#define CLP_SUBTREE_WORK 1.0e6
+#endif
+// Regions sharing one pass over factor in solveMultiple
+#ifndef CLP_SOLVE_BLOCK
+#define CLP_SOLVE_BLOCK 4
+#endif
 
 //#############################################################################
 // Constructors / Destructor / Assignment
@@ -69,6 +83,12 @@ ClpCholeskyBase::ClpCholeskyBase(int denseThreshold)
   , denseColumn_(NULL)
   , dense_(NULL)
   , denseThreshold_(denseThreshold)
+  , numberSubtrees_(0)
+  , sizeSubtree_(0)
+  , subtree_(NULL)
+  , symbolicCache_(NULL)
+  , ownSymbolic_(NULL)
+  , symbolicVersion_(0)
 {
   memset(integerParameters_, 0, 64 * sizeof(int));
   memset(doubleParameters_, 0, 64 * sizeof(double));
@@ -115,6 +135,13 @@ ClpCholeskyBase::ClpCholeskyBase(const ClpCholeskyBase &rhs)
   denseColumn_ = NULL;
   dense_ = NULL;
   denseThreshold_ = rhs.denseThreshold_;
+  numberSubtrees_ = rhs.numberSubtrees_;
+  sizeSubtree_ = rhs.sizeSubtree_;
+  subtree_ = ClpCopyOfArray(rhs.subtree_, sizeSubtree_);
+  // dense part is not copied so copy must redo symbolic (or use cache)
+  symbolicCache_ = rhs.symbolicCache_;
+  ownSymbolic_ = NULL;
+  symbolicVersion_ = 0;
 }
 
 //-------------------------------------------------------------------
@@ -138,6 +165,8 @@ ClpCholeskyBase::~ClpCholeskyBase()
   delete[] whichDense_;
   delete[] denseColumn_;
   delete dense_;
+  delete[] subtree_;
+  delete ownSymbolic_;
 }
 
 //----------------------------------------------------------------
@@ -172,6 +201,8 @@ ClpCholeskyBase::operator=(const ClpCholeskyBase &rhs)
     delete[] whichDense_;
     delete[] denseColumn_;
     delete dense_;
+    delete[] subtree_;
+    delete ownSymbolic_;
     rowsDropped_ = ClpCopyOfArray(rhs.rowsDropped_, numberRows_);
     permuteInverse_ = ClpCopyOfArray(rhs.permuteInverse_, numberRows_);
     permute_ = ClpCopyOfArray(rhs.permute_, numberRows_);
@@ -198,6 +229,12 @@ ClpCholeskyBase::operator=(const ClpCholeskyBase &rhs)
     denseColumn_ = NULL;
     dense_ = NULL;
     denseThreshold_ = rhs.denseThreshold_;
+    numberSubtrees_ = rhs.numberSubtrees_;
+    sizeSubtree_ = rhs.sizeSubtree_;
+    subtree_ = ClpCopyOfArray(rhs.subtree_, sizeSubtree_);
+    symbolicCache_ = rhs.symbolicCache_;
+    ownSymbolic_ = NULL;
+    symbolicVersion_ = 0;
   }
   return *this;
 }
@@ -2468,6 +2505,13 @@ int ClpCholeskyBase::symbolic()
     clique_ = NULL;
     return -1;
   }
+  findSubtrees();
+  // keep so a solve with same pattern can skip order and symbolic
+  if (!type_) {
+    if (!symbolicCache_ && !ownSymbolic_)
+      ownSymbolic_ = new ClpCholeskySymbolic();
+    saveSymbolic(symbolicCache_ ? *symbolicCache_ : *ownSymbolic_);
+  }
   return 0;
 }
 int ClpCholeskyBase::symbolic1(const int *Astart, const int *Arow)
@@ -2723,6 +2767,133 @@ int ClpCholeskyBase::symbolic2(const int *Astart, const int *Arow)
   }
   return 0;
 }
+/* Finds independent subtrees of elimination tree for parallel
+   factorization and solve.  The split only depends on structure.
+*/
+void ClpCholeskyBase::findSubtrees()
+{
+  delete[] subtree_;
+  subtree_ = NULL;
+  sizeSubtree_ = 0;
+  numberSubtrees_ = 0;
+  if (firstDense_ < 2)
+    return;
+  // parent in elimination tree (-1 if root or parent dense)
+  int *parent = new int[firstDense_];
+  // work in subtree
+  double *weight = new double[firstDense_];
+  double totalWork = 0.0;
+  int iRow;
+  for (iRow = 0; iRow < firstDense_; iRow++) {
+    CoinBigIndex start = choleskyStart_[iRow];
+    CoinBigIndex end = choleskyStart_[iRow + 1];
+    double length = static_cast< double >(end - start);
+    weight[iRow] = 1.0 + length * (length + 2.0);
+    totalWork += weight[iRow];
+    parent[iRow] = -1;
+    if (start < end) {
+      int jRow = choleskyRow_[indexStart_[iRow]];
+      if (jRow < firstDense_)
+        parent[iRow] = jRow;
+    }
+  }
+  if (totalWork < CLP_SUBTREE_WORK) {
+    delete[] parent;
+    delete[] weight;
+    return;
+  }
+  for (iRow = 0; iRow < firstDense_; iRow++) {
+    if (parent[iRow] >= 0)
+      weight[parent[iRow]] += weight[iRow];
+  }
+  double target = totalWork / CLP_SUBTREES;
+  /* Go down tree - a row is root of subtree if small enough and parent
+     is not in a subtree.  A clique must not be split so root can not be
+     in clique unless last. */
+  int *owner = new int[firstDense_];
+  for (iRow = firstDense_ - 1; iRow >= 0; iRow--) {
+    int jRow = parent[iRow];
+    if (jRow >= 0 && owner[jRow] >= 0)
+      owner[iRow] = owner[jRow];
+    else if (weight[iRow] <= target && clique_[iRow] <= 1)
+      owner[iRow] = iRow;
+    else
+      owner[iRow] = -1;
+  }
+  // Put small subtrees together (parent now used for subtree of root)
+  double sum = 0.0;
+  for (iRow = 0; iRow < firstDense_; iRow++) {
+    if (owner[iRow] == iRow) {
+      parent[iRow] = numberSubtrees_;
+      sum += weight[iRow];
+      if (sum >= target) {
+        numberSubtrees_++;
+        sum = 0.0;
+      }
+    }
+  }
+  if (sum > 0.0)
+    numberSubtrees_++;
+  delete[] weight;
+  if (numberSubtrees_ < 2) {
+    numberSubtrees_ = 0;
+    delete[] parent;
+    delete[] owner;
+    return;
+  }
+  // starts, rows, owner, then starts and rows of elements outside subtree
+  int *count = new int[numberSubtrees_ + 1];
+  CoinZeroN(count, numberSubtrees_ + 1);
+  int numberOutside = 0;
+  for (iRow = 0; iRow < firstDense_; iRow++) {
+    int iSubtree = owner[iRow] >= 0 ? parent[owner[iRow]] : numberSubtrees_;
+    owner[iRow] = iSubtree;
+    count[iSubtree]++;
+  }
+  for (iRow = 0; iRow < firstDense_; iRow++) {
+    int iSubtree = owner[iRow];
+    if (iSubtree < numberSubtrees_) {
+      int offset = indexStart_[iRow] - choleskyStart_[iRow];
+      for (CoinBigIndex j = choleskyStart_[iRow]; j < choleskyStart_[iRow + 1]; j++) {
+        int jRow = choleskyRow_[j + offset];
+        if (jRow >= firstDense_ || owner[jRow] != iSubtree)
+          numberOutside++;
+      }
+    }
+  }
+  sizeSubtree_ = 2 * numberSubtrees_ + 3 + 2 * firstDense_ + numberOutside;
+  subtree_ = new int[sizeSubtree_];
+  int *subtreeStart = subtree_;
+  int *subtreeRows = subtreeStart + numberSubtrees_ + 2;
+  int *subtreeOwner = subtreeRows + firstDense_;
+  int *outsideStart = subtreeOwner + firstDense_;
+  int *outsideRow = outsideStart + numberSubtrees_ + 1;
+  subtreeStart[0] = 0;
+  for (int iSubtree = 0; iSubtree <= numberSubtrees_; iSubtree++) {
+    subtreeStart[iSubtree + 1] = subtreeStart[iSubtree] + count[iSubtree];
+    count[iSubtree] = subtreeStart[iSubtree];
+  }
+  for (iRow = 0; iRow < firstDense_; iRow++)
+    subtreeRows[count[owner[iRow]]++] = iRow;
+  CoinMemcpyN(owner, firstDense_, subtreeOwner);
+  numberOutside = 0;
+  for (int iSubtree = 0; iSubtree < numberSubtrees_; iSubtree++) {
+    outsideStart[iSubtree] = numberOutside;
+    for (int k = subtreeStart[iSubtree]; k < subtreeStart[iSubtree + 1]; k++) {
+      iRow = subtreeRows[k];
+      int offset = indexStart_[iRow] - choleskyStart_[iRow];
+      for (CoinBigIndex j = choleskyStart_[iRow]; j < choleskyStart_[iRow + 1]; j++) {
+        int jRow = choleskyRow_[j + offset];
+        if (jRow >= firstDense_ || owner[jRow] != iSubtree)
+          outsideRow[numberOutside++] = jRow;
+      }
+    }
+  }
+  outsideStart[numberSubtrees_] = numberOutside;
+  delete[] count;
+  delete[] parent;
+  delete[] owner;
+}
 /* Factorize - filling in rowsDropped and returning number dropped */
 int ClpCholeskyBase::factorize(const CoinWorkDouble *diagonal, int *rowsDropped)
 {
@@ -3330,15 +3501,159 @@ void ClpCholeskyBase::factorizePart2(int *rowsDropped)
     first[iRow] = choleskyStart_[iRow];
   }
 
+  int numberDropped = 0;
+  ClpThreadPool *pool = ClpThreadPool::pool();
+  if (numberSubtrees_) {
+    /* Independent subtrees of elimination tree are factorized as tasks.
+       Links to rows outside a subtree are made afterwards (in subtree
+       order) so result does not depend on number of threads - this order
+       is also used with one thread. */
+    const int *subtreeStart = subtree_;
+    const int *subtreeRows = subtreeStart + numberSubtrees_ + 2;
+    const int *owner = subtreeRows + firstDense_;
+    int *deferred = new int[3 * firstDense_];
+    int *numberDeferred = new int[2 * numberSubtrees_];
+    int *numberDroppedSubtree = numberDeferred + numberSubtrees_;
+    CoinWorkDouble *largestSubtree = new CoinWorkDouble[2 * numberSubtrees_];
+    CoinWorkDouble *smallestSubtree = largestSubtree + numberSubtrees_;
+    // each worker has its own work array
+    int numberWorkers = CoinMin(pool->numberThreads(), numberSubtrees_);
+    longDouble *extraWork = new longDouble[(numberWorkers - 1) * numberRows_];
+    CoinZeroN(extraWork, (numberWorkers - 1) * numberRows_);
+    std::atomic< int > nextSubtree(0);
+    {
+      ClpTaskGroup group(pool);
+      for (int iWorker = 0; iWorker < numberWorkers; iWorker++) {
+        longDouble *workerWork = iWorker ? extraWork + (iWorker - 1) * numberRows_ : work;
+        auto doSubtrees = [=, &nextSubtree]() {
+          while (true) {
+            int iSubtree = nextSubtree.fetch_add(1);
+            if (iSubtree >= numberSubtrees_)
+              break;
+            int start = subtreeStart[iSubtree];
+            numberDeferred[iSubtree] = 0;
+            numberDroppedSubtree[iSubtree] = 0;
+            largestSubtree[iSubtree] = 0.0;
+            smallestSubtree[iSubtree] = COIN_DBL_MAX;
+            factorizeRows(subtreeRows + start, subtreeStart[iSubtree + 1] - start,
+              owner, iSubtree, d, workerWork, first, rowsDropped,
+              deferred + 3 * start, numberDeferred[iSubtree],
+              largestSubtree[iSubtree], smallestSubtree[iSubtree],
+              numberDroppedSubtree[iSubtree]);
+          }
+        };
+        if (iWorker < numberWorkers - 1)
+          group.spawn(doSubtrees);
+        else
+          doSubtrees();
+      }
+      group.wait();
+    }
+    delete[] extraWork;
+    for (int iSubtree = 0; iSubtree < numberSubtrees_; iSubtree++) {
+      const int *put = deferred + 3 * subtreeStart[iSubtree];
+      for (int i = 0; i < numberDeferred[iSubtree]; i++) {
+        int firstRow = put[3 * i];
+        int lastRow = put[3 * i + 1];
+        int jRow = put[3 * i + 2];
+        link_[lastRow] = link_[jRow];
+        link_[jRow] = firstRow;
+      }
+      largest = CoinMax(largest, largestSubtree[iSubtree]);
+      smallest = CoinMin(smallest, smallestSubtree[iSubtree]);
+      numberDropped += numberDroppedSubtree[iSubtree];
+    }
+    delete[] deferred;
+    delete[] numberDeferred;
+    delete[] largestSubtree;
+    // and rest
+    int start = subtreeStart[numberSubtrees_];
+    int nDeferred = 0;
+    factorizeRows(subtreeRows + start, subtreeStart[numberSubtrees_ + 1] - start,
+      NULL, -1, d, work, first, rowsDropped, NULL, nDeferred,
+      largest, smallest, numberDropped);
+  } else {
+    int nDeferred = 0;
+    factorizeRows(NULL, firstDense_, NULL, -1, d, work, first, rowsDropped,
+      NULL, nDeferred, largest, smallest, numberDropped);
+  }
+  integerParameters_[20] += numberDropped;
+  if (firstDense_ < numberRows_) {
+    // do dense
+    // update dense part
+    updateDense(d, /*work,*/ first);
+    ClpCholeskyDense dense;
+    // just borrow space
+    int nDense = numberRows_ - firstDense_;
+    if (doKKT_) {
+      for (iRow = firstDense_; iRow < numberRows_; iRow++) {
+        int originalRow = permute_[iRow];
+        if (originalRow >= firstPositive) {
+          firstPositive = iRow - firstDense_;
+          break;
+        }
+      }
+    }
+    dense.reserveSpace(this, nDense);
+    int *dropped = new int[nDense];
+    memset(dropped, 0, nDense * sizeof(int));
+    dense.setDoubleParameter(3, largest);
+    dense.setDoubleParameter(4, smallest);
+    dense.setDoubleParameter(10, dropValue);
+    dense.setIntegerParameter(20, 0);
+    dense.setIntegerParameter(34, firstPositive);
+    dense.setModel(model_);
+    dense.factorizePart2(dropped);
+    largest = dense.getDoubleParameter(3);
+    smallest = dense.getDoubleParameter(4);
+    integerParameters_[20] += dense.getIntegerParameter(20);
+    for (iRow = firstDense_; iRow < numberRows_; iRow++) {
+      int originalRow = permute_[iRow];
+      rowsDropped[originalRow] = dropped[iRow - firstDense_];
+    }
+    delete[] dropped;
+  }
+  delete[] d;
+  doubleParameters_[3] = largest;
+  doubleParameters_[4] = smallest;
+  return;
+}
+// Put chain firstRow to lastInChain (already linked) at start of list for row
+// - or if row is not in this subtree save so can be done later
+#define CLP_LINK_CHAIN(firstRow, lastInChain, row)                  \
+  if (owner && ((row) >= firstDense_ || owner[row] != whichSubtree)) { \
+    deferred[3 * numberDeferred] = (firstRow);                       \
+    deferred[3 * numberDeferred + 1] = (lastInChain);                \
+    deferred[3 * numberDeferred + 2] = (row);                        \
+    numberDeferred++;                                                \
+  } else {                                                           \
+    link_[lastInChain] = link_[row];                                 \
+    link_[row] = (firstRow);                                         \
+  }
+/* Left looking factorization of rows (in increasing order) for factorizePart2.
+   If rows NULL then rows are 0 to numberList-1.  If owner given then links
+   to rows not in subtree whichSubtree are saved in deferred
+   (as first,last,row of chain) rather than made.
+*/
+void ClpCholeskyBase::factorizeRows(const int *rows, int numberList,
+  const int *owner, int whichSubtree, longDouble *d, longDouble *work,
+  int *first, int *rowsDropped, int *deferred, int &numberDeferred,
+  CoinWorkDouble &largest, CoinWorkDouble &smallest, int &numberDropped)
+{
+  double dropValue = doubleParameters_[10];
+  int firstPositive = integerParameters_[34];
   int lastClique = -1;
   bool inClique = false;
   bool newClique = false;
   bool endClique = false;
   int lastRow = 0;
   int nextRow2 = -1;
+  int lastDone = -1;
+  int iRow = -1;
 
-  for (iRow = 0; iRow < firstDense_ + 1; iRow++) {
-    if (iRow < firstDense_) {
+  for (int iList = 0; iList < numberList + 1; iList++) {
+    if (iList < numberList) {
+      iRow = rows ? rows[iList] : iList;
       endClique = false;
       if (clique_[iRow] > 0) {
         // this is in a clique
@@ -3369,7 +3684,7 @@ void ClpCholeskyBase::factorizePart2(int *rowsDropped)
     if (endClique) {
       // We have just finished updating a clique - do block pivot and clean up
       int jRow;
-      for (jRow = lastRow; jRow < iRow; jRow++) {
+      for (jRow = lastRow; jRow <= lastDone; jRow++) {
         int jCount = jRow - lastRow;
         CoinWorkDouble diagonalValue = diagonal_[jRow];
         CoinBigIndex start = choleskyStart_[jRow];
@@ -3396,7 +3711,7 @@ void ClpCholeskyBase::factorizePart2(int *rowsDropped)
             rowsDropped[originalRow] = 2;
             d[jRow] = -1.0e100;
             diagonalValue = 0.0;
-            integerParameters_[20]++;
+            numberDropped++;
           }
         } else {
           // must be positive
@@ -3409,7 +3724,7 @@ void ClpCholeskyBase::factorizePart2(int *rowsDropped)
             rowsDropped[originalRow] = 2;
             d[jRow] = 1.0e100;
             diagonalValue = 0.0;
-            integerParameters_[20]++;
+            numberDropped++;
           }
         }
         diagonal_[jRow] = diagonalValue;
@@ -3418,14 +3733,13 @@ void ClpCholeskyBase::factorizePart2(int *rowsDropped)
         }
       }
       if (nextRow2 >= 0) {
-        for (jRow = lastRow; jRow < iRow - 1; jRow++) {
+        for (jRow = lastRow; jRow < lastDone; jRow++) {
           link_[jRow] = jRow + 1;
         }
-        link_[iRow - 1] = link_[nextRow2];
-        link_[nextRow2] = lastRow;
+        CLP_LINK_CHAIN(lastRow, lastDone, nextRow2);
       }
     }
-    if (iRow == firstDense_)
+    if (iList == numberList)
       break; // we were just cleaning up
     if (newClique) {
       // initialize new clique
@@ -3453,8 +3767,7 @@ void ClpCholeskyBase::factorizePart2(int *rowsDropped)
       if (k < end) {
         int jRow = choleskyRow_[k + offset];
         if (clique_[kRow] < MINCLIQUE) {
-          link_[kRow] = link_[jRow];
-          link_[jRow] = kRow;
+          CLP_LINK_CHAIN(kRow, kRow, jRow);
           for (; k < end; k++) {
             int jRow = choleskyRow_[k + offset];
             work[jRow] += sparseFactor_[k] * value1;
@@ -3462,8 +3775,6 @@ void ClpCholeskyBase::factorizePart2(int *rowsDropped)
         } else {
           // Clique
           CoinBigIndex currentIndex = k + offset;
-          int linkSave = link_[jRow];
-          link_[jRow] = kRow;
           work[kRow] = value1; // ? or a_jk
           int last = kRow + clique_[kRow];
           for (int kkRow = kRow + 1; kkRow < last; kkRow++) {
@@ -3477,7 +3788,7 @@ void ClpCholeskyBase::factorizePart2(int *rowsDropped)
             link_[kkRow - 1] = kkRow;
           }
           nextRow = link_[last - 1];
-          link_[last - 1] = linkSave;
+          CLP_LINK_CHAIN(kRow, last - 1, jRow);
           int length = static_cast< int >(end - k);
           for (int i = 0; i < length; i++) {
             int lRow = choleskyRow_[currentIndex++];
@@ -3523,7 +3834,7 @@ void ClpCholeskyBase::factorizePart2(int *rowsDropped)
           rowsDropped[originalRow] = 2;
           d[iRow] = -1.0e100;
           diagonalValue = 0.0;
-          integerParameters_[20]++;
+          numberDropped++;
         }
       } else {
         // must be positive
@@ -3536,7 +3847,7 @@ void ClpCholeskyBase::factorizePart2(int *rowsDropped)
           rowsDropped[originalRow] = 2;
           d[iRow] = 1.0e100;
           diagonalValue = 0.0;
-          integerParameters_[20]++;
+          numberDropped++;
         }
       }
       diagonal_[iRow] = diagonalValue;
@@ -3546,8 +3857,7 @@ void ClpCholeskyBase::factorizePart2(int *rowsDropped)
       assert(first[iRow] == start);
       if (start < end) {
         int nextRow = choleskyRow_[start + offset];
-        link_[iRow] = link_[nextRow];
-        link_[nextRow] = iRow;
+        CLP_LINK_CHAIN(iRow, iRow, nextRow);
         for (int j = start; j < end; j++) {
           int jRow = choleskyRow_[j + offset];
           CoinWorkDouble value = sparseFactor_[j] - work[jRow];
@@ -3556,49 +3866,37 @@ void ClpCholeskyBase::factorizePart2(int *rowsDropped)
         }
       }
     }
+    lastDone = iRow;
   }
-  if (firstDense_ < numberRows_) {
-    // do dense
-    // update dense part
-    updateDense(d, /*work,*/ first);
-    ClpCholeskyDense dense;
-    // just borrow space
-    int nDense = numberRows_ - firstDense_;
-    if (doKKT_) {
-      for (iRow = firstDense_; iRow < numberRows_; iRow++) {
-        int originalRow = permute_[iRow];
-        if (originalRow >= firstPositive) {
-          firstPositive = iRow - firstDense_;
-          break;
-        }
-      }
-    }
-    dense.reserveSpace(this, nDense);
-    int *dropped = new int[nDense];
-    memset(dropped, 0, nDense * sizeof(int));
-    dense.setDoubleParameter(3, largest);
-    dense.setDoubleParameter(4, smallest);
-    dense.setDoubleParameter(10, dropValue);
-    dense.setIntegerParameter(20, 0);
-    dense.setIntegerParameter(34, firstPositive);
-    dense.setModel(model_);
-    dense.factorizePart2(dropped);
-    largest = dense.getDoubleParameter(3);
-    smallest = dense.getDoubleParameter(4);
-    integerParameters_[20] += dense.getIntegerParameter(20);
-    for (iRow = firstDense_; iRow < numberRows_; iRow++) {
-      int originalRow = permute_[iRow];
-      rowsDropped[originalRow] = dropped[iRow - firstDense_];
-    }
-    delete[] dropped;
-  }
-  delete[] d;
-  doubleParameters_[3] = largest;
-  doubleParameters_[4] = smallest;
-  return;
 }
 // Updates dense part (broken out for profiling)
 void ClpCholeskyBase::updateDense(longDouble *d, /*longDouble * work,*/ int *first)
+{
+  int nDense = numberRows_ - firstDense_;
+  int numberChunks = ClpThreadPool::pool()->numberThreads();
+  if (numberChunks > 1 && nDense >= 4 * numberChunks
+    && static_cast< double >(nDense) * nDense * 0.5 * firstDense_ > CLP_SUBTREE_WORK) {
+    /* Each dense row is updated by just one task so result is as serial.
+       Work for rows from kRow on is about square of rows left so split
+       to give same area to each. */
+    int *chunkStart = new int[numberChunks + 1];
+    chunkStart[0] = firstDense_;
+    for (int i = 1; i < numberChunks; i++) {
+      double fraction = static_cast< double >(numberChunks - i) / numberChunks;
+      chunkStart[i] = numberRows_ - static_cast< int >(nDense * sqrt(fraction));
+    }
+    chunkStart[numberChunks] = numberRows_;
+    clpParallelFor(0, numberChunks, 1, [=](int firstChunk, int lastChunk) {
+      updateDense(d, first, chunkStart[firstChunk], chunkStart[lastChunk]);
+    },
+      numberChunks);
+    delete[] chunkStart;
+  } else {
+    updateDense(d, first, firstDense_, numberRows_);
+  }
+}
+// Updates dense rows firstRow to lastRow-1
+void ClpCholeskyBase::updateDense(longDouble *d, int *first, int firstRow, int lastRow)
 {
   for (int iRow = 0; iRow < firstDense_; iRow++) {
     int start = first[iRow];
@@ -3610,6 +3908,10 @@ void ClpCholeskyBase::updateDense(longDouble *d, /*longDouble * work,*/ int *fir
         for (int k = start; k < end; k++) {
           int kRow = choleskyRow_[k + offset];
           assert(kRow >= firstDense_);
+          if (kRow < firstRow)
+            continue;
+          else if (kRow >= lastRow)
+            break;
           CoinWorkDouble a_ik = sparseFactor_[k];
           CoinWorkDouble value1 = dValue * a_ik;
           diagonal_[kRow] -= value1 * a_ik;
@@ -3630,6 +3932,10 @@ void ClpCholeskyBase::updateDense(longDouble *d, /*longDouble * work,*/ int *fir
         for (int k = start; k < end; k++) {
           int kRow = choleskyRow_[k + offset];
           assert(kRow >= firstDense_);
+          if (kRow < firstRow)
+            continue;
+          else if (kRow >= lastRow)
+            break;
           CoinWorkDouble a_ik0 = sparseFactor_[k];
           CoinWorkDouble value0 = dValue0 * a_ik0;
           CoinWorkDouble a_ik1 = sparseFactor_[k + offset1];
@@ -3661,6 +3967,10 @@ void ClpCholeskyBase::updateDense(longDouble *d, /*longDouble * work,*/ int *fir
         for (int k = start; k < end; k++) {
           int kRow = choleskyRow_[k + offset];
           assert(kRow >= firstDense_);
+          if (kRow < firstRow)
+            continue;
+          else if (kRow >= lastRow)
+            break;
           CoinWorkDouble diagonalValue = diagonal_[kRow];
           CoinWorkDouble a_ik0 = sparseFactor_[k];
           CoinWorkDouble value0 = dValue0 * a_ik0;
@@ -3694,6 +4004,10 @@ void ClpCholeskyBase::updateDense(longDouble *d, /*longDouble * work,*/ int *fir
         for (int k = start; k < end; k++) {
           int kRow = choleskyRow_[k + offset];
           assert(kRow >= firstDense_);
+          if (kRow < firstRow)
+            continue;
+          else if (kRow >= lastRow)
+            break;
           CoinWorkDouble diagonalValue = diagonal_[kRow];
           CoinWorkDouble a_ik0 = sparseFactor_[k];
           CoinWorkDouble value0 = dValue0 * a_ik0;
@@ -3726,26 +4040,33 @@ void ClpCholeskyBase::solve(CoinWorkDouble *region)
     solve(region, 3);
   } else {
     // dense columns
-    int i;
     solve(region, 1);
     // do change;
     int numberDense = dense_->numberRows();
     CoinWorkDouble *change = new CoinWorkDouble[numberDense];
-    for (i = 0; i < numberDense; i++) {
-      const longDouble *a = denseColumn_ + i * numberRows_;
-      CoinWorkDouble value = 0.0;
-      for (int iRow = 0; iRow < numberRows_; iRow++)
-        value += a[iRow] * region[iRow];
-      change[i] = value;
-    }
+    // in parallel if worth it - order of operations does not change
+    int numberChunks = static_cast< double >(numberDense) * numberRows_ > CLP_SUBTREE_WORK ? 0 : 1;
+    clpParallelFor(0, numberDense, 1, [=](int firstDense, int lastDense) {
+      for (int i = firstDense; i < lastDense; i++) {
+        const longDouble *a = denseColumn_ + i * numberRows_;
+        CoinWorkDouble value = 0.0;
+        for (int iRow = 0; iRow < numberRows_; iRow++)
+          value += a[iRow] * region[iRow];
+        change[i] = value;
+      }
+    },
+      numberChunks);
     // solve
     dense_->solve(change);
-    for (i = 0; i < numberDense; i++) {
-      const longDouble *a = denseColumn_ + i * numberRows_;
-      CoinWorkDouble value = change[i];
-      for (int iRow = 0; iRow < numberRows_; iRow++)
-        region[iRow] -= value * a[iRow];
-    }
+    clpParallelFor(0, numberRows_, 1024, [=](int firstRow, int lastRow) {
+      for (int i = 0; i < numberDense; i++) {
+        const longDouble *a = denseColumn_ + i * numberRows_;
+        CoinWorkDouble value = change[i];
+        for (int iRow = firstRow; iRow < lastRow; iRow++)
+          region[iRow] -= value * a[iRow];
+      }
+    },
+      numberChunks);
     delete[] change;
     // and finish off
     solve(region, 2);
@@ -3798,6 +4119,10 @@ void ClpCholeskyBase::solve(CoinWorkDouble *region, int type)
     }
     break;
   case 3:
+    if (numberSubtrees_) {
+      solveSubtrees(work, region);
+      break;
+    }
     for (i = 0; i < firstDense_; i++) {
       int offset = indexStart_[i] - choleskyStart_[i];
       CoinWorkDouble value = work[i];
@@ -3889,6 +4214,412 @@ void ClpCholeskyBase::solve(CoinWorkDouble *region, int type)
   }
 #endif
 }
+/* Solve (as type 3) using subtrees in parallel.  Updates to rows outside
+   a subtree are saved and done in subtree order so forward pass does not
+   depend on number of threads and backward pass is as serial.
+*/
+void ClpCholeskyBase::solveSubtrees(CoinWorkDouble *work, CoinWorkDouble *region)
+{
+  const int *subtreeStart = subtree_;
+  const int *subtreeRows = subtreeStart + numberSubtrees_ + 2;
+  const int *owner = subtreeRows + firstDense_;
+  const int *outsideStart = owner + firstDense_;
+  const int *outsideRow = outsideStart + numberSubtrees_ + 1;
+  CoinWorkDouble *outside = new CoinWorkDouble[outsideStart[numberSubtrees_]];
+  clpParallelFor(0, numberSubtrees_, 1, [=](int firstSubtree, int lastSubtree) {
+    for (int iSubtree = firstSubtree; iSubtree < lastSubtree; iSubtree++) {
+      CoinWorkDouble *put = outside + outsideStart[iSubtree];
+      for (int k = subtreeStart[iSubtree]; k < subtreeStart[iSubtree + 1]; k++) {
+        int i = subtreeRows[k];
+        int offset = indexStart_[i] - choleskyStart_[i];
+        CoinWorkDouble value = work[i];
+        for (CoinBigIndex j = choleskyStart_[i]; j < choleskyStart_[i + 1]; j++) {
+          int iRow = choleskyRow_[j + offset];
+          if (iRow < firstDense_ && owner[iRow] == iSubtree)
+            work[iRow] -= sparseFactor_[j] * value;
+          else
+            *put++ = sparseFactor_[j] * value;
+        }
+      }
+    }
+  },
+    numberSubtrees_);
+  int k;
+  for (k = 0; k < outsideStart[numberSubtrees_]; k++)
+    work[outsideRow[k]] -= outside[k];
+  delete[] outside;
+  int i;
+  CoinBigIndex j;
+  for (k = subtreeStart[numberSubtrees_]; k < subtreeStart[numberSubtrees_ + 1]; k++) {
+    i = subtreeRows[k];
+    int offset = indexStart_[i] - choleskyStart_[i];
+    CoinWorkDouble value = work[i];
+    for (j = choleskyStart_[i]; j < choleskyStart_[i + 1]; j++) {
+      int iRow = choleskyRow_[j + offset];
+      work[iRow] -= sparseFactor_[j] * value;
+    }
+  }
+  if (firstDense_ < numberRows_) {
+    // do dense
+    ClpCholeskyDense dense;
+    // just borrow space
+    int nDense = numberRows_ - firstDense_;
+    dense.reserveSpace(this, nDense);
+    dense.solve(work + firstDense_);
+    for (i = numberRows_ - 1; i >= firstDense_; i--) {
+      CoinWorkDouble value = work[i];
+      int iRow = permute_[i];
+      region[iRow] = value;
+    }
+  }
+  // backward - rest first then subtrees only need rows above them
+  for (k = subtreeStart[numberSubtrees_ + 1] - 1; k >= subtreeStart[numberSubtrees_]; k--) {
+    i = subtreeRows[k];
+    int offset = indexStart_[i] - choleskyStart_[i];
+    CoinWorkDouble value = work[i] * diagonal_[i];
+    for (j = choleskyStart_[i]; j < choleskyStart_[i + 1]; j++) {
+      int iRow = choleskyRow_[j + offset];
+      value -= sparseFactor_[j] * work[iRow];
+    }
+    work[i] = value;
+    int iRow = permute_[i];
+    region[iRow] = value;
+  }
+  clpParallelFor(0, numberSubtrees_, 1, [=](int firstSubtree, int lastSubtree) {
+    for (int iSubtree = firstSubtree; iSubtree < lastSubtree; iSubtree++) {
+      for (int k = subtreeStart[iSubtree + 1] - 1; k >= subtreeStart[iSubtree]; k--) {
+        int i = subtreeRows[k];
+        int offset = indexStart_[i] - choleskyStart_[i];
+        CoinWorkDouble value = work[i] * diagonal_[i];
+        for (CoinBigIndex j = choleskyStart_[i]; j < choleskyStart_[i + 1]; j++) {
+          int iRow = choleskyRow_[j + offset];
+          value -= sparseFactor_[j] * work[iRow];
+        }
+        work[i] = value;
+        int iRow = permute_[i];
+        region[iRow] = value;
+      }
+    }
+  },
+    numberSubtrees_);
+}
+// Mixes value into fingerprint (splitmix64 finalizer)
+static inline CoinUInt64 clpMixFingerprint(CoinUInt64 hash, CoinUInt64 value)
+{
+  hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+  hash ^= hash >> 30;
+  hash *= 0xbf58476d1ce4e5b9ULL;
+  hash ^= hash >> 27;
+  hash *= 0x94d049bb133111ebULL;
+  hash ^= hash >> 31;
+  return hash;
+}
+/* Fingerprint of everything order and symbolic look at -
+   sizes, options and pattern of matrix (and quadratic if KKT).
+   Values do not matter.  Never returns 0. */
+CoinUInt64 ClpCholeskyBase::patternFingerprint(const ClpInterior *model) const
+{
+  ClpInterior *interior = const_cast< ClpInterior * >(model);
+  int numberRows = interior->numberRows();
+  int numberColumns = interior->numberColumns();
+  CoinUInt64 hash = clpMixFingerprint(0, numberRows);
+  hash = clpMixFingerprint(hash, numberColumns);
+  hash = clpMixFingerprint(hash, doKKT_ ? 1 : 0);
+  hash = clpMixFingerprint(hash, static_cast< CoinUInt64 >(denseThreshold_));
+  const ClpMatrixBase *matrix = interior->clpMatrix();
+  const CoinBigIndex *columnStart = matrix->getVectorStarts();
+  const int *columnLength = matrix->getVectorLengths();
+  const int *row = matrix->getIndices();
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    hash = clpMixFingerprint(hash, columnLength[iColumn]);
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++)
+      hash = clpMixFingerprint(hash, row[j]);
+  }
+  const CoinPackedMatrix *quadratic = kktQuadratic(model);
+  if (quadratic) {
+    const CoinBigIndex *columnQuadraticStart = quadratic->getVectorStarts();
+    const int *columnQuadraticLength = quadratic->getVectorLengths();
+    const int *columnQuadratic = quadratic->getIndices();
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      hash = clpMixFingerprint(hash, columnQuadraticLength[iColumn]);
+      for (CoinBigIndex j = columnQuadraticStart[iColumn];
+           j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++)
+        hash = clpMixFingerprint(hash, columnQuadratic[j]);
+    }
+  }
+  return hash ? hash : 1;
+}
+// Quadratic objective matrix if KKT and quadratic (pattern matters)
+const CoinPackedMatrix *ClpCholeskyBase::kktQuadratic(const ClpInterior *model) const
+{
+  if (!doKKT_)
+    return NULL;
+  ClpInterior *interior = const_cast< ClpInterior * >(model);
+  ClpQuadraticObjective *quadraticObj = (dynamic_cast< ClpQuadraticObjective * >(interior->objectiveAsObject()));
+  return quadraticObj ? quadraticObj->quadraticObjective() : NULL;
+}
+// Copies pattern of columns (start,length,index) to start and index
+static void clpCopyPattern(int numberColumns, const CoinBigIndex *columnStart,
+  const int *columnLength, const int *row, CoinBigIndex *&start, int *&index)
+{
+  start = new CoinBigIndex[numberColumns + 1];
+  CoinBigIndex n = 0;
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    start[iColumn] = n;
+    n += columnLength[iColumn];
+  }
+  start[numberColumns] = n;
+  index = new int[CoinMax(n, static_cast< CoinBigIndex >(1))];
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+    CoinMemcpyN(row + columnStart[iColumn], columnLength[iColumn], index + start[iColumn]);
+}
+// True if columns (start,length,index) have pattern start and index
+static bool clpSamePattern(int numberColumns, const CoinBigIndex *columnStart,
+  const int *columnLength, const int *row, const CoinBigIndex *start, const int *index)
+{
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    int length = columnLength[iColumn];
+    if (start[iColumn + 1] - start[iColumn] != length)
+      return false;
+    if (memcmp(row + columnStart[iColumn], index + start[iColumn], length * sizeof(int)))
+      return false;
+  }
+  return true;
+}
+/* True if cache has symbolic for model - sizes, options and
+   pattern of matrix (and quadratic if KKT) are compared in full */
+bool ClpCholeskyBase::samePattern(const ClpCholeskySymbolic &cache, const ClpInterior *model) const
+{
+  ClpInterior *interior = const_cast< ClpInterior * >(model);
+  int numberColumns = interior->numberColumns();
+  if (!cache.fingerprint_ || !cache.patternStart_
+    || cache.numberModelRows_ != interior->numberRows()
+    || cache.numberColumns_ != numberColumns || cache.kkt_ != (doKKT_ ? 1 : 0)
+    || cache.denseThreshold_ != denseThreshold_)
+    return false;
+  const ClpMatrixBase *matrix = interior->clpMatrix();
+  if (!clpSamePattern(numberColumns, matrix->getVectorStarts(), matrix->getVectorLengths(),
+        matrix->getIndices(), cache.patternStart_, cache.patternRow_))
+    return false;
+  const CoinPackedMatrix *quadratic = kktQuadratic(model);
+  if ((quadratic != NULL) != (cache.quadraticStart_ != NULL))
+    return false;
+  if (quadratic && !clpSamePattern(numberColumns, quadratic->getVectorStarts(), quadratic->getVectorLengths(), quadratic->getIndices(), cache.quadraticStart_, cache.quadraticRow_))
+    return false;
+  return true;
+}
+/* If symbolic was done for same pattern then just picks up
+   new model and values - otherwise symbolic may come from cache.
+   Only for native factorization - other types keep their own
+   symbolic data. */
+bool ClpCholeskyBase::reuseSymbolic(ClpInterior *model)
+{
+  // own copy if no shared cache
+  const ClpCholeskySymbolic *cache = symbolicCache_ ? symbolicCache_ : ownSymbolic_;
+  if (type_ || !cache || !samePattern(*cache, model))
+    return false;
+  if (!choleskyStart_ || symbolicVersion_ != cache->version_) {
+    // arrays here are not from cache
+    restoreSymbolic(model, *cache);
+    return true;
+  }
+  model_ = model;
+  // factorize takes values from row copy
+  delete rowCopy_;
+  rowCopy_ = model_->clpMatrix()->reverseOrderedCopy();
+  numberRowsDropped_ = 0;
+  memset(rowsDropped_, 0, numberRows_);
+  status_ = 0;
+  return true;
+}
+// Saves symbolic information (and pattern it is for) in cache
+void ClpCholeskyBase::saveSymbolic(ClpCholeskySymbolic &cache)
+{
+  cache.clear();
+  int numberColumns = model_->numberColumns();
+  cache.numberRows_ = numberRows_;
+  cache.numberModelRows_ = model_->numberRows();
+  cache.numberColumns_ = numberColumns;
+  cache.kkt_ = doKKT_ ? 1 : 0;
+  cache.denseThreshold_ = denseThreshold_;
+  cache.sizeFactor_ = sizeFactor_;
+  cache.sizeIndex_ = sizeIndex_;
+  cache.firstDense_ = firstDense_;
+  const ClpMatrixBase *matrix = model_->clpMatrix();
+  clpCopyPattern(numberColumns, matrix->getVectorStarts(), matrix->getVectorLengths(),
+    matrix->getIndices(), cache.patternStart_, cache.patternRow_);
+  const CoinPackedMatrix *quadratic = kktQuadratic(model_);
+  if (quadratic)
+    clpCopyPattern(numberColumns, quadratic->getVectorStarts(), quadratic->getVectorLengths(),
+      quadratic->getIndices(), cache.quadraticStart_, cache.quadraticRow_);
+  cache.permute_ = ClpCopyOfArray(permute_, numberRows_);
+  cache.choleskyStart_ = ClpCopyOfArray(choleskyStart_, numberRows_ + 1);
+  cache.indexStart_ = ClpCopyOfArray(indexStart_, numberRows_);
+  cache.choleskyRow_ = ClpCopyOfArray(choleskyRow_, sizeIndex_);
+  cache.clique_ = ClpCopyOfArray(clique_, numberRows_);
+  cache.whichDense_ = ClpCopyOfArray(whichDense_, numberColumns);
+  cache.fingerprint_ = patternFingerprint(model_);
+  symbolicVersion_ = cache.version_;
+}
+/* Takes symbolic information from cache - as if order and symbolic
+   had been done.  Work arrays and dense column space are created as
+   in preOrder and symbolic. */
+void ClpCholeskyBase::restoreSymbolic(ClpInterior *model, const ClpCholeskySymbolic &cache)
+{
+  model_ = model;
+  numberRows_ = cache.numberRows_;
+  sizeFactor_ = cache.sizeFactor_;
+  sizeIndex_ = cache.sizeIndex_;
+  firstDense_ = cache.firstDense_;
+  delete rowCopy_;
+  rowCopy_ = model_->clpMatrix()->reverseOrderedCopy();
+  delete[] rowsDropped_;
+  rowsDropped_ = new char[numberRows_];
+  memset(rowsDropped_, 0, numberRows_);
+  numberRowsDropped_ = 0;
+  status_ = 0;
+  delete[] permute_;
+  permute_ = ClpCopyOfArray(cache.permute_, numberRows_);
+  delete[] permuteInverse_;
+  permuteInverse_ = new CoinBigIndex[numberRows_];
+  for (int iRow = 0; iRow < numberRows_; iRow++)
+    permuteInverse_[permute_[iRow]] = iRow;
+  delete[] choleskyStart_;
+  choleskyStart_ = ClpCopyOfArray(cache.choleskyStart_, numberRows_ + 1);
+  delete[] indexStart_;
+  indexStart_ = ClpCopyOfArray(cache.indexStart_, numberRows_);
+  delete[] choleskyRow_;
+  choleskyRow_ = ClpCopyOfArray(cache.choleskyRow_, sizeIndex_);
+  delete[] clique_;
+  clique_ = ClpCopyOfArray(cache.clique_, numberRows_);
+  delete[] link_;
+  link_ = new int[numberRows_];
+  delete[] workInteger_;
+  workInteger_ = new int[numberRows_];
+  delete[] whichDense_;
+  delete[] denseColumn_;
+  delete dense_;
+  whichDense_ = NULL;
+  denseColumn_ = NULL;
+  dense_ = NULL;
+  if (cache.whichDense_) {
+    int numberColumns = cache.numberColumns_;
+    whichDense_ = ClpCopyOfArray(cache.whichDense_, numberColumns);
+    int numberDense = 0;
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      if (whichDense_[iColumn])
+        numberDense++;
+    }
+    // space for dense columns
+    denseColumn_ = new longDouble[numberDense * numberRows_];
+    // dense cholesky
+    dense_ = new ClpCholeskyDense();
+    dense_->reserveSpace(NULL, numberDense);
+  }
+  delete[] sparseFactor_;
+  sparseFactor_ = new longDouble[sizeFactor_];
+  delete[] workDouble_;
+#if CLP_LONG_CHOLESKY != 1
+  workDouble_ = new longDouble[numberRows_];
+#else
+  // actually long double
+  workDouble_ = reinterpret_cast< double * >(new CoinWorkDouble[numberRows_]);
+#endif
+  delete[] diagonal_;
+  diagonal_ = new longDouble[numberRows_];
+  findSubtrees();
+  symbolicVersion_ = cache.version_;
+}
+/* Uses factorization to solve for several regions at once.
+   Blocks of regions go to threads.  Arithmetic for each region is
+   same as serial type 3 solve so results do not depend on threads.
+*/
+void ClpCholeskyBase::solveMultiple(CoinWorkDouble **regions, int numberRegions)
+{
+  if (type_ || doKKT_ || whichDense_ || numberRegions < 2) {
+    // not default factorization (or dense columns) - one at a time
+    for (int iRegion = 0; iRegion < numberRegions; iRegion++)
+      solve(regions[iRegion]);
+    return;
+  }
+  int numberBlocks = (numberRegions + CLP_SOLVE_BLOCK - 1) / CLP_SOLVE_BLOCK;
+  double totalWork = static_cast< double >(choleskyStart_[numberRows_]) * numberRegions;
+  int numberChunks = totalWork > CLP_SUBTREE_WORK ? 0 : 1;
+  clpParallelFor(0, numberBlocks, 1, [=](int firstBlock, int lastBlock) {
+    CoinWorkDouble *work = new CoinWorkDouble[CLP_SOLVE_BLOCK * numberRows_];
+    for (int iBlock = firstBlock; iBlock < lastBlock; iBlock++) {
+      int first = iBlock * CLP_SOLVE_BLOCK;
+      int number = CoinMin(CLP_SOLVE_BLOCK, numberRegions - first);
+      solveBlock(regions + first, number, work);
+    }
+    delete[] work;
+  },
+    numberChunks);
+}
+/* Solve type 3 for a block of regions.  work is stored with regions
+   interleaved so each element of factor is used for all of them.
+*/
+void ClpCholeskyBase::solveBlock(CoinWorkDouble **regions, int numberRegions,
+  CoinWorkDouble *work)
+{
+  int i;
+  int k;
+  CoinBigIndex j;
+  for (i = 0; i < numberRows_; i++) {
+    int iRow = permute_[i];
+    for (k = 0; k < numberRegions; k++)
+      work[i * numberRegions + k] = regions[k][iRow];
+  }
+  for (i = 0; i < firstDense_; i++) {
+    int offset = indexStart_[i] - choleskyStart_[i];
+    const CoinWorkDouble *value = work + i * numberRegions;
+    for (j = choleskyStart_[i]; j < choleskyStart_[i + 1]; j++) {
+      int iRow = choleskyRow_[j + offset];
+      CoinWorkDouble element = sparseFactor_[j];
+      CoinWorkDouble *put = work + iRow * numberRegions;
+      for (k = 0; k < numberRegions; k++)
+        put[k] -= element * value[k];
+    }
+  }
+  if (firstDense_ < numberRows_) {
+    // do dense one region at a time
+    ClpCholeskyDense dense;
+    // just borrow space
+    int nDense = numberRows_ - firstDense_;
+    dense.reserveSpace(this, nDense);
+    CoinWorkDouble *denseRegion = new CoinWorkDouble[nDense];
+    for (k = 0; k < numberRegions; k++) {
+      for (i = 0; i < nDense; i++)
+        denseRegion[i] = work[(i + firstDense_) * numberRegions + k];
+      dense.solve(denseRegion);
+      for (i = 0; i < nDense; i++) {
+        work[(i + firstDense_) * numberRegions + k] = denseRegion[i];
+        regions[k][permute_[i + firstDense_]] = denseRegion[i];
+      }
+    }
+    delete[] denseRegion;
+  }
+  CoinWorkDouble value[CLP_SOLVE_BLOCK];
+  for (i = firstDense_ - 1; i >= 0; i--) {
+    int offset = indexStart_[i] - choleskyStart_[i];
+    CoinWorkDouble *get = work + i * numberRegions;
+    for (k = 0; k < numberRegions; k++)
+      value[k] = get[k] * diagonal_[i];
+    for (j = choleskyStart_[i]; j < choleskyStart_[i + 1]; j++) {
+      int iRow = choleskyRow_[j + offset];
+      CoinWorkDouble element = sparseFactor_[j];
+      const CoinWorkDouble *other = work + iRow * numberRegions;
+      for (k = 0; k < numberRegions; k++)
+        value[k] -= element * other[k];
+    }
+    int iRow = permute_[i];
+    for (k = 0; k < numberRegions; k++) {
+      get[k] = value[k];
+      regions[k][iRow] = value[k];
+    }
+  }
+}
 #if 0 //CLP_LONG_CHOLESKY
 /* Uses factorization to solve. */
 void
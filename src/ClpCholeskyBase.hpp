@@ -42,7 +42,9 @@ typedef double longDouble;
 #endif
 class ClpInterior;
 class ClpCholeskyDense;
+class ClpCholeskySymbolic;
 class ClpMatrixBase;
+class CoinPackedMatrix;
 
 /** Base class for Clp Cholesky factorization
     Will do better factorization.  very crude ordering
@@ -76,6 +78,16 @@ public:
       region1 is rows+columns, region2 is rows */
   virtual void solveKKT(CoinWorkDouble *region1, CoinWorkDouble *region2, const CoinWorkDouble *diagonal,
     CoinWorkDouble diagonalScaleFactor);
+  /** Uses factorization to solve for several regions at once.
+      Default sparse factorization reads factor once per block of
+      regions (and blocks may go to threads) - otherwise just calls solve.
+      Each region gets same result as from solve done serially. */
+  virtual void solveMultiple(CoinWorkDouble **regions, int numberRegions);
+  /** If order and symbolic have already been done for a matrix with
+      same sparsity pattern (as when re-solving after changing values),
+      here or in symbolic cache, then refreshes values and returns true
+      so they can be skipped */
+  virtual bool reuseSymbolic(ClpInterior *model);
 
 private:
   /// AMD ordering
@@ -158,6 +170,24 @@ public:
   {
     doKKT_ = yesNo;
   }
+  /// Number of independent subtrees found by symbolic (0 if not split)
+  inline int numberSubtrees() const
+  {
+    return numberSubtrees_;
+  }
+  /** Symbolic cache (not owned).  If set, symbolic is taken from it
+      when pattern matches and it is refilled after a new symbolic.
+      If not set a private one is used so a re-solve of same
+      pattern can still skip order and symbolic. */
+  inline ClpCholeskySymbolic *symbolicCache() const
+  {
+    return symbolicCache_;
+  }
+  inline void setSymbolicCache(ClpCholeskySymbolic *cache)
+  {
+    symbolicCache_ = cache;
+    symbolicVersion_ = 0;
+  }
   /// Set integer parameter
   inline void setIntegerParameter(int i, int value)
   {
@@ -245,6 +275,33 @@ protected:
   int preOrder(bool lowerTriangular, bool includeDiagonal, bool doKKT);
   /// Updates dense part (broken out for profiling)
   void updateDense(longDouble *d, /*longDouble * work,*/ int *first);
+  /// Updates dense rows firstRow to lastRow-1
+  void updateDense(longDouble *d, int *first, int firstRow, int lastRow);
+  /** Factorizes rows (in increasing order, NULL means 0 to numberList-1)
+      for factorizePart2.  If owner then links to rows not in subtree
+      whichSubtree are saved in deferred.
+  */
+  void factorizeRows(const int *rows, int numberList,
+    const int *owner, int whichSubtree, longDouble *d, longDouble *work,
+    int *first, int *rowsDropped, int *deferred, int &numberDeferred,
+    CoinWorkDouble &largest, CoinWorkDouble &smallest, int &numberDropped);
+  /// Fingerprint of sparsity pattern which order and symbolic depend on
+  CoinUInt64 patternFingerprint(const ClpInterior *model) const;
+  /// Quadratic objective if KKT (NULL if not)
+  const CoinPackedMatrix *kktQuadratic(const ClpInterior *model) const;
+  /// True if cache has symbolic for exactly this pattern and options
+  bool samePattern(const ClpCholeskySymbolic &cache, const ClpInterior *model) const;
+  /// Saves symbolic information (and pattern) in cache
+  void saveSymbolic(ClpCholeskySymbolic &cache);
+  /// Takes symbolic information from cache (pattern must match)
+  void restoreSymbolic(ClpInterior *model, const ClpCholeskySymbolic &cache);
+  /// Finds independent subtrees for parallel factorization and solve
+  void findSubtrees();
+  /// Solve type 3 with subtrees in parallel
+  void solveSubtrees(CoinWorkDouble *work, CoinWorkDouble *region);
+  /** Solve type 3 for a block of regions sharing one pass over factor.
+      (at most CLP_SOLVE_BLOCK) - work has numberRegions*numberRows_ entries */
+  void solveBlock(CoinWorkDouble **regions, int numberRegions, CoinWorkDouble *work);
   //@}
 
 protected:
@@ -313,6 +370,20 @@ protected:
   ClpCholeskyDense *dense_;
   /// Dense threshold (for taking out of Cholesky)
   int denseThreshold_;
+  /// Number of independent subtrees (0 if not split)
+  int numberSubtrees_;
+  /// Size of subtree_
+  int sizeSubtree_;
+  /** Subtree information - starts of rows in each subtree (last is rest),
+      rows, subtree of each row and starts and rows of elements outside
+      their subtree */
+  int *subtree_;
+  /// Symbolic cache (not owned)
+  ClpCholeskySymbolic *symbolicCache_;
+  /// Own symbolic cache (used if symbolicCache_ NULL)
+  ClpCholeskySymbolic *ownSymbolic_;
+  /// Version of cache arrays here came from (0 if none)
+  unsigned int symbolicVersion_;
   //@}
 };
 
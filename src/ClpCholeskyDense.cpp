@@ -15,13 +15,19 @@
 #if CLP_HAS_ABC
 #include "CoinAbcCommon.hpp"
 #endif
-#if CLP_HAS_ABC < 3
-#undef cilk_for
-#undef cilk_spawn
-#undef cilk_sync
-#define cilk_for for
-#define cilk_spawn
-#define cilk_sync
+#include "ClpThreadPool.hpp"
+#include "ClpSimdKernels.hpp"
+/* Leaf rectangle update can use AVX512 if compiled for it, otherwise
+   AVX2 (and FMA) chosen at run time as in ClpSimdKernels - only if
+   longDouble is double */
+#if CLP_LONG_CHOLESKY < 2 && !defined(COIN_LONG_WORK)
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#define CLP_CHOLESKY_AVX512
+#elif CLP_SIMD_DISPATCH
+#include <immintrin.h>
+#define CLP_CHOLESKY_AVX2
+#endif
 #endif
 
 /*#############################################################################*/
@@ -93,6 +99,22 @@ ClpCholeskyBase *ClpCholeskyDense::clone() const
 #define number_blocks(x) (((x) + BLOCK - 1) >> BLOCKSHIFT)
 #define number_rows(x) ((x) << BLOCKSHIFT)
 #define number_entries(x) ((x) << BLOCKSQSHIFT)
+/* Recursive splits are done as tasks if at least this much work
+   (rows*rows*rows) - otherwise the task is not worth it */
+#ifndef CHOLESKY_TASK_WORK
+#define CHOLESKY_TASK_WORK (4 * BLOCK * 4 * BLOCK * 4 * BLOCK)
+#endif
+/* Run both - first as a task if worth it */
+template < class First, class Second >
+static inline void choleskyInvoke(double work, First first, Second second)
+{
+  if (work >= CHOLESKY_TASK_WORK) {
+    clpParallelInvoke(first, second);
+  } else {
+    first();
+    second();
+  }
+}
 /* Gets space */
 int ClpCholeskyDense::reserveSpace(const ClpCholeskyBase *factor, int numberRows)
 {
@@ -701,10 +723,15 @@ void ClpCholeskyCtriRec(ClpCholeskyDenseC *thisStruct, longDouble *aTri, int nTh
   } else if (nThis < nLeft) {
     int nb = number_blocks((nLeft + 1) >> 1);
     int nLeft2 = number_rows(nb);
-    cilk_spawn ClpCholeskyCtriRec(thisStruct, aTri, nThis, aUnder, diagonal, work, nLeft2, iBlock, jBlock, numberBlocks);
-    ClpCholeskyCtriRec(thisStruct, aTri, nThis, aUnder + number_entries(nb), diagonal, work, nLeft - nLeft2,
-      iBlock + nb, jBlock, numberBlocks);
-    cilk_sync;
+    /* two halves of aUnder are independent */
+    choleskyInvoke(static_cast< double >(nThis) * nThis * nLeft,
+      [=]() {
+        ClpCholeskyCtriRec(thisStruct, aTri, nThis, aUnder, diagonal, work, nLeft2, iBlock, jBlock, numberBlocks);
+      },
+      [=]() {
+        ClpCholeskyCtriRec(thisStruct, aTri, nThis, aUnder + number_entries(nb), diagonal, work, nLeft - nLeft2,
+          iBlock + nb, jBlock, numberBlocks);
+      });
   } else {
     int nb = number_blocks((nThis + 1) >> 1);
     int nThis2 = number_rows(nb);
@@ -747,15 +774,20 @@ void ClpCholeskyCrecTri(ClpCholeskyDenseC *thisStruct, longDouble *aUnder, int n
     int nTri2 = number_rows(nb);
     longDouble *aother;
     int i;
-    cilk_spawn ClpCholeskyCrecTri(thisStruct, aUnder, nTri2, nDo, iBlock, jBlock, aTri, diagonal, work, numberBlocks);
     /* and rectangular update */
     i = ((numberBlocks - iBlock) * (numberBlocks - iBlock + 1) - (numberBlocks - iBlock - nb) * (numberBlocks - iBlock - nb + 1)) >> 1;
     aother = aTri + number_entries(nb);
-    ClpCholeskyCrecRec(thisStruct, aUnder, nTri2, nTri - nTri2, nDo, aUnder + number_entries(nb), aother,
-      work, iBlock, jBlock, numberBlocks);
-    ClpCholeskyCrecTri(thisStruct, aUnder + number_entries(nb), nTri - nTri2, nDo, iBlock + nb, jBlock,
-      aTri + number_entries(i), diagonal, work, numberBlocks);
-    cilk_sync;
+    /* top triangle is independent of rest of aTri */
+    choleskyInvoke(static_cast< double >(nTri) * nTri * nDo,
+      [=]() {
+        ClpCholeskyCrecTri(thisStruct, aUnder, nTri2, nDo, iBlock, jBlock, aTri, diagonal, work, numberBlocks);
+      },
+      [=]() {
+        ClpCholeskyCrecRec(thisStruct, aUnder, nTri2, nTri - nTri2, nDo, aUnder + number_entries(nb), aother,
+          work, iBlock, jBlock, numberBlocks);
+        ClpCholeskyCrecTri(thisStruct, aUnder + number_entries(nb), nTri - nTri2, nDo, iBlock + nb, jBlock,
+          aTri + number_entries(i), diagonal, work, numberBlocks);
+      });
   }
 }
 /* Non leaf recursive rectangle rectangle update,
@@ -774,11 +806,15 @@ void ClpCholeskyCrecRec(ClpCholeskyDenseC *thisStruct, longDouble *above, int nU
   } else if (nDo <= nUnderK && nUnder <= nUnderK) {
     int nb = number_blocks((nUnderK + 1) >> 1);
     int nUnder2 = number_rows(nb);
-    cilk_spawn ClpCholeskyCrecRec(thisStruct, above, nUnder, nUnder2, nDo, aUnder, aOther, work,
-      iBlock, jBlock, numberBlocks);
-    ClpCholeskyCrecRec(thisStruct, above, nUnder, nUnderK - nUnder2, nDo, aUnder + number_entries(nb),
-      aOther + number_entries(nb), work, iBlock, jBlock, numberBlocks);
-    cilk_sync;
+    choleskyInvoke(static_cast< double >(nUnder) * nUnderK * nDo,
+      [=]() {
+        ClpCholeskyCrecRec(thisStruct, above, nUnder, nUnder2, nDo, aUnder, aOther, work,
+          iBlock, jBlock, numberBlocks);
+      },
+      [=]() {
+        ClpCholeskyCrecRec(thisStruct, above, nUnder, nUnderK - nUnder2, nDo, aUnder + number_entries(nb),
+          aOther + number_entries(nb), work, iBlock, jBlock, numberBlocks);
+      });
   } else if (nUnderK <= nDo && nUnder <= nDo) {
     int nb = number_blocks((nDo + 1) >> 1);
     int nDo2 = number_rows(nb);
@@ -794,12 +830,16 @@ void ClpCholeskyCrecRec(ClpCholeskyDenseC *thisStruct, longDouble *above, int nU
     int nb = number_blocks((nUnder + 1) >> 1);
     int nUnder2 = number_rows(nb);
     int i;
-    cilk_spawn ClpCholeskyCrecRec(thisStruct, above, nUnder2, nUnderK, nDo, aUnder, aOther, work,
-      iBlock, jBlock, numberBlocks);
     i = ((numberBlocks - iBlock) * (numberBlocks - iBlock - 1) - (numberBlocks - iBlock - nb) * (numberBlocks - iBlock - nb - 1)) >> 1;
-    ClpCholeskyCrecRec(thisStruct, above + number_entries(nb), nUnder - nUnder2, nUnderK, nDo, aUnder,
-      aOther + number_entries(i), work, iBlock + nb, jBlock, numberBlocks);
-    cilk_sync;
+    choleskyInvoke(static_cast< double >(nUnder) * nUnderK * nDo,
+      [=]() {
+        ClpCholeskyCrecRec(thisStruct, above, nUnder2, nUnderK, nDo, aUnder, aOther, work,
+          iBlock, jBlock, numberBlocks);
+      },
+      [=]() {
+        ClpCholeskyCrecRec(thisStruct, above + number_entries(nb), nUnder - nUnder2, nUnderK, nDo, aUnder,
+          aOther + number_entries(i), work, iBlock + nb, jBlock, numberBlocks);
+      });
   }
 }
 /* Leaf recursive factor*/
@@ -1024,6 +1064,74 @@ void ClpCholeskyCrecTriLeaf(/*ClpCholeskyDenseC * thisStruct,*/ longDouble *aUnd
   }
 #endif
 }
+#ifdef CLP_CHOLESKY_AVX2
+// 1 if AVX2 and FMA there and vector kernels wanted (see ClpSimdKernels)
+static int clpCholeskyFma()
+{
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("fma") ? 1 : 0;
+}
+static int clpCholeskyAvx2()
+{
+  // leaf tasks get here at once - initialization of local static is safe
+  static const int fmaAvailable = clpCholeskyFma();
+  if (clpSimdLevel() < CLP_SIMD_AVX2)
+    return 0;
+  return fmaAvailable;
+}
+/* Full BLOCK by BLOCK leaf of ClpCholeskyCrecRecLeaf - tiles of 2
+   vectors by 4 columns kept in registers */
+__attribute__((target("avx2,fma"))) static void clpCholeskyRecRecLeafAvx2(const longDouble *COIN_RESTRICT above,
+  const longDouble *COIN_RESTRICT aUnder,
+  longDouble *COIN_RESTRICT aOther,
+  const longDouble *COIN_RESTRICT work)
+{
+  longDouble *aa = aOther - 4 * BLOCK;
+  for (int j = 0; j < BLOCK; j += 4) {
+    aa += 4 * BLOCK;
+    for (int i = 0; i < BLOCK; i += 8) {
+      longDouble *COIN_RESTRICT aaNow = aa + i;
+      __m256d t00 = _mm256_loadu_pd(aaNow + 0 * BLOCK);
+      __m256d t01 = _mm256_loadu_pd(aaNow + 0 * BLOCK + 4);
+      __m256d t10 = _mm256_loadu_pd(aaNow + 1 * BLOCK);
+      __m256d t11 = _mm256_loadu_pd(aaNow + 1 * BLOCK + 4);
+      __m256d t20 = _mm256_loadu_pd(aaNow + 2 * BLOCK);
+      __m256d t21 = _mm256_loadu_pd(aaNow + 2 * BLOCK + 4);
+      __m256d t30 = _mm256_loadu_pd(aaNow + 3 * BLOCK);
+      __m256d t31 = _mm256_loadu_pd(aaNow + 3 * BLOCK + 4);
+      const longDouble *COIN_RESTRICT aUnderNow = aUnder + i;
+      const longDouble *COIN_RESTRICT aboveNow = above + j;
+      for (int k = 0; k < BLOCK; k++) {
+        __m256d multiplier = _mm256_set1_pd(work[k]);
+        __m256d a0 = _mm256_mul_pd(_mm256_loadu_pd(aUnderNow), multiplier);
+        __m256d a1 = _mm256_mul_pd(_mm256_loadu_pd(aUnderNow + 4), multiplier);
+        __m256d b = _mm256_set1_pd(aboveNow[0]);
+        t00 = _mm256_fnmadd_pd(a0, b, t00);
+        t01 = _mm256_fnmadd_pd(a1, b, t01);
+        b = _mm256_set1_pd(aboveNow[1]);
+        t10 = _mm256_fnmadd_pd(a0, b, t10);
+        t11 = _mm256_fnmadd_pd(a1, b, t11);
+        b = _mm256_set1_pd(aboveNow[2]);
+        t20 = _mm256_fnmadd_pd(a0, b, t20);
+        t21 = _mm256_fnmadd_pd(a1, b, t21);
+        b = _mm256_set1_pd(aboveNow[3]);
+        t30 = _mm256_fnmadd_pd(a0, b, t30);
+        t31 = _mm256_fnmadd_pd(a1, b, t31);
+        aUnderNow += BLOCK;
+        aboveNow += BLOCK;
+      }
+      _mm256_storeu_pd(aaNow + 0 * BLOCK, t00);
+      _mm256_storeu_pd(aaNow + 0 * BLOCK + 4, t01);
+      _mm256_storeu_pd(aaNow + 1 * BLOCK, t10);
+      _mm256_storeu_pd(aaNow + 1 * BLOCK + 4, t11);
+      _mm256_storeu_pd(aaNow + 2 * BLOCK, t20);
+      _mm256_storeu_pd(aaNow + 2 * BLOCK + 4, t21);
+      _mm256_storeu_pd(aaNow + 3 * BLOCK, t30);
+      _mm256_storeu_pd(aaNow + 3 * BLOCK + 4, t31);
+    }
+  }
+}
+#endif
 /* Leaf recursive rectangle rectangle update,
    nUnder is number of rows in iBlock,
    nUnderK is number of rows in kBlock
@@ -1076,7 +1184,58 @@ void ClpCholeskyCrecRecLeaf(/*ClpCholeskyDenseC * thisStruct,*/
         aa[i + 1 + 1 * BLOCK] = t11;
       }
     }
+#elif defined(CLP_CHOLESKY_AVX512)
+    /* tiles of 2 vectors by 4 columns kept in registers */
+    for (j = 0; j < BLOCK; j += 4) {
+      aa += 4 * BLOCK;
+      for (i = 0; i < BLOCK; i += 16) {
+        longDouble *COIN_RESTRICT aaNow = aa + i;
+        __m512d t00 = _mm512_loadu_pd(aaNow + 0 * BLOCK);
+        __m512d t01 = _mm512_loadu_pd(aaNow + 0 * BLOCK + 8);
+        __m512d t10 = _mm512_loadu_pd(aaNow + 1 * BLOCK);
+        __m512d t11 = _mm512_loadu_pd(aaNow + 1 * BLOCK + 8);
+        __m512d t20 = _mm512_loadu_pd(aaNow + 2 * BLOCK);
+        __m512d t21 = _mm512_loadu_pd(aaNow + 2 * BLOCK + 8);
+        __m512d t30 = _mm512_loadu_pd(aaNow + 3 * BLOCK);
+        __m512d t31 = _mm512_loadu_pd(aaNow + 3 * BLOCK + 8);
+        const longDouble *COIN_RESTRICT aUnderNow = aUnder + i;
+        const longDouble *COIN_RESTRICT aboveNow = above + j;
+        for (k = 0; k < BLOCK; k++) {
+          __m512d multiplier = _mm512_set1_pd(work[k]);
+          __m512d a0 = _mm512_mul_pd(_mm512_loadu_pd(aUnderNow), multiplier);
+          __m512d a1 = _mm512_mul_pd(_mm512_loadu_pd(aUnderNow + 8), multiplier);
+          __m512d b = _mm512_set1_pd(aboveNow[0]);
+          t00 = _mm512_fnmadd_pd(a0, b, t00);
+          t01 = _mm512_fnmadd_pd(a1, b, t01);
+          b = _mm512_set1_pd(aboveNow[1]);
+          t10 = _mm512_fnmadd_pd(a0, b, t10);
+          t11 = _mm512_fnmadd_pd(a1, b, t11);
+          b = _mm512_set1_pd(aboveNow[2]);
+          t20 = _mm512_fnmadd_pd(a0, b, t20);
+          t21 = _mm512_fnmadd_pd(a1, b, t21);
+          b = _mm512_set1_pd(aboveNow[3]);
+          t30 = _mm512_fnmadd_pd(a0, b, t30);
+          t31 = _mm512_fnmadd_pd(a1, b, t31);
+          aUnderNow += BLOCK;
+          aboveNow += BLOCK;
+        }
+        _mm512_storeu_pd(aaNow + 0 * BLOCK, t00);
+        _mm512_storeu_pd(aaNow + 0 * BLOCK + 8, t01);
+        _mm512_storeu_pd(aaNow + 1 * BLOCK, t10);
+        _mm512_storeu_pd(aaNow + 1 * BLOCK + 8, t11);
+        _mm512_storeu_pd(aaNow + 2 * BLOCK, t20);
+        _mm512_storeu_pd(aaNow + 2 * BLOCK + 8, t21);
+        _mm512_storeu_pd(aaNow + 3 * BLOCK, t30);
+        _mm512_storeu_pd(aaNow + 3 * BLOCK + 8, t31);
+      }
+    }
 #else
+#ifdef CLP_CHOLESKY_AVX2
+    if (clpCholeskyAvx2()) {
+      clpCholeskyRecRecLeafAvx2(above, aUnder, aOther, work);
+      return;
+    }
+#endif
     for (j = 0; j < BLOCK; j += 4) {
       aa += 4 * BLOCK;
       for (i = 0; i < BLOCK; i += 4) {
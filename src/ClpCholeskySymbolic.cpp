@@ -0,0 +1,324 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "CoinHelperFunctions.hpp"
+#include "ClpModelParameters.hpp"
+#include "ClpCholeskySymbolic.hpp"
+
+// Start of file
+static const char clpSymbolicMagic[8] = { 'C', 'l', 'p', 'S', 'y', 'm', 'b', '2' };
+typedef struct {
+  char magic[8];
+  CoinUInt64 fingerprint;
+  int sizeofBigIndex;
+  int numberRows;
+  int numberModelRows;
+  int numberColumns;
+  int kkt;
+  int denseThreshold;
+  int havePattern;
+  int haveQuadratic;
+  int sizeFactor;
+  int sizeIndex;
+  int firstDense;
+  int haveDense;
+} ClpSymbolicHeader;
+
+ClpCholeskySymbolic::ClpCholeskySymbolic()
+  : fingerprint_(0)
+  , version_(1)
+  , numberRows_(0)
+  , numberModelRows_(0)
+  , numberColumns_(0)
+  , kkt_(0)
+  , denseThreshold_(0)
+  , patternStart_(NULL)
+  , patternRow_(NULL)
+  , quadraticStart_(NULL)
+  , quadraticRow_(NULL)
+  , sizeFactor_(0)
+  , sizeIndex_(0)
+  , firstDense_(0)
+  , permute_(NULL)
+  , choleskyStart_(NULL)
+  , indexStart_(NULL)
+  , choleskyRow_(NULL)
+  , clique_(NULL)
+  , whichDense_(NULL)
+{
+}
+
+ClpCholeskySymbolic::ClpCholeskySymbolic(const ClpCholeskySymbolic &rhs)
+  : version_(1)
+{
+  gutsOfCopy(rhs);
+}
+
+ClpCholeskySymbolic &
+ClpCholeskySymbolic::operator=(const ClpCholeskySymbolic &rhs)
+{
+  if (this != &rhs) {
+    clear();
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+
+ClpCholeskySymbolic::~ClpCholeskySymbolic()
+{
+  clear();
+}
+
+void ClpCholeskySymbolic::gutsOfCopy(const ClpCholeskySymbolic &rhs)
+{
+  fingerprint_ = rhs.fingerprint_;
+  numberRows_ = rhs.numberRows_;
+  numberModelRows_ = rhs.numberModelRows_;
+  numberColumns_ = rhs.numberColumns_;
+  kkt_ = rhs.kkt_;
+  denseThreshold_ = rhs.denseThreshold_;
+  patternStart_ = ClpCopyOfArray(rhs.patternStart_, numberColumns_ + 1);
+  patternRow_ = rhs.patternStart_ ? ClpCopyOfArray(rhs.patternRow_, rhs.patternStart_[numberColumns_]) : NULL;
+  quadraticStart_ = ClpCopyOfArray(rhs.quadraticStart_, numberColumns_ + 1);
+  quadraticRow_ = rhs.quadraticStart_ ? ClpCopyOfArray(rhs.quadraticRow_, rhs.quadraticStart_[numberColumns_]) : NULL;
+  sizeFactor_ = rhs.sizeFactor_;
+  sizeIndex_ = rhs.sizeIndex_;
+  firstDense_ = rhs.firstDense_;
+  permute_ = ClpCopyOfArray(rhs.permute_, numberRows_);
+  choleskyStart_ = ClpCopyOfArray(rhs.choleskyStart_, numberRows_ + 1);
+  indexStart_ = ClpCopyOfArray(rhs.indexStart_, numberRows_);
+  choleskyRow_ = ClpCopyOfArray(rhs.choleskyRow_, sizeIndex_);
+  clique_ = ClpCopyOfArray(rhs.clique_, numberRows_);
+  whichDense_ = ClpCopyOfArray(rhs.whichDense_, numberColumns_);
+}
+
+void ClpCholeskySymbolic::clear()
+{
+  delete[] patternStart_;
+  patternStart_ = NULL;
+  delete[] patternRow_;
+  patternRow_ = NULL;
+  delete[] quadraticStart_;
+  quadraticStart_ = NULL;
+  delete[] quadraticRow_;
+  quadraticRow_ = NULL;
+  delete[] permute_;
+  permute_ = NULL;
+  delete[] choleskyStart_;
+  choleskyStart_ = NULL;
+  delete[] indexStart_;
+  indexStart_ = NULL;
+  delete[] choleskyRow_;
+  choleskyRow_ = NULL;
+  delete[] clique_;
+  clique_ = NULL;
+  delete[] whichDense_;
+  whichDense_ = NULL;
+  fingerprint_ = 0;
+  // so factorizations know arrays they took from here are gone
+  version_++;
+  if (!version_)
+    version_ = 1;
+  numberRows_ = 0;
+  numberModelRows_ = 0;
+  numberColumns_ = 0;
+  kkt_ = 0;
+  denseThreshold_ = 0;
+  sizeFactor_ = 0;
+  sizeIndex_ = 0;
+  firstDense_ = 0;
+}
+// Parent of permuted row in elimination tree (-1 if root)
+int ClpCholeskySymbolic::parent(int iRow) const
+{
+  if (choleskyStart_[iRow + 1] > choleskyStart_[iRow])
+    return static_cast< int >(choleskyRow_[indexStart_[iRow]]);
+  else
+    return -1;
+}
+// Writes pattern (starts then indices) - returns true if okay
+static bool clpWritePattern(FILE *fp, int numberColumns, const CoinBigIndex *start,
+  const int *index)
+{
+  size_t n = numberColumns + 1;
+  if (fwrite(start, sizeof(CoinBigIndex), n, fp) != n)
+    return false;
+  n = start[numberColumns];
+  return !n || fwrite(index, sizeof(int), n, fp) == n;
+}
+/* Reads pattern written by clpWritePattern - returns true if okay and
+   starts go up from 0 and indices are less than numberRows */
+static bool clpReadPattern(FILE *fp, int numberColumns, int numberRows,
+  CoinBigIndex *&start, int *&index)
+{
+  size_t n = numberColumns + 1;
+  start = new CoinBigIndex[n];
+  if (fread(start, sizeof(CoinBigIndex), n, fp) != n || start[0])
+    return false;
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    if (start[iColumn + 1] < start[iColumn])
+      return false;
+  }
+  n = start[numberColumns];
+  index = new int[CoinMax(static_cast< CoinBigIndex >(n), static_cast< CoinBigIndex >(1))];
+  if (n && fread(index, sizeof(int), n, fp) != n)
+    return false;
+  for (size_t j = 0; j < n; j++) {
+    if (index[j] < 0 || index[j] >= numberRows)
+      return false;
+  }
+  return true;
+}
+// Writes to binary file - returns 0 if okay
+int ClpCholeskySymbolic::writeFile(const char *fileName) const
+{
+  FILE *fp = fopen(fileName, "wb");
+  if (!fp)
+    return 1;
+  ClpSymbolicHeader header;
+  memset(&header, 0, sizeof(ClpSymbolicHeader));
+  memcpy(header.magic, clpSymbolicMagic, sizeof(clpSymbolicMagic));
+  header.fingerprint = fingerprint_;
+  header.sizeofBigIndex = static_cast< int >(sizeof(CoinBigIndex));
+  header.numberRows = numberRows_;
+  header.numberModelRows = numberModelRows_;
+  header.numberColumns = numberColumns_;
+  header.kkt = kkt_;
+  header.denseThreshold = denseThreshold_;
+  header.havePattern = patternStart_ ? 1 : 0;
+  header.haveQuadratic = quadraticStart_ ? 1 : 0;
+  header.sizeFactor = sizeFactor_;
+  header.sizeIndex = sizeIndex_;
+  header.firstDense = firstDense_;
+  header.haveDense = whichDense_ ? 1 : 0;
+  bool good = fwrite(&header, sizeof(ClpSymbolicHeader), 1, fp) == 1;
+  if (good && patternStart_)
+    good = clpWritePattern(fp, numberColumns_, patternStart_, patternRow_);
+  if (good && quadraticStart_)
+    good = clpWritePattern(fp, numberColumns_, quadraticStart_, quadraticRow_);
+  if (good && numberRows_) {
+    size_t n = numberRows_;
+    good = fwrite(permute_, sizeof(CoinBigIndex), n, fp) == n
+      && fwrite(choleskyStart_, sizeof(CoinBigIndex), n + 1, fp) == n + 1
+      && fwrite(indexStart_, sizeof(int), n, fp) == n
+      && fwrite(clique_, sizeof(int), n, fp) == n;
+    n = sizeIndex_;
+    if (good && n)
+      good = fwrite(choleskyRow_, sizeof(CoinBigIndex), n, fp) == n;
+    n = numberColumns_;
+    if (good && whichDense_ && n)
+      good = fwrite(whichDense_, 1, n, fp) == n;
+  }
+  if (fclose(fp))
+    good = false;
+  return good ? 0 : 1;
+}
+/* True if arrays describe a possible factor - so a damaged file can
+   not make ClpCholeskyBase go outside its arrays */
+bool ClpCholeskySymbolic::checkArrays() const
+{
+  if (firstDense_ < 0 || firstDense_ > numberRows_ || sizeFactor_ < 0)
+    return false;
+  if (!numberRows_)
+    return true;
+  // permutation
+  char *seen = new char[numberRows_];
+  memset(seen, 0, numberRows_);
+  bool good = true;
+  int iRow;
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    CoinBigIndex jRow = permute_[iRow];
+    if (jRow < 0 || jRow >= numberRows_ || seen[jRow]) {
+      good = false;
+      break;
+    }
+    seen[jRow] = 1;
+  }
+  delete[] seen;
+  if (!good || choleskyStart_[0])
+    return false;
+  for (iRow = 0; iRow < numberRows_; iRow++) {
+    CoinBigIndex nz = choleskyStart_[iRow + 1] - choleskyStart_[iRow];
+    int start = indexStart_[iRow];
+    if (nz < 0 || start < 0 || start + nz > sizeIndex_
+      || clique_[iRow] < 0 || clique_[iRow] > numberRows_ - iRow)
+      return false;
+    // indices strictly increasing and below diagonal
+    CoinBigIndex last = iRow;
+    for (CoinBigIndex j = start; j < start + nz; j++) {
+      CoinBigIndex kRow = choleskyRow_[j];
+      if (kRow <= last || kRow >= numberRows_)
+        return false;
+      last = kRow;
+    }
+  }
+  return choleskyStart_[numberRows_] <= sizeFactor_;
+}
+// Reads from binary file
+int ClpCholeskySymbolic::readFile(const char *fileName)
+{
+  FILE *fp = fopen(fileName, "rb");
+  if (!fp)
+    return 1;
+  clear();
+  ClpSymbolicHeader header;
+  if (fread(&header, sizeof(ClpSymbolicHeader), 1, fp) != 1
+    || memcmp(header.magic, clpSymbolicMagic, sizeof(clpSymbolicMagic))
+    || header.sizeofBigIndex != static_cast< int >(sizeof(CoinBigIndex))
+    || header.numberRows < 0 || header.numberModelRows < 0
+    || header.numberColumns < 0 || header.sizeIndex < 0
+    || !header.havePattern) {
+    fclose(fp);
+    return 2;
+  }
+  numberRows_ = header.numberRows;
+  numberModelRows_ = header.numberModelRows;
+  numberColumns_ = header.numberColumns;
+  kkt_ = header.kkt;
+  denseThreshold_ = header.denseThreshold;
+  sizeFactor_ = header.sizeFactor;
+  sizeIndex_ = header.sizeIndex;
+  firstDense_ = header.firstDense;
+  bool good = clpReadPattern(fp, numberColumns_, numberModelRows_,
+    patternStart_, patternRow_);
+  if (good && header.haveQuadratic)
+    good = clpReadPattern(fp, numberColumns_, numberColumns_,
+      quadraticStart_, quadraticRow_);
+  if (good && numberRows_) {
+    size_t n = numberRows_;
+    permute_ = new CoinBigIndex[n];
+    choleskyStart_ = new CoinBigIndex[n + 1];
+    indexStart_ = new int[n];
+    clique_ = new int[n];
+    choleskyRow_ = new CoinBigIndex[CoinMax(sizeIndex_, 1)];
+    good = fread(permute_, sizeof(CoinBigIndex), n, fp) == n
+      && fread(choleskyStart_, sizeof(CoinBigIndex), n + 1, fp) == n + 1
+      && fread(indexStart_, sizeof(int), n, fp) == n
+      && fread(clique_, sizeof(int), n, fp) == n;
+    n = sizeIndex_;
+    if (good && n)
+      good = fread(choleskyRow_, sizeof(CoinBigIndex), n, fp) == n;
+    if (good && header.haveDense) {
+      n = numberColumns_;
+      whichDense_ = new char[CoinMax(numberColumns_, 1)];
+      if (n)
+        good = fread(whichDense_, 1, n, fp) == n;
+    }
+  }
+  fclose(fp);
+  if (!good || !checkArrays()) {
+    clear();
+    return 2;
+  }
+  // only now is it valid
+  fingerprint_ = header.fingerprint;
+  return 0;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,146 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef ClpCholeskySymbolic_H
+#define ClpCholeskySymbolic_H
+
+#include "ClpConfig.h"
+#include "CoinTypes.h"
+
+/** Symbolic Cholesky kept between barrier solves
+
+ClpCholeskyBase::order (AMD) and symbolic only depend on the pattern
+of ADA^T (or of the KKT matrix) so when a model is solved again with
+only values changed they can be skipped.  This holds what they produce
+for the native factorization - the permutation, the structure of L
+(starts and compressed row indices, from which the elimination tree
+follows as parent of a row is first row below diagonal in its column),
+the supernode (clique) partition and which columns were taken as dense.
+It also keeps that pattern and the options which affect it.  A model
+only uses the cache if sizes, options and pattern are all the same as
+when it was filled, otherwise symbolic is just redone and the cache
+refilled.  The fingerprint is only a summary of the pattern.
+ClpCholeskyBase uses a private cache in the same way when not given one.
+
+A cache is not owned by models or factorizations which use it (see
+ClpSimplex::setCholeskySymbolic and ClpCholeskyBase::setSymbolicCache).
+It can be written to and read from a binary file so the ordering can
+also be kept between runs.
+*/
+
+class CLPLIB_EXPORT ClpCholeskySymbolic {
+
+public:
+  /**@name Gets */
+  //@{
+  /// Fingerprint of pattern (0 if empty)
+  inline CoinUInt64 fingerprint() const
+  {
+    return fingerprint_;
+  }
+  /// Number of rows in factorization
+  inline int numberRows() const
+  {
+    return numberRows_;
+  }
+  /// Number of elements in L (including dense block)
+  inline int sizeFactor() const
+  {
+    return sizeFactor_;
+  }
+  /// Permutation - original row for each row of factorization
+  inline const CoinBigIndex *permutation() const
+  {
+    return permute_;
+  }
+  /// Supernode information - size of rest of clique (0 if not in one)
+  inline const int *clique() const
+  {
+    return clique_;
+  }
+  /// Parent of permuted row in elimination tree (-1 if root)
+  int parent(int iRow) const;
+  //@}
+
+  /**@name File */
+  //@{
+  /// Writes to binary file - returns 0 if okay
+  int writeFile(const char *fileName) const;
+  /** Reads from binary file - returns 0 if okay, 1 if can not open,
+      2 if not a symbolic file (or built with other CoinBigIndex) or
+      arrays are not consistent - then cache is left empty so symbolic
+      is done again */
+  int readFile(const char *fileName);
+  //@}
+
+  /**@name Constructors and destructor */
+  //@{
+  /// Default constructor (empty)
+  ClpCholeskySymbolic();
+  /// Copy constructor
+  ClpCholeskySymbolic(const ClpCholeskySymbolic &);
+  /// Assignment
+  ClpCholeskySymbolic &operator=(const ClpCholeskySymbolic &);
+  /// Destructor
+  ~ClpCholeskySymbolic();
+  /// Empties cache
+  void clear();
+  //@}
+
+private:
+  friend class ClpCholeskyBase;
+  /// Copies arrays from rhs
+  void gutsOfCopy(const ClpCholeskySymbolic &rhs);
+  /** True if arrays describe a possible factor - permutation,
+      monotonic starts and indices below diagonal inside arrays -
+      and a possible pattern */
+  bool checkArrays() const;
+  /**@name Data */
+  //@{
+  /// Fingerprint of pattern
+  CoinUInt64 fingerprint_;
+  /// Changed whenever contents change
+  unsigned int version_;
+  /// Number of rows in factorization
+  int numberRows_;
+  /// Number of rows in model
+  int numberModelRows_;
+  /// Number of columns in model (for dense indicators)
+  int numberColumns_;
+  /// 1 if KKT factorization
+  int kkt_;
+  /// Dense threshold used
+  int denseThreshold_;
+  /// Column starts of pattern of matrix
+  CoinBigIndex *patternStart_;
+  /// Row indices of pattern of matrix
+  int *patternRow_;
+  /// Column starts of pattern of quadratic objective (KKT only, or NULL)
+  CoinBigIndex *quadraticStart_;
+  /// Row indices of pattern of quadratic objective
+  int *quadraticRow_;
+  /// Size of factor
+  int sizeFactor_;
+  /// Size of index array
+  int sizeIndex_;
+  /// First dense row
+  int firstDense_;
+  /// Permutation
+  CoinBigIndex *permute_;
+  /// Starts of columns of L
+  CoinBigIndex *choleskyStart_;
+  /// Starts of indices of columns of L
+  int *indexStart_;
+  /// Compressed row indices of L
+  CoinBigIndex *choleskyRow_;
+  /// Clique (supernode) information
+  int *clique_;
+  /// Dense column indicators (or NULL)
+  char *whichDense_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
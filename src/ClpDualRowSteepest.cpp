@@ -9,6 +9,9 @@
 #include "ClpFactorization.hpp"
 #include "CoinHelperFunctions.hpp"
 #include <cstdio>
+#include <cmath>
+// Number of buckets for pivotRow (by binary exponent of infeasibility/weight)
+#define CLP_DUAL_ROW_BUCKETS 256
 //#############################################################################
 // Constructors / Destructor / Assignment
 //#############################################################################
@@ -26,6 +29,12 @@ ClpDualRowSteepest::ClpDualRowSteepest(int mode)
   , alternateWeights_(NULL)
   , savedWeights_(NULL)
   , dubiousWeights_(NULL)
+  , bucketOf_(NULL)
+  , bucketNext_(NULL)
+  , bucketPrevious_(NULL)
+  , bucketFirst_(NULL)
+  , topBucket_(-1)
+  , bucketMode_(2)
 {
   type_ = 2 + 64 * mode;
 }
@@ -40,6 +49,12 @@ ClpDualRowSteepest::ClpDualRowSteepest(const ClpDualRowSteepest &rhs)
   mode_ = rhs.mode_;
   persistence_ = rhs.persistence_;
   model_ = rhs.model_;
+  bucketOf_ = NULL;
+  bucketNext_ = NULL;
+  bucketPrevious_ = NULL;
+  bucketFirst_ = NULL;
+  topBucket_ = -1;
+  bucketMode_ = rhs.bucketMode_;
   if ((model_ && model_->whatsChanged() & 1) != 0) {
     int number = model_->numberRows();
     if (rhs.savedWeights_)
@@ -73,6 +88,8 @@ ClpDualRowSteepest::ClpDualRowSteepest(const ClpDualRowSteepest &rhs)
     } else {
       dubiousWeights_ = NULL;
     }
+    if (rhs.bucketOf_)
+      createBuckets();
   } else {
     infeasible_ = NULL;
     weights_ = NULL;
@@ -92,6 +109,7 @@ ClpDualRowSteepest::~ClpDualRowSteepest()
   delete infeasible_;
   delete alternateWeights_;
   delete savedWeights_;
+  deleteBuckets();
 }
 
 //----------------------------------------------------------------
@@ -106,11 +124,13 @@ ClpDualRowSteepest::operator=(const ClpDualRowSteepest &rhs)
     mode_ = rhs.mode_;
     persistence_ = rhs.persistence_;
     model_ = rhs.model_;
+    bucketMode_ = rhs.bucketMode_;
     delete[] weights_;
     delete[] dubiousWeights_;
     delete infeasible_;
     delete alternateWeights_;
     delete savedWeights_;
+    deleteBuckets();
     assert(model_);
     int number = model_->numberRows();
     if (rhs.savedWeights_)
@@ -144,6 +164,8 @@ ClpDualRowSteepest::operator=(const ClpDualRowSteepest &rhs)
     } else {
       dubiousWeights_ = NULL;
     }
+    if (rhs.bucketOf_)
+      createBuckets();
   }
   return *this;
 }
@@ -204,6 +226,88 @@ void ClpDualRowSteepest::fill(const ClpDualRowSteepest &rhs)
     delete[] dubiousWeights_;
     dubiousWeights_ = NULL;
   }
+  bucketMode_ = rhs.bucketMode_;
+  deleteBuckets();
+  if (rhs.bucketOf_)
+    createBuckets();
+}
+// Creates buckets if wanted and fills from infeasible_
+void ClpDualRowSteepest::createBuckets()
+{
+  deleteBuckets();
+  if (!infeasible_ || !weights_ || !model_)
+    return;
+  int numberRows = model_->numberRows();
+  if (!bucketMode_ || (bucketMode_ == 2 && numberRows < 100000))
+    return;
+  bucketOf_ = new int[numberRows];
+  bucketNext_ = new int[numberRows];
+  bucketPrevious_ = new int[numberRows];
+  bucketFirst_ = new int[CLP_DUAL_ROW_BUCKETS];
+  for (int i = 0; i < numberRows; i++)
+    bucketOf_[i] = -1;
+  for (int i = 0; i < CLP_DUAL_ROW_BUCKETS; i++)
+    bucketFirst_[i] = -1;
+  topBucket_ = -1;
+  const int *index = infeasible_->getIndices();
+  int number = infeasible_->getNumElements();
+  for (int i = 0; i < number; i++)
+    updateBucket(index[i]);
+}
+// Deletes buckets
+void ClpDualRowSteepest::deleteBuckets()
+{
+  delete[] bucketOf_;
+  bucketOf_ = NULL;
+  delete[] bucketNext_;
+  bucketNext_ = NULL;
+  delete[] bucketPrevious_;
+  bucketPrevious_ = NULL;
+  delete[] bucketFirst_;
+  bucketFirst_ = NULL;
+  topBucket_ = -1;
+}
+// Takes row out of its bucket
+void ClpDualRowSteepest::removeFromBucket(int iRow)
+{
+  int iBucket = bucketOf_[iRow];
+  int next = bucketNext_[iRow];
+  int previous = bucketPrevious_[iRow];
+  if (previous >= 0)
+    bucketNext_[previous] = next;
+  else
+    bucketFirst_[iBucket] = next;
+  if (next >= 0)
+    bucketPrevious_[next] = previous;
+  bucketOf_[iRow] = -1;
+}
+// Puts row in correct bucket (or takes out if feasible)
+void ClpDualRowSteepest::updateBucket(int iRow)
+{
+  double value = infeasible_->denseVector()[iRow];
+  if (value <= 1.0e-50) {
+    // feasible (or tiny marker)
+    if (bucketOf_[iRow] >= 0)
+      removeFromBucket(iRow);
+    return;
+  }
+  double weight = CoinMax(CoinMin(weights_[iRow], 1.0e50), 1.0e-50);
+  int exponent;
+  frexp(value / weight, &exponent);
+  int iBucket = exponent + CLP_DUAL_ROW_BUCKETS / 2;
+  iBucket = CoinMax(0, CoinMin(CLP_DUAL_ROW_BUCKETS - 1, iBucket));
+  if (iBucket == bucketOf_[iRow])
+    return;
+  if (bucketOf_[iRow] >= 0)
+    removeFromBucket(iRow);
+  int first = bucketFirst_[iBucket];
+  bucketNext_[iRow] = first;
+  bucketPrevious_[iRow] = -1;
+  if (first >= 0)
+    bucketPrevious_[first] = iRow;
+  bucketFirst_[iBucket] = iRow;
+  bucketOf_[iRow] = iBucket;
+  topBucket_ = CoinMax(topBucket_, iBucket);
 }
 // Returns pivot row, -1 if none
 int ClpDualRowSteepest::pivotRow()
@@ -270,6 +374,8 @@ int ClpDualRowSteepest::pivotRow()
       if (infeas[lastPivotRow])
         infeas[lastPivotRow] = COIN_INDEXED_REALLY_TINY_ELEMENT;
     }
+    if (bucketOf_)
+      updateBucket(lastPivotRow);
     number = infeasible_->getNumElements();
   }
   if (model_->numberIterations() < model_->lastBadIteration() + 200) {
@@ -301,6 +407,53 @@ int ClpDualRowSteepest::pivotRow()
   if (model_->largestPrimalError() > 1.0e-3)
     numberWanted = number + 1; // be safe
   int iPass;
+  if (bucketOf_) {
+    /* Rows in a bucket have infeasibility/weight below
+       2^(bucket-CLP_DUAL_ROW_BUCKETS/2) so buckets are looked at from
+       the top until none can beat best so far.  Last pivot row is cut
+       by 1.0e-10 as in scan below.  There is no random start - with
+       partial pricing rows are taken best bucket first instead. */
+    for (int iBucket = topBucket_; iBucket >= 0; iBucket--) {
+      iRow = bucketFirst_[iBucket];
+      if (iRow < 0 && iBucket == topBucket_) {
+        topBucket_--;
+        continue;
+      }
+      if (iBucket < CLP_DUAL_ROW_BUCKETS - 1
+        && ldexp(1.0, iBucket - CLP_DUAL_ROW_BUCKETS / 2) <= largest)
+        break;
+      for (; iRow >= 0; iRow = bucketNext_[iRow]) {
+        double value = infeas[iRow];
+        if (value > tolerance) {
+          double weight = CoinMin(weights_[iRow], 1.0e50);
+          if (value > largest * weight) {
+            // make last pivot row last resort choice
+            if (iRow == lastPivotRow) {
+              if (value * 1.0e-10 < largest * weight)
+                continue;
+              else
+                value *= 1.0e-10;
+            }
+            int iSequence = pivotVariable[iRow];
+            if (!model_->flagged(iSequence)) {
+              if (solution[iSequence] > upper[iSequence] + tolerance || solution[iSequence] < lower[iSequence] - tolerance) {
+                chosenRow = iRow;
+                largest = value / weight;
+              }
+            } else {
+              // just to make sure we don't exit before got something
+              numberWanted++;
+            }
+          }
+          numberWanted--;
+          if (!numberWanted)
+            break;
+        }
+      }
+      if (!numberWanted)
+        break;
+    }
+  }
   // Setup two passes
   int start[4];
   start[1] = number;
@@ -308,6 +461,10 @@ int ClpDualRowSteepest::pivotRow()
   double dstart = static_cast< double >(number) * model_->randomNumberGenerator()->randomDouble();
   start[0] = static_cast< int >(dstart);
   start[3] = start[0];
+  if (bucketOf_) {
+    // already done (random number still taken so sequence is same)
+    start[0] = start[1] = start[2] = start[3] = 0;
+  }
   //double largestWeight=0.0;
   //double smallestWeight=1.0e100;
   for (iPass = 0; iPass < 2; iPass++) {
@@ -569,6 +726,11 @@ ClpDualRowSteepest::updateWeights(CoinIndexedVector *input,
     // Try this to make less likely will happen again and stop cycling
     //norm *= 1.02;
     weights_[pivotRow] = norm;
+    if (bucketOf_) {
+      for (i = 0; i < nSave; i++)
+        updateBucket(which3[i]);
+      updateBucket(pivotRow);
+    }
     spare->clear();
 #ifdef CLP_DEBUG
     spare->checkClear();
@@ -648,6 +810,11 @@ ClpDualRowSteepest::updateWeights(CoinIndexedVector *input,
     if (norm < DEVEX_TRY_NORM)
       norm = DEVEX_TRY_NORM;
     weights_[pivotRow] = norm;
+    if (bucketOf_) {
+      for (i = 0; i < nSave; i++)
+        updateBucket(which3[i]);
+      updateBucket(pivotRow);
+    }
     spare->clear();
   }
 #ifdef CLP_DEBUG
@@ -791,6 +958,11 @@ void ClpDualRowSteepest::updatePrimalSolution(
     if (infeas[iRow])
       infeas[iRow] = COIN_INDEXED_REALLY_TINY_ELEMENT;
   }
+  if (bucketOf_) {
+    for (i = 0; i < number; i++)
+      updateBucket(which[i]);
+    updateBucket(model_->pivotRow());
+  }
   primalUpdate->setNumElements(0);
   objectiveChange += changeObj;
 }
@@ -860,10 +1032,6 @@ void ClpDualRowSteepest::saveWeights(ClpSimplex *model, int mode)
       alternateWeights_->reserve(numberRows + model_->factorization()->maximumPivots());
       if (mode_ != 1 || mode == 5) {
       } else {
-        CoinIndexedVector *temp = new CoinIndexedVector();
-        temp->reserve(numberRows + model_->factorization()->maximumPivots());
-        double *array = alternateWeights_->denseVector();
-        int *which = alternateWeights_->getIndices();
         int firstRow = 0;
         int lastRow = numberRows;
         if (mode == 7) {
@@ -871,24 +1039,8 @@ void ClpDualRowSteepest::saveWeights(ClpSimplex *model, int mode)
           firstRow = model->spareIntArray_[0];
           lastRow = model->spareIntArray_[1];
         }
-        for (i = firstRow; i < lastRow; i++) {
-          double value = 0.0;
-          array[0] = 1.0;
-          which[0] = i;
-          alternateWeights_->setNumElements(1);
-          alternateWeights_->setPackedMode(true);
-          model_->factorization()->updateColumnTranspose(temp,
-            alternateWeights_);
-          int number = alternateWeights_->getNumElements();
-          int j;
-          for (j = 0; j < number; j++) {
-            value += array[j] * array[j];
-            array[j] = 0.0;
-          }
-          alternateWeights_->setNumElements(0);
-          weights_[i] = value;
-        }
-        delete temp;
+        // exact weights - done in panels over threads if worth it
+        model_->factorization()->transposeNorms(firstRow, lastRow, weights_);
       }
       // create saved weights (not really indexedvector)
       savedWeights_ = new CoinIndexedVector();
@@ -1049,6 +1201,11 @@ void ClpDualRowSteepest::saveWeights(ClpSimplex *model, int mode)
       }
     }
   }
+  // buckets follow infeasibilities and weights
+  if (mode >= 2)
+    createBuckets();
+  else if (!weights_)
+    deleteBuckets();
 }
 // Pass in saved weights
 void ClpDualRowSteepest::passInSavedWeights(const CoinIndexedVector *saved)
@@ -1076,6 +1233,10 @@ void ClpDualRowSteepest::unrollWeights()
       saved[iRow] = 0.0;
     }
   }
+  if (bucketOf_) {
+    for (i = 0; i < number; i++)
+      updateBucket(which[i]);
+  }
   alternateWeights_->setNumElements(0);
 }
 //-------------------------------------------------------------------
@@ -1103,6 +1264,7 @@ void ClpDualRowSteepest::clearArrays()
     alternateWeights_ = NULL;
     delete savedWeights_;
     savedWeights_ = NULL;
+    deleteBuckets();
   }
   state_ = -1;
 }
@@ -123,11 +123,40 @@ public:
   {
     return persistence_;
   }
+  /** Bucketed choice of pivot row - 0 off, 1 on, 2 (default) on if
+         at least 100000 rows.
+         Infeasible rows are kept in buckets by binary exponent of
+         infeasibility/weight, updated as infeasibilities and weights
+         change, so pivotRow only looks at top buckets until no row in
+         a lower one could be better.  Last pivot row is still cut by
+         1.0e-10.  In partial modes (2 and 3) rows are taken best bucket
+         first rather than from a random start.
+     */
+  inline void setBucketMode(int value)
+  {
+    bucketMode_ = value;
+  }
+  inline int bucketMode() const
+  {
+    return bucketMode_;
+  }
   //@}
 
   //---------------------------------------------------------------------------
 
 protected:
+  ///@name Buckets
+  //@{
+  /// Creates buckets if wanted and fills from infeasible_
+  void createBuckets();
+  /// Deletes buckets
+  void deleteBuckets();
+  /// Puts row in correct bucket (or takes out if feasible)
+  void updateBucket(int iRow);
+  /// Takes row out of its bucket
+  void removeFromBucket(int iRow);
+  //@}
+
   ///@name Protected member data
   /** Status
          0) Normal
@@ -150,6 +179,18 @@ protected:
   CoinIndexedVector *savedWeights_;
   /// Dubious weights
   int *dubiousWeights_;
+  /// Bucket of each row (-1 if in none)
+  int *bucketOf_;
+  /// Next row in same bucket
+  int *bucketNext_;
+  /// Previous row in same bucket
+  int *bucketPrevious_;
+  /// First row in each bucket
+  int *bucketFirst_;
+  /// Highest bucket which may be non empty
+  int topBucket_;
+  /// Bucket mode (see setBucketMode)
+  int bucketMode_;
   //@}
 };
 
@@ -16,6 +16,8 @@
 #include "ClpSimplex.hpp"
 #include "ClpSimplexDual.hpp"
 #include "ClpMatrixBase.hpp"
+#include "ClpThreadPool.hpp"
+#include "CoinTypes.h"
 #ifndef SLIM_CLP
 #include "ClpNetworkBasis.hpp"
 #include "ClpNetworkMatrix.hpp"
@@ -3256,5 +3258,73 @@ void ClpFactorization::setFactorization(ClpFactorization &rhs)
 }
 #endif
 
+// Default fewest rows in a panel for transposeNorms to use threads
+#ifndef CLP_BTRAN_PANEL_ROWS
+#define CLP_BTRAN_PANEL_ROWS 2048
+#endif
+// Squared norms of BTRAN of unit vectors for one panel of rows
+static void clpPanelNorms(const ClpFactorization *factorization,
+  int firstRow, int lastRow, double *COIN_RESTRICT norms)
+{
+  int size = factorization->numberRows() + factorization->maximumPivots();
+  CoinIndexedVector work;
+  work.reserve(size);
+  CoinIndexedVector region;
+  region.reserve(size);
+  double *COIN_RESTRICT array = region.denseVector();
+  int *COIN_RESTRICT which = region.getIndices();
+  for (int iRow = firstRow; iRow < lastRow; iRow++) {
+    double value = 0.0;
+    array[0] = 1.0;
+    which[0] = iRow;
+    region.setNumElements(1);
+    region.setPackedMode(true);
+    factorization->updateColumnTranspose(&work, &region);
+    int number = region.getNumElements();
+    for (int j = 0; j < number; j++) {
+      value += array[j] * array[j];
+      array[j] = 0.0;
+    }
+    region.setNumElements(0);
+    norms[iRow] = value;
+  }
+}
+/* Squared norms of rows of inverse (BTRAN of unit vectors)
+   - exact dual steepest edge weights */
+void ClpFactorization::transposeNorms(int firstRow, int lastRow,
+  double *norms, int panelRows) const
+{
+  int numberToDo = lastRow - firstRow;
+  if (numberToDo <= 0)
+    return;
+  if (panelRows <= 0)
+    panelRows = CLP_BTRAN_PANEL_ROWS;
+  ClpThreadPool *pool = ClpThreadPool::pool();
+  int numberPanels = 1;
+  if (!pool->serial())
+    numberPanels = CoinMin(pool->numberThreads(),
+      numberToDo / panelRows);
+  if (numberPanels <= 1) {
+    clpPanelNorms(this, firstRow, lastRow, norms);
+    return;
+  }
+  // copies made before any BTRAN so nothing reads work areas in use
+  const ClpFactorization **factorizations = new const ClpFactorization *[numberPanels];
+  factorizations[0] = this;
+  for (int iPanel = 1; iPanel < numberPanels; iPanel++)
+    factorizations[iPanel] = new ClpFactorization(*this);
+  clpParallelFor(0, numberPanels, 1, [=](int firstPanel, int lastPanel) {
+    for (int iPanel = firstPanel; iPanel < lastPanel; iPanel++) {
+      int start = firstRow + static_cast< int >((static_cast< CoinInt64 >(numberToDo) * iPanel) / numberPanels);
+      int end = firstRow + static_cast< int >((static_cast< CoinInt64 >(numberToDo) * (iPanel + 1)) / numberPanels);
+      clpPanelNorms(factorizations[iPanel], start, end, norms);
+    }
+  },
+    numberPanels);
+  for (int iPanel = 1; iPanel < numberPanels; iPanel++)
+    delete factorizations[iPanel];
+  delete[] factorizations;
+}
+
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
 */
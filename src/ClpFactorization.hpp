@@ -141,6 +141,17 @@ public:
   void updateTwoColumnsTranspose(CoinIndexedVector *regionSparse,
     CoinIndexedVector *regionSparse2,
     CoinIndexedVector *regionSparse3) const;
+  /** Squared norms of rows of inverse (BTRAN of unit vectors) -
+      norms[i] for i in [firstRow,lastRow) - these are exact dual
+      steepest edge weights.
+      With more than one thread in ClpThreadPool and enough rows
+      the rows are done in panels, each panel on its own copy of the
+      factorization (BTRAN uses work areas inside the factorization).
+      Results do not depend on number of threads.
+      panelRows is the fewest rows in a panel (0 for default of 2048).
+  */
+  void transposeNorms(int firstRow, int lastRow, double *norms,
+    int panelRows = 0) const;
   //@}
 #ifdef CLP_MULTIPLE_FACTORIZATIONS
   /**@name Lifted from CoinFactorization */
@@ -98,6 +98,9 @@ ClpInterior::ClpInterior()
   , zVec_(NULL)
   , wVec_(NULL)
   , cholesky_(NULL)
+  , warmStart_(NULL)
+  , warmStartRows_(0)
+  , warmStartColumns_(0)
   , numberComplementarityPairs_(0)
   , numberComplementarityItems_(0)
   , maximumBarrierIterations_(200)
@@ -187,6 +190,9 @@ ClpInterior::ClpInterior(const ClpModel *rhs,
   , zVec_(NULL)
   , wVec_(NULL)
   , cholesky_(NULL)
+  , warmStart_(NULL)
+  , warmStartRows_(0)
+  , warmStartColumns_(0)
   , numberComplementarityPairs_(0)
   , numberComplementarityItems_(0)
   , maximumBarrierIterations_(200)
@@ -261,6 +267,9 @@ ClpInterior::ClpInterior(const ClpInterior &rhs)
   , zVec_(NULL)
   , wVec_(NULL)
   , cholesky_(NULL)
+  , warmStart_(NULL)
+  , warmStartRows_(0)
+  , warmStartColumns_(0)
 {
   gutsOfDelete();
   gutsOfCopy(rhs);
@@ -339,6 +348,9 @@ ClpInterior::ClpInterior(const ClpModel &rhs)
   , zVec_(NULL)
   , wVec_(NULL)
   , cholesky_(NULL)
+  , warmStart_(NULL)
+  , warmStartRows_(0)
+  , warmStartColumns_(0)
   , numberComplementarityPairs_(0)
   , numberComplementarityItems_(0)
   , maximumBarrierIterations_(200)
@@ -435,6 +447,9 @@ void ClpInterior::gutsOfCopy(const ClpInterior &rhs)
   zVec_ = ClpCopyOfArray(rhs.zVec_, numberRows_ + numberColumns_);
   wVec_ = ClpCopyOfArray(rhs.wVec_, numberRows_ + numberColumns_);
   cholesky_ = rhs.cholesky_->clone();
+  warmStartRows_ = rhs.warmStartRows_;
+  warmStartColumns_ = rhs.warmStartColumns_;
+  warmStart_ = ClpCopyOfArray(rhs.warmStart_, 2 * (warmStartRows_ + warmStartColumns_));
   numberComplementarityPairs_ = rhs.numberComplementarityPairs_;
   numberComplementarityItems_ = rhs.numberComplementarityItems_;
   maximumBarrierIterations_ = rhs.maximumBarrierIterations_;
@@ -513,6 +528,8 @@ void ClpInterior::gutsOfDelete()
   zVec_ = NULL;
   delete[] wVec_;
   wVec_ = NULL;
+  delete[] warmStart_;
+  warmStart_ = NULL;
   delete cholesky_;
 }
 bool ClpInterior::createWorkingData()
@@ -728,6 +745,30 @@ void ClpInterior::deleteWorkingData()
   diagonal_ = NULL;
   delete[] deltaX_;
   deltaX_ = NULL;
+  delete[] deltaZ_;
+  deltaZ_ = NULL;
+  delete[] deltaW_;
+  deltaW_ = NULL;
+  delete[] deltaSU_;
+  deltaSU_ = NULL;
+  delete[] deltaSL_;
+  deltaSL_ = NULL;
+  delete[] primalR_;
+  primalR_ = NULL;
+  delete[] dualR_;
+  dualR_ = NULL;
+  delete[] rhsB_;
+  rhsB_ = NULL;
+  delete[] rhsU_;
+  rhsU_ = NULL;
+  delete[] rhsL_;
+  rhsL_ = NULL;
+  delete[] rhsZ_;
+  rhsZ_ = NULL;
+  delete[] rhsW_;
+  rhsW_ = NULL;
+  delete[] rhsC_;
+  rhsC_ = NULL;
   delete[] workArray_;
   workArray_ = NULL;
   delete[] zVec_;
@@ -1073,6 +1114,34 @@ void ClpInterior::setCholesky(ClpCholeskyBase *cholesky)
   delete cholesky_;
   cholesky_ = cholesky;
 }
+/* Warm start next primalDual from previous solution.
+   Values are copied now so values in model may change before solve,
+   but if rows or columns are added or deleted it is dropped. */
+void ClpInterior::setWarmStart(const double *columnPrimal,
+  const double *rowPrimal,
+  const double *rowDual,
+  const double *reducedCost)
+{
+  int numberTotal = numberRows_ + numberColumns_;
+  delete[] warmStart_;
+  warmStart_ = new double[2 * numberTotal];
+  warmStartRows_ = numberRows_;
+  warmStartColumns_ = numberColumns_;
+  double *primal = warmStart_;
+  double *dual = warmStart_ + numberTotal;
+  CoinMemcpyN(columnPrimal ? columnPrimal : columnActivity_, numberColumns_, primal);
+  CoinMemcpyN(rowPrimal ? rowPrimal : rowActivity_, numberRows_, primal + numberColumns_);
+  CoinMemcpyN(reducedCost ? reducedCost : reducedCost_, numberColumns_, dual);
+  CoinMemcpyN(rowDual ? rowDual : dual_, numberRows_, dual + numberColumns_);
+}
+// Forget any warm start
+void ClpInterior::clearWarmStart()
+{
+  delete[] warmStart_;
+  warmStart_ = NULL;
+  warmStartRows_ = 0;
+  warmStartColumns_ = 0;
+}
 /* Borrow model.  This is so we dont have to copy large amounts
    of data around.  It assumes a derived class wants to overwrite
    an empty model with a real one - while it does an algorithm.
@@ -155,6 +155,23 @@ public:
   int pdco(ClpPdcoBase *stuff, Options &options, Info &info, Outfo &outfo);
   /// Primal-Dual Predictor-Corrector barrier
   int primalDual();
+  /** Warm start next primalDual from a previous solution (say before
+      objective or bounds were changed).  Arrays are unscaled as in model
+      and a NULL array means use model's own (column activities, row
+      activities, duals and reduced costs).  The solution is shifted back
+      into the interior before iterating.  Only used by next solve and
+      dropped if the number of rows or columns has changed by then. */
+  void setWarmStart(const double *columnPrimal = NULL,
+    const double *rowPrimal = NULL,
+    const double *rowDual = NULL,
+    const double *reducedCost = NULL);
+  /// Forget any warm start
+  void clearWarmStart();
+  /// Whether next primalDual will be warm started
+  inline bool warmStart() const
+  {
+    return warmStart_ != NULL;
+  }
   //@}
 
   /**@name most useful gets and sets */
@@ -589,6 +606,13 @@ protected:
   CoinWorkDouble *wVec_;
   /// cholesky.
   ClpCholeskyBase *cholesky_;
+  /** Warm start (if any) - primal (columns then rows) then
+      reduced costs and duals */
+  double *warmStart_;
+  /// Number of rows when warm start saved
+  int warmStartRows_;
+  /// Number of columns when warm start saved
+  int warmStartColumns_;
   /// numberComplementarityPairs i.e. ones with lower and/or upper bounds (not fixed)
   int numberComplementarityPairs_;
   /// numberComplementarityItems_ i.e. number of active bounds
@@ -97,6 +97,7 @@ static Clp_message clp_us_english[] = {
   { CLP_BARRIER_ABS_ERROR, 56, 2, "Primal error is %g and dual error is %g" },
   { CLP_BARRIER_FEASIBLE, 57, 2, "Infeasibilities - bound %g , primal %g ,dual %g" },
   { CLP_BARRIER_STEP, 58, 2, "Steps - primal %g ,dual %g , mu %g" },
+  { CLP_BARRIER_WARM, 66, 2, "Warm start - slacks shifted by %g, duals by %g" },
   { CLP_BARRIER_KKT, 6005, 0, "Quadratic barrier needs a KKT factorization" },
   { CLP_RIM_SCALE, 59, 1, "Automatic rim scaling gives objective scale of %g and rhs/bounds scale of %g" },
   { CLP_SLP_ITER, 58, 1, "Pass %d objective %g - drop %g, largest delta %g" },
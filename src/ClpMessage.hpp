@@ -95,6 +95,7 @@ enum CLP_Message {
   CLP_BARRIER_ABS_ERROR,
   CLP_BARRIER_FEASIBLE,
   CLP_BARRIER_STEP,
+  CLP_BARRIER_WARM,
   CLP_BARRIER_KKT,
   CLP_RIM_SCALE,
   CLP_SLP_ITER,
@@ -53,6 +53,7 @@
 #endif
 #ifndef SLIM_NOIO
 #include "CoinMpsIO.hpp"
+#include "ClpMpsReader.hpp"
 #include "CoinFileIO.hpp"
 #include "CoinModel.hpp"
 #endif
@@ -2886,6 +2887,71 @@ int ClpModel::readMps(const char *fileName,
         << fileName << CoinMessageEol;
       return -1;
     }
+    // Try fast reader - it returns 1 if model needs CoinMpsIO
+    ClpMpsReader reader;
+    reader.setSmallElementValue(CoinMax(smallElement_, 1.0e-14));
+    if (!reader.readMps(fileName)) {
+      int numberRows = reader.numberRows();
+      int numberColumns = reader.numberColumns();
+      ClpPackedMatrix *clpMatrix = dynamic_cast< ClpPackedMatrix * >(matrix_);
+      bool special = (clpMatrix) ? clpMatrix->wantsSpecialColumnCopy() : false;
+      gutsOfLoadModel(numberRows, numberColumns,
+        reader.columnLower(), reader.columnUpper(), reader.objective(),
+        reader.rowLower(), reader.rowUpper(), NULL);
+      clpMatrix = new ClpPackedMatrix(reader.takeMatrix());
+      if (special)
+        clpMatrix->makeSpecialColumnCopy();
+      matrix_ = clpMatrix;
+      matrix_->setDimensions(numberRows_, numberColumns_);
+      if (reader.integerColumns()) {
+        integerType_ = new char[numberColumns_];
+        CoinMemcpyN(reader.integerColumns(), numberColumns_, integerType_);
+      } else {
+        integerType_ = NULL;
+      }
+#ifndef CLP_NO_STD
+      setStrParam(ClpProbName, reader.problemName());
+      if (keepNames) {
+        unsigned int maxLength = 0;
+        rowNames_ = std::vector< std::string >();
+        columnNames_ = std::vector< std::string >();
+        rowNames_.reserve(numberRows_);
+        for (int iRow = 0; iRow < numberRows_; iRow++) {
+          const char *name = reader.rowName(iRow);
+          maxLength = CoinMax(maxLength, static_cast< unsigned int >(strlen(name)));
+          rowNames_.push_back(name);
+        }
+        columnNames_.reserve(numberColumns_);
+        for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+          const char *name = reader.columnName(iColumn);
+          maxLength = CoinMax(maxLength, static_cast< unsigned int >(strlen(name)));
+          columnNames_.push_back(name);
+        }
+        lengthNames_ = static_cast< int >(maxLength);
+      } else {
+        lengthNames_ = 0;
+      }
+#endif
+      setDblParam(ClpObjOffset, reader.objectiveOffset());
+      double totalTime = 0.0;
+      for (int i = 0; i < ClpMpsReader::MPS_NUMBER_SECTIONS; i++)
+        totalTime += reader.sectionTime(i);
+      handler_->message(CLP_IMPORT_RESULT, messages_)
+        << fileName
+        << totalTime << CoinMessageEol;
+      if (handler_->logLevel() > 1) {
+        char line[200];
+        sprintf(line, "Read %.3f, rows %.3f, columns %.3f (%d chunks), matrix %.3f, rhs/bounds %.3f seconds",
+          reader.sectionTime(ClpMpsReader::MPS_READ),
+          reader.sectionTime(ClpMpsReader::MPS_ROWS),
+          reader.sectionTime(ClpMpsReader::MPS_COLUMNS), reader.numberChunks(),
+          reader.sectionTime(ClpMpsReader::MPS_MATRIX),
+          reader.sectionTime(ClpMpsReader::MPS_RHS_BOUNDS));
+        handler_->message(CLP_GENERAL2, messages_)
+          << line << CoinMessageEol;
+      }
+      return 0;
+    }
   }
   CoinMpsIO m;
   m.passInMessageHandler(handler_);
@@ -0,0 +1,839 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinError.hpp"
+#include "CoinFileIO.hpp"
+#include "CoinFinite.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinTime.hpp"
+#include "ClpMpsReader.hpp"
+#include "ClpThreadPool.hpp"
+
+namespace {
+/* Hash table of names which point into the file buffer.
+   Size is fixed at construction - maximum must be big enough. */
+class ClpMpsNames {
+public:
+  explicit ClpMpsNames(int maximum)
+  {
+    int size = 16;
+    while (size < 2 * maximum)
+      size *= 2;
+    slot_.assign(size, -1);
+    mask_ = size - 1;
+    name_.reserve(maximum);
+    length_.reserve(maximum);
+  }
+  /// Returns index of name or -1
+  int find(const char *name, int length) const
+  {
+    unsigned int k = hash(name, length) & mask_;
+    while (slot_[k] >= 0) {
+      int j = slot_[k];
+      if (length_[j] == length && !memcmp(name_[j], name, length))
+        return j;
+      k = (k + 1) & mask_;
+    }
+    return -1;
+  }
+  /// Adds name - returns false if already there
+  bool add(const char *name, int length)
+  {
+    unsigned int k = hash(name, length) & mask_;
+    while (slot_[k] >= 0) {
+      int j = slot_[k];
+      if (length_[j] == length && !memcmp(name_[j], name, length))
+        return false;
+      k = (k + 1) & mask_;
+    }
+    slot_[k] = static_cast< int >(name_.size());
+    name_.push_back(name);
+    length_.push_back(length);
+    return true;
+  }
+  inline int size() const
+  {
+    return static_cast< int >(name_.size());
+  }
+  inline const char *name(int i) const
+  {
+    return name_[i];
+  }
+  inline int length(int i) const
+  {
+    return length_[i];
+  }
+
+private:
+  static unsigned int hash(const char *name, int length)
+  {
+    unsigned int value = 2166136261u;
+    for (int i = 0; i < length; i++)
+      value = (value ^ static_cast< unsigned char >(name[i])) * 16777619u;
+    return value;
+  }
+  std::vector< int > slot_;
+  std::vector< const char * > name_;
+  std::vector< int > length_;
+  unsigned int mask_;
+};
+// What one chunk of COLUMNS produces
+struct ClpMpsChunk {
+  /// Position of each column in row/element
+  std::vector< CoinBigIndex > start;
+  std::vector< const char * > name;
+  std::vector< int > nameLength;
+  /// Objective for each column
+  std::vector< double > objective;
+  /// 1 if objective given for column
+  std::vector< char > objectiveGiven;
+  std::vector< int > row;
+  std::vector< double > element;
+  /// Number of columns before each marker
+  std::vector< int > markerColumn;
+  /// 1 for INTORG, 0 for INTEND
+  std::vector< char > markerInteger;
+  bool bad;
+  ClpMpsChunk()
+    : bad(false)
+  {
+  }
+};
+}
+
+// Bytes of COLUMNS section per chunk
+#define CLP_MPS_CHUNK 1048576
+// Maximum number of chunks
+#define CLP_MPS_MAX_CHUNKS 256
+
+/* Splits line at position into blank separated tokens and moves position
+   to next line.  Returns number of tokens (which may be more than maximum
+   - only maximum are stored).  Comment lines have no tokens.
+*/
+static int clpMpsTokens(const char *&position, const char **token,
+  int *length, int maximum)
+{
+  const char *p = position;
+  int n = 0;
+  if (*p == '*') {
+    while (*p != '\n' && *p)
+      p++;
+  } else {
+    while (true) {
+      while (*p == ' ' || *p == '\t' || *p == '\r')
+        p++;
+      if (*p == '\n' || !*p)
+        break;
+      const char *start = p;
+      while (static_cast< unsigned char >(*p) > ' ')
+        p++;
+      if (n < maximum) {
+        token[n] = start;
+        length[n] = static_cast< int >(p - start);
+      }
+      n++;
+    }
+  }
+  position = p + 1;
+  return n;
+}
+// Number from token - false if token is not all number
+static inline bool clpMpsValue(const char *token, int length, double &value)
+{
+  char *end;
+  value = strtod(token, &end);
+  return end == token + length;
+}
+// Bounds and rhs of 1.0e30 or more are infinite
+static inline double clpMpsInfinite(double value)
+{
+  if (value >= 1.0e30)
+    return COIN_DBL_MAX;
+  else if (value <= -1.0e30)
+    return -COIN_DBL_MAX;
+  else
+    return value;
+}
+static inline bool clpMpsIs(const char *token, int length, const char *keyword)
+{
+  return length == static_cast< int >(strlen(keyword)) && !memcmp(token, keyword, length);
+}
+// Tokenize part of COLUMNS
+static void clpMpsColumns(const char *first, const char *last,
+  const ClpMpsNames &rows, const int *rowNumber, double smallElement,
+  ClpMpsChunk &chunk)
+{
+  const char *token[5];
+  int length[5];
+  const char *p = first;
+  while (p < last) {
+    int n = clpMpsTokens(p, token, length, 5);
+    if (!n)
+      continue;
+    if (n == 3 && clpMpsIs(token[1], length[1], "'MARKER'")) {
+      if (clpMpsIs(token[2], length[2], "'INTORG'")) {
+        chunk.markerInteger.push_back(1);
+      } else if (clpMpsIs(token[2], length[2], "'INTEND'")) {
+        chunk.markerInteger.push_back(0);
+      } else {
+        chunk.bad = true;
+        return;
+      }
+      chunk.markerColumn.push_back(static_cast< int >(chunk.name.size()));
+      continue;
+    }
+    if (n != 3 && n != 5) {
+      chunk.bad = true;
+      return;
+    }
+    int numberColumns = static_cast< int >(chunk.name.size());
+    if (!numberColumns
+      || (chunk.markerColumn.size() && chunk.markerColumn.back() == numberColumns)
+      || chunk.nameLength.back() != length[0]
+      || memcmp(chunk.name.back(), token[0], length[0])) {
+      // new column
+      chunk.start.push_back(static_cast< CoinBigIndex >(chunk.row.size()));
+      chunk.name.push_back(token[0]);
+      chunk.nameLength.push_back(length[0]);
+      chunk.objective.push_back(0.0);
+      chunk.objectiveGiven.push_back(0);
+    }
+    for (int k = 1; k < n; k += 2) {
+      int iName = rows.find(token[k], length[k]);
+      double value;
+      if (iName < 0 || !clpMpsValue(token[k + 1], length[k + 1], value)) {
+        chunk.bad = true;
+        return;
+      }
+      int iRow = rowNumber[iName];
+      if (iRow < 0) {
+        if (chunk.objectiveGiven.back()) {
+          // given twice - leave to CoinMpsIO
+          chunk.bad = true;
+          return;
+        }
+        chunk.objective.back() = value;
+        chunk.objectiveGiven.back() = 1;
+      } else if (fabs(value) >= smallElement) {
+        chunk.row.push_back(iRow);
+        chunk.element.push_back(value);
+      }
+    }
+  }
+}
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+ClpMpsReader::ClpMpsReader()
+  : buffer_(NULL)
+  , names_(NULL)
+  , nameStart_(NULL)
+  , rowLower_(NULL)
+  , rowUpper_(NULL)
+  , columnLower_(NULL)
+  , columnUpper_(NULL)
+  , objective_(NULL)
+  , integerType_(NULL)
+  , matrix_(NULL)
+  , objectiveOffset_(0.0)
+  , smallElement_(1.0e-14)
+  , numberRows_(0)
+  , numberColumns_(0)
+  , numberChunks_(0)
+  , chunkSize_(CLP_MPS_CHUNK)
+{
+  problemName_[0] = '\0';
+  CoinZeroN(sectionTime_, MPS_NUMBER_SECTIONS);
+}
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+ClpMpsReader::~ClpMpsReader()
+{
+  gutsOfDelete();
+}
+void ClpMpsReader::gutsOfDelete()
+{
+  delete[] buffer_;
+  delete[] names_;
+  delete[] nameStart_;
+  delete[] rowLower_;
+  delete[] rowUpper_;
+  delete[] columnLower_;
+  delete[] columnUpper_;
+  delete[] objective_;
+  delete[] integerType_;
+  delete matrix_;
+  buffer_ = NULL;
+  names_ = NULL;
+  nameStart_ = NULL;
+  rowLower_ = NULL;
+  rowUpper_ = NULL;
+  columnLower_ = NULL;
+  columnUpper_ = NULL;
+  objective_ = NULL;
+  integerType_ = NULL;
+  matrix_ = NULL;
+  numberRows_ = 0;
+  numberColumns_ = 0;
+}
+CoinPackedMatrix *
+ClpMpsReader::takeMatrix()
+{
+  CoinPackedMatrix *matrix = matrix_;
+  matrix_ = NULL;
+  return matrix;
+}
+int ClpMpsReader::readMps(const char *fileName)
+{
+  gutsOfDelete();
+  CoinZeroN(sectionTime_, MPS_NUMBER_SECTIONS);
+  objectiveOffset_ = 0.0;
+  problemName_[0] = '\0';
+  numberChunks_ = 0;
+  double time0 = CoinGetTimeOfDay();
+  // Read whole file (decompressing if needed)
+  CoinFileInput *input = NULL;
+  try {
+    input = CoinFileInput::create(fileName);
+  } catch (CoinError e) {
+    input = NULL;
+  }
+  if (!input)
+    return -1;
+  // Uncompressed files are read straight into a buffer of the right size
+  size_t fileSize = 0;
+  bool compressed = true;
+  FILE *fp = fopen(fileName, "rb");
+  if (fp) {
+    unsigned char magic[3] = { 0, 0, 0 };
+    size_t nMagic = fread(magic, 1, 3, fp);
+    compressed = (nMagic >= 2 && magic[0] == 0x1f && magic[1] == 0x8b)
+      || (nMagic == 3 && magic[0] == 'B' && magic[1] == 'Z' && magic[2] == 'h');
+    if (!fseek(fp, 0, SEEK_END)) {
+      long position = ftell(fp);
+      if (position > 0)
+        fileSize = static_cast< size_t >(position);
+      else
+        compressed = true;
+    }
+    fclose(fp);
+  }
+  size_t size = 0;
+  if (!compressed) {
+    buffer_ = new char[fileSize + 2];
+    while (size < fileSize) {
+      int bytes = static_cast< int >(CoinMin(fileSize - size,
+        static_cast< size_t >(4 * CLP_MPS_CHUNK)));
+      bytes = input->read(buffer_ + size, bytes);
+      if (bytes <= 0)
+        break;
+      size += bytes;
+    }
+  } else {
+    // Size not known - read in pieces and copy once
+    std::vector< char * > pieces;
+    std::vector< size_t > pieceSize;
+    while (true) {
+      char *piece = new char[4 * CLP_MPS_CHUNK];
+      size_t n = 0;
+      while (n < 4 * CLP_MPS_CHUNK) {
+        int bytes = input->read(piece + n, static_cast< int >(4 * CLP_MPS_CHUNK - n));
+        if (bytes <= 0)
+          break;
+        n += bytes;
+      }
+      pieces.push_back(piece);
+      pieceSize.push_back(n);
+      size += n;
+      if (n < 4 * CLP_MPS_CHUNK)
+        break;
+    }
+    buffer_ = new char[size + 2];
+    size_t put = 0;
+    for (size_t i = 0; i < pieces.size(); i++) {
+      CoinMemcpyN(pieces[i], pieceSize[i], buffer_ + put);
+      put += pieceSize[i];
+      delete[] pieces[i];
+    }
+  }
+  delete input;
+  buffer_[size] = '\n';
+  buffer_[size + 1] = '\0';
+  double time1 = CoinGetTimeOfDay();
+  sectionTime_[MPS_READ] = time1 - time0;
+  // Find section headers - lines which do not start with blank or *
+  int numberScan = static_cast< int >(CoinMin(static_cast< size_t >(CLP_MPS_MAX_CHUNKS),
+    size / chunkSize_ + 1));
+  std::vector< std::vector< size_t > > found(numberScan);
+  clpParallelFor(0, numberScan, 1, [&](int firstScan, int lastScan) {
+    for (int iScan = firstScan; iScan < lastScan; iScan++) {
+      size_t start = (size * iScan) / numberScan;
+      size_t end = (size * (iScan + 1)) / numberScan;
+      size_t j = start;
+      while (j < end) {
+        if (!j || buffer_[j - 1] == '\n') {
+          unsigned char c = static_cast< unsigned char >(buffer_[j]);
+          if (c > ' ' && c != '*')
+            found[iScan].push_back(j);
+        }
+        const char *next = static_cast< const char * >(memchr(buffer_ + j, '\n', end - j));
+        if (!next)
+          break;
+        j = next - buffer_ + 1;
+      }
+    }
+  },
+    numberScan);
+  // Sections in order - 0 NAME, 1 ROWS, 2 COLUMNS, 3 RHS, 4 RANGES, 5 BOUNDS
+  const char *sectionStart[6];
+  const char *sectionEnd[6];
+  for (int i = 0; i < 6; i++) {
+    sectionStart[i] = NULL;
+    sectionEnd[i] = NULL;
+  }
+  int lastSection = -1;
+  bool gotEnd = false;
+  for (int iScan = 0; iScan < numberScan && !gotEnd; iScan++) {
+    for (size_t k = 0; k < found[iScan].size(); k++) {
+      const char *token[2];
+      int length[2];
+      const char *p = buffer_ + found[iScan][k];
+      int n = clpMpsTokens(p, token, length, 2);
+      int section;
+      if (clpMpsIs(token[0], length[0], "NAME"))
+        section = 0;
+      else if (clpMpsIs(token[0], length[0], "ROWS"))
+        section = 1;
+      else if (clpMpsIs(token[0], length[0], "COLUMNS"))
+        section = 2;
+      else if (clpMpsIs(token[0], length[0], "RHS"))
+        section = 3;
+      else if (clpMpsIs(token[0], length[0], "RANGES"))
+        section = 4;
+      else if (clpMpsIs(token[0], length[0], "BOUNDS"))
+        section = 5;
+      else if (clpMpsIs(token[0], length[0], "ENDATA"))
+        section = 6;
+      else
+        return 1; // leave to CoinMpsIO
+      if (section <= lastSection)
+        return 1;
+      if (lastSection >= 0)
+        sectionEnd[lastSection] = buffer_ + found[iScan][k];
+      if (section == 6) {
+        gotEnd = true;
+        break;
+      }
+      if (!section) {
+        if (n > 1) {
+          int nChar = CoinMin(length[1], 255);
+          memcpy(problemName_, token[1], nChar);
+          problemName_[nChar] = '\0';
+        }
+      }
+      // anything after other keywords (e.g. set name) is not needed
+      sectionStart[section] = p;
+      lastSection = section;
+    }
+  }
+  if (!gotEnd || !sectionStart[1] || !sectionStart[2])
+    return 1;
+  // ROWS
+  const char *token[5];
+  int length[5];
+  int maximumRows = 1;
+  for (const char *p = sectionStart[1]; p < sectionEnd[1]; p++) {
+    p = static_cast< const char * >(memchr(p, '\n', sectionEnd[1] - p));
+    if (!p)
+      break;
+    maximumRows++;
+  }
+  ClpMpsNames rows(maximumRows);
+  std::vector< int > rowNumber;
+  std::vector< char > rowType;
+  rowNumber.reserve(maximumRows);
+  bool gotObjective = false;
+  for (const char *p = sectionStart[1]; p < sectionEnd[1];) {
+    int n = clpMpsTokens(p, token, length, 2);
+    if (!n)
+      continue;
+    if (n != 2 || length[0] != 1)
+      return 1;
+    char type = static_cast< char >(toupper(token[0][0]));
+    if (!rows.add(token[1], length[1]))
+      return 1;
+    if (type == 'N') {
+      if (gotObjective)
+        return 1;
+      gotObjective = true;
+      rowNumber.push_back(-1);
+    } else if (type == 'E' || type == 'L' || type == 'G') {
+      rowNumber.push_back(numberRows_++);
+      rowType.push_back(type);
+    } else {
+      return 1;
+    }
+  }
+  double time2 = CoinGetTimeOfDay();
+  sectionTime_[MPS_ROWS] = time2 - time1;
+  // COLUMNS - split at line boundaries in a way which only depends on size
+  {
+    const char *first = sectionStart[2];
+    const char *last = sectionEnd[2];
+    size_t columnSize = last - first;
+    numberChunks_ = static_cast< int >(CoinMin(static_cast< size_t >(CLP_MPS_MAX_CHUNKS),
+      columnSize / chunkSize_ + 1));
+  }
+  std::vector< const char * > chunkStart(numberChunks_ + 1);
+  chunkStart[0] = sectionStart[2];
+  chunkStart[numberChunks_] = sectionEnd[2];
+  for (int iChunk = 1; iChunk < numberChunks_; iChunk++) {
+    size_t offset = ((sectionEnd[2] - sectionStart[2]) * iChunk) / numberChunks_;
+    const char *p = sectionStart[2] + offset;
+    if (p[-1] != '\n') {
+      p = static_cast< const char * >(memchr(p, '\n', sectionEnd[2] - p));
+      p = p ? p + 1 : sectionEnd[2];
+    }
+    chunkStart[iChunk] = CoinMax(p, chunkStart[iChunk - 1]);
+  }
+  std::vector< ClpMpsChunk > chunks(numberChunks_);
+  double smallElement = CoinMax(smallElement_, 1.0e-14);
+  clpParallelFor(0, numberChunks_, 1, [&](int firstChunk, int lastChunk) {
+    for (int iChunk = firstChunk; iChunk < lastChunk; iChunk++)
+      clpMpsColumns(chunkStart[iChunk], chunkStart[iChunk + 1], rows,
+        rowNumber.data(), smallElement, chunks[iChunk]);
+  },
+    numberChunks_);
+  double time3 = CoinGetTimeOfDay();
+  sectionTime_[MPS_COLUMNS] = time3 - time2;
+  // Join chunks - a chunk may start with the end of previous column
+  std::vector< CoinBigIndex > elementBase(numberChunks_);
+  CoinBigIndex numberElements = 0;
+  int maximumColumns = 0;
+  for (int iChunk = 0; iChunk < numberChunks_; iChunk++) {
+    if (chunks[iChunk].bad)
+      return 1;
+    elementBase[iChunk] = numberElements;
+    numberElements += static_cast< CoinBigIndex >(chunks[iChunk].row.size());
+    maximumColumns += static_cast< int >(chunks[iChunk].name.size());
+  }
+  std::vector< const char * > columnName;
+  std::vector< int > columnNameLength;
+  columnName.reserve(maximumColumns);
+  columnNameLength.reserve(maximumColumns);
+  CoinBigIndex *start = new CoinBigIndex[maximumColumns + 1];
+  objective_ = new double[maximumColumns];
+  std::vector< char > integer;
+  integer.reserve(maximumColumns);
+  bool integerOn = false;
+  bool anyInteger = false;
+  bool markerSinceColumn = false;
+  bool lastObjectiveGiven = false;
+  for (int iChunk = 0; iChunk < numberChunks_; iChunk++) {
+    const ClpMpsChunk &chunk = chunks[iChunk];
+    int numberInChunk = static_cast< int >(chunk.name.size());
+    int numberMarkers = static_cast< int >(chunk.markerColumn.size());
+    int iMarker = 0;
+    while (iMarker < numberMarkers && !chunk.markerColumn[iMarker]) {
+      integerOn = chunk.markerInteger[iMarker++] != 0;
+      markerSinceColumn = true;
+    }
+    int iColumn = 0;
+    if (numberInChunk && numberColumns_ && !markerSinceColumn
+      && columnNameLength.back() == chunk.nameLength[0]
+      && !memcmp(columnName.back(), chunk.name[0], chunk.nameLength[0])) {
+      // continuation of last column - elements follow on
+      if (chunk.objectiveGiven[0]) {
+        if (lastObjectiveGiven) {
+          delete[] start;
+          return 1;
+        }
+        objective_[numberColumns_ - 1] = chunk.objective[0];
+        lastObjectiveGiven = true;
+      }
+      iColumn = 1;
+    }
+    for (; iColumn < numberInChunk; iColumn++) {
+      while (iMarker < numberMarkers && chunk.markerColumn[iMarker] == iColumn)
+        integerOn = chunk.markerInteger[iMarker++] != 0;
+      start[numberColumns_] = elementBase[iChunk] + chunk.start[iColumn];
+      objective_[numberColumns_] = chunk.objective[iColumn];
+      lastObjectiveGiven = chunk.objectiveGiven[iColumn] != 0;
+      columnName.push_back(chunk.name[iColumn]);
+      columnNameLength.push_back(chunk.nameLength[iColumn]);
+      integer.push_back(integerOn ? 1 : 0);
+      anyInteger = anyInteger || integerOn;
+      numberColumns_++;
+      markerSinceColumn = false;
+    }
+    while (iMarker < numberMarkers) {
+      integerOn = chunk.markerInteger[iMarker++] != 0;
+      markerSinceColumn = true;
+    }
+  }
+  start[numberColumns_] = numberElements;
+  ClpMpsNames columns(numberColumns_);
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    if (!columns.add(columnName[iColumn], columnNameLength[iColumn])) {
+      delete[] start;
+      return 1;
+    }
+  }
+  // Copy elements
+  double *element = new double[numberElements];
+  int *row = new int[numberElements];
+  clpParallelFor(0, numberChunks_, 1, [&](int firstChunk, int lastChunk) {
+    for (int iChunk = firstChunk; iChunk < lastChunk; iChunk++) {
+      const ClpMpsChunk &chunk = chunks[iChunk];
+      CoinBigIndex n = static_cast< CoinBigIndex >(chunk.row.size());
+      if (n) {
+        CoinMemcpyN(&chunk.row[0], n, row + elementBase[iChunk]);
+        CoinMemcpyN(&chunk.element[0], n, element + elementBase[iChunk]);
+      }
+    }
+  },
+    numberChunks_);
+  // An element given twice is left to CoinMpsIO (a column may be in several chunks)
+  std::atomic< bool > duplicate(false);
+  clpParallelFor(0, numberColumns_, 1024, [&](int firstColumn, int lastColumn) {
+    std::vector< int > mark(numberRows_, -1);
+    for (int iColumn = firstColumn; iColumn < lastColumn; iColumn++) {
+      for (CoinBigIndex j = start[iColumn]; j < start[iColumn + 1]; j++) {
+        int iRow = row[j];
+        if (mark[iRow] == iColumn) {
+          duplicate = true;
+          return;
+        }
+        mark[iRow] = iColumn;
+      }
+    }
+  });
+  if (duplicate) {
+    delete[] start;
+    delete[] element;
+    delete[] row;
+    return 1;
+  }
+  int *lengths = new int[numberColumns_];
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++)
+    lengths[iColumn] = static_cast< int >(start[iColumn + 1] - start[iColumn]);
+  matrix_ = new CoinPackedMatrix();
+  matrix_->assignMatrix(true, numberRows_, numberColumns_, numberElements,
+    element, row, start, lengths);
+  // Names
+  nameStart_ = new CoinBigIndex[numberRows_ + numberColumns_ + 1];
+  CoinBigIndex nameSize = 0;
+  int iName = 0;
+  for (int i = 0; i < rows.size(); i++) {
+    if (rowNumber[i] >= 0) {
+      nameStart_[iName++] = nameSize;
+      nameSize += rows.length(i) + 1;
+    }
+  }
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    nameStart_[iName++] = nameSize;
+    nameSize += columnNameLength[iColumn] + 1;
+  }
+  nameStart_[iName] = nameSize;
+  names_ = new char[nameSize];
+  iName = 0;
+  for (int i = 0; i < rows.size(); i++) {
+    if (rowNumber[i] >= 0) {
+      char *put = names_ + nameStart_[iName++];
+      memcpy(put, rows.name(i), rows.length(i));
+      put[rows.length(i)] = '\0';
+    }
+  }
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    char *put = names_ + nameStart_[iName++];
+    memcpy(put, columnName[iColumn], columnNameLength[iColumn]);
+    put[columnNameLength[iColumn]] = '\0';
+  }
+  double time4 = CoinGetTimeOfDay();
+  sectionTime_[MPS_MATRIX] = time4 - time3;
+  // RHS and RANGES
+  rowLower_ = new double[numberRows_];
+  rowUpper_ = new double[numberRows_];
+  for (int iRow = 0; iRow < numberRows_; iRow++) {
+    rowLower_[iRow] = rowType[iRow] == 'L' ? -COIN_DBL_MAX : 0.0;
+    rowUpper_[iRow] = rowType[iRow] == 'G' ? COIN_DBL_MAX : 0.0;
+  }
+  for (int section = 3; section < 5; section++) {
+    const char *setName = NULL;
+    int setLength = 0;
+    for (const char *p = sectionStart[section]; p && p < sectionEnd[section];) {
+      int n = clpMpsTokens(p, token, length, 5);
+      if (!n)
+        continue;
+      if (n < 2 || n > 5)
+        return 1;
+      int k = 0;
+      if ((n & 1) != 0) {
+        // has set name - only one set allowed
+        if (!setName) {
+          setName = token[0];
+          setLength = length[0];
+        } else if (setLength != length[0] || memcmp(setName, token[0], length[0])) {
+          return 1;
+        }
+        k = 1;
+      }
+      for (; k < n; k += 2) {
+        int iName = rows.find(token[k], length[k]);
+        double value;
+        if (iName < 0 || !clpMpsValue(token[k + 1], length[k + 1], value))
+          return 1;
+        int iRow = rowNumber[iName];
+        if (section == 3) {
+          if (iRow < 0) {
+            objectiveOffset_ = value;
+            continue;
+          }
+          value = clpMpsInfinite(value);
+          if (rowType[iRow] == 'E') {
+            rowLower_[iRow] = value;
+            rowUpper_[iRow] = value;
+          } else if (rowType[iRow] == 'L') {
+            rowUpper_[iRow] = value;
+          } else {
+            rowLower_[iRow] = value;
+          }
+        } else {
+          if (iRow < 0)
+            return 1;
+          double range = fabs(value);
+          if (rowType[iRow] == 'E') {
+            if (value > 0.0)
+              rowUpper_[iRow] = rowLower_[iRow] + range;
+            else
+              rowLower_[iRow] = rowUpper_[iRow] - range;
+          } else if (rowType[iRow] == 'L') {
+            rowLower_[iRow] = rowUpper_[iRow] - range;
+          } else {
+            rowUpper_[iRow] = rowLower_[iRow] + range;
+          }
+        }
+      }
+    }
+  }
+  // BOUNDS
+  columnLower_ = new double[numberColumns_];
+  columnUpper_ = new double[numberColumns_];
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    columnLower_[iColumn] = 0.0;
+    columnUpper_[iColumn] = COIN_DBL_MAX;
+  }
+  // integer columns must be given upper bound (CoinMpsIO knows what to do)
+  std::vector< char > upperGiven(numberColumns_, 0);
+  const char *setName = NULL;
+  int setLength = 0;
+  for (const char *p = sectionStart[5]; p && p < sectionEnd[5];) {
+    int n = clpMpsTokens(p, token, length, 5);
+    if (!n)
+      continue;
+    if (n < 2 || n > 4 || length[0] != 2)
+      return 1;
+    char type[3];
+    type[0] = static_cast< char >(toupper(token[0][0]));
+    type[1] = static_cast< char >(toupper(token[0][1]));
+    type[2] = '\0';
+    bool needsValue = strcmp(type, "FR") && strcmp(type, "MI") && strcmp(type, "PL")
+      && strcmp(type, "BV");
+    // work out if there is a set name
+    int k;
+    if (needsValue) {
+      if (n == 2)
+        return 1;
+      k = n - 2;
+    } else if (n == 2) {
+      k = 1;
+    } else if (n == 4) {
+      k = 2;
+    } else {
+      // type set column or type column value
+      k = columns.find(token[2], length[2]) >= 0 ? 2 : 1;
+    }
+    if (k == 2) {
+      if (!setName) {
+        setName = token[1];
+        setLength = length[1];
+      } else if (setLength != length[1] || memcmp(setName, token[1], length[1])) {
+        return 1;
+      }
+    }
+    int iColumn = columns.find(token[k], length[k]);
+    if (iColumn < 0)
+      return 1;
+    double value = 0.0;
+    if (k + 1 < n) {
+      if (!clpMpsValue(token[k + 1], length[k + 1], value))
+        return 1;
+      value = clpMpsInfinite(value);
+    }
+    if (!strcmp(type, "UP")) {
+      if (value < 0.0 && columnLower_[iColumn] == 0.0)
+        columnLower_[iColumn] = -COIN_DBL_MAX;
+      columnUpper_[iColumn] = value;
+      upperGiven[iColumn] = 1;
+    } else if (!strcmp(type, "LO")) {
+      columnLower_[iColumn] = value;
+    } else if (!strcmp(type, "FX")) {
+      columnLower_[iColumn] = value;
+      columnUpper_[iColumn] = value;
+      upperGiven[iColumn] = 1;
+    } else if (!strcmp(type, "FR")) {
+      columnLower_[iColumn] = -COIN_DBL_MAX;
+      columnUpper_[iColumn] = COIN_DBL_MAX;
+    } else if (!strcmp(type, "MI")) {
+      columnLower_[iColumn] = -COIN_DBL_MAX;
+    } else if (!strcmp(type, "PL")) {
+      columnUpper_[iColumn] = COIN_DBL_MAX;
+      upperGiven[iColumn] = 1;
+    } else if (!strcmp(type, "BV")) {
+      columnLower_[iColumn] = 0.0;
+      columnUpper_[iColumn] = 1.0;
+      upperGiven[iColumn] = 1;
+      integer[iColumn] = 1;
+      anyInteger = true;
+    } else if (!strcmp(type, "LI")) {
+      columnLower_[iColumn] = value;
+      integer[iColumn] = 1;
+      anyInteger = true;
+    } else if (!strcmp(type, "UI")) {
+      columnUpper_[iColumn] = value;
+      upperGiven[iColumn] = 1;
+      integer[iColumn] = 1;
+      anyInteger = true;
+    } else {
+      return 1;
+    }
+  }
+  if (anyInteger) {
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+      if (integer[iColumn] && !upperGiven[iColumn])
+        return 1;
+    }
+    integerType_ = new char[numberColumns_];
+    CoinMemcpyN(&integer[0], numberColumns_, integerType_);
+  }
+  // file no longer needed
+  delete[] buffer_;
+  buffer_ = NULL;
+  sectionTime_[MPS_RHS_BOUNDS] = CoinGetTimeOfDay() - time4;
+  return 0;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,185 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef ClpMpsReader_H
+#define ClpMpsReader_H
+
+#include "ClpConfig.h"
+#include "CoinTypes.h"
+
+class CoinPackedMatrix;
+
+/** Fast reader for large linear MPS files
+
+This reads the whole file into memory (through CoinFileInput so gzip
+and bzip2 files are decompressed as they are read - an uncompressed
+file goes straight into a buffer of its size), finds the sections
+and then splits the COLUMNS section into chunks which are tokenized as
+ClpThreadPool tasks.  Each chunk produces its part of the column
+ordered matrix and as columns are contiguous in an MPS file the parts
+are simply concatenated, so the result does not depend on the number of
+threads.
+
+Only what a linear model needs is handled - NAME, ROWS, COLUMNS
+(with integer markers), RHS, RANGES, BOUNDS and ENDATA with names
+which do not contain blanks.  Anything else (OBJSENSE, QUADOBJ, SOS,
+several N rows, semi-continuous bounds, an element given twice ...)
+or any error makes readMps return 1 so that the caller can fall back to CoinMpsIO which
+gives proper messages.
+*/
+
+class CLPLIB_EXPORT ClpMpsReader {
+
+public:
+  /// Sections for timing
+  enum Section {
+    /// Reading and decompressing
+    MPS_READ = 0,
+    /// Finding sections and NAME/ROWS
+    MPS_ROWS,
+    /// Tokenizing COLUMNS
+    MPS_COLUMNS,
+    /// Building matrix and column names
+    MPS_MATRIX,
+    /// RHS, RANGES and BOUNDS
+    MPS_RHS_BOUNDS,
+    MPS_NUMBER_SECTIONS
+  };
+
+  /**@name Constructors and destructor */
+  //@{
+  /// Default constructor
+  ClpMpsReader();
+  /// Destructor
+  ~ClpMpsReader();
+  //@}
+
+  /**@name Reading */
+  //@{
+  /** Read file.  Returns 0 if success, -1 if file can not be opened
+      and 1 if the file needs CoinMpsIO (see class description).
+      Chunks are solved as tasks on ClpThreadPool::pool().
+  */
+  int readMps(const char *fileName);
+  /// Elements smaller than this are dropped (default 1.0e-14)
+  inline void setSmallElementValue(double value)
+  {
+    smallElement_ = value;
+  }
+  /** Bytes of COLUMNS section in each chunk (default 1 MiB).  Only
+      worth changing for testing how chunks are joined. */
+  inline void setChunkSize(int value)
+  {
+    chunkSize_ = value > 0 ? value : 1;
+  }
+  inline int chunkSize() const
+  {
+    return chunkSize_;
+  }
+  //@}
+
+  /**@name Results (valid after successful readMps) */
+  //@{
+  inline int numberRows() const
+  {
+    return numberRows_;
+  }
+  inline int numberColumns() const
+  {
+    return numberColumns_;
+  }
+  /// Matrix by column - caller owns
+  CoinPackedMatrix *takeMatrix();
+  inline const double *rowLower() const
+  {
+    return rowLower_;
+  }
+  inline const double *rowUpper() const
+  {
+    return rowUpper_;
+  }
+  inline const double *columnLower() const
+  {
+    return columnLower_;
+  }
+  inline const double *columnUpper() const
+  {
+    return columnUpper_;
+  }
+  inline const double *objective() const
+  {
+    return objective_;
+  }
+  /// Integer markers - NULL if none
+  inline const char *integerColumns() const
+  {
+    return integerType_;
+  }
+  /// Constant from RHS of objective row
+  inline double objectiveOffset() const
+  {
+    return objectiveOffset_;
+  }
+  inline const char *problemName() const
+  {
+    return problemName_;
+  }
+  /// Row name (null terminated)
+  inline const char *rowName(int iRow) const
+  {
+    return names_ + nameStart_[iRow];
+  }
+  /// Column name (null terminated)
+  inline const char *columnName(int iColumn) const
+  {
+    return names_ + nameStart_[numberRows_ + iColumn];
+  }
+  /// Wall clock seconds spent in a section
+  inline double sectionTime(int section) const
+  {
+    return sectionTime_[section];
+  }
+  /// Number of chunks COLUMNS was split into
+  inline int numberChunks() const
+  {
+    return numberChunks_;
+  }
+  //@}
+
+private:
+  /// Free everything
+  void gutsOfDelete();
+  /// Disable copy
+  ClpMpsReader(const ClpMpsReader &);
+  ClpMpsReader &operator=(const ClpMpsReader &);
+
+  /**@name Data */
+  //@{
+  /// File contents (terminated by "\n\0")
+  char *buffer_;
+  /// Names - rows then columns, each null terminated
+  char *names_;
+  /// Start of each name in names_
+  CoinBigIndex *nameStart_;
+  double *rowLower_;
+  double *rowUpper_;
+  double *columnLower_;
+  double *columnUpper_;
+  double *objective_;
+  char *integerType_;
+  CoinPackedMatrix *matrix_;
+  char problemName_[256];
+  double objectiveOffset_;
+  double smallElement_;
+  double sectionTime_[MPS_NUMBER_SECTIONS];
+  int numberRows_;
+  int numberColumns_;
+  int numberChunks_;
+  int chunkSize_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,760 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+
+#include <math.h>
+
+#include "CoinFinite.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "ClpSimplex.hpp"
+#include "ClpNetworkMatrix.hpp"
+#include "ClpObjective.hpp"
+#include "ClpNetworkSimplex.hpp"
+
+// Bounds at least this big are infinite
+#define CLP_NETWORK_INFINITY 1.0e30
+
+ClpNetworkSimplex::ClpNetworkSimplex()
+  : numberRows_(0)
+  , numberColumns_(0)
+  , numberFlipped_(0)
+  , numberArcs_(0)
+  , numberIterations_(0)
+  , blockSize_(0)
+  , nextArc_(0)
+  , dualTolerance_(1.0e-7)
+  , primalTolerance_(1.0e-7)
+  , artificialCost_(0.0)
+  , direction_(1.0)
+  , tail_(NULL)
+  , head_(NULL)
+  , cost_(NULL)
+  , lower_(NULL)
+  , upper_(NULL)
+  , flow_(NULL)
+  , state_(NULL)
+  , flipped_(NULL)
+  , parent_(NULL)
+  , predecessor_(NULL)
+  , depth_(NULL)
+  , thread_(NULL)
+  , reverseThread_(NULL)
+  , potential_(NULL)
+  , work_(NULL)
+{
+}
+ClpNetworkSimplex::~ClpNetworkSimplex()
+{
+  gutsOfDelete();
+}
+void ClpNetworkSimplex::gutsOfDelete()
+{
+  delete[] tail_;
+  delete[] head_;
+  delete[] cost_;
+  delete[] lower_;
+  delete[] upper_;
+  delete[] flow_;
+  delete[] state_;
+  delete[] flipped_;
+  delete[] parent_;
+  delete[] predecessor_;
+  delete[] depth_;
+  delete[] thread_;
+  delete[] reverseThread_;
+  delete[] potential_;
+  delete[] work_;
+  tail_ = NULL;
+  head_ = NULL;
+  cost_ = NULL;
+  lower_ = NULL;
+  upper_ = NULL;
+  flow_ = NULL;
+  state_ = NULL;
+  flipped_ = NULL;
+  parent_ = NULL;
+  predecessor_ = NULL;
+  depth_ = NULL;
+  thread_ = NULL;
+  reverseThread_ = NULL;
+  potential_ = NULL;
+  work_ = NULL;
+  numberRows_ = 0;
+  numberColumns_ = 0;
+  numberFlipped_ = 0;
+  numberArcs_ = 0;
+  numberIterations_ = 0;
+}
+// Finds set of row and its parity relative to set (path compression)
+static int findSet(int *set, char *parity, int iRow, int &rowParity)
+{
+  int root = iRow;
+  int total = 0;
+  while (set[root] != root) {
+    total ^= parity[root];
+    root = set[root];
+  }
+  rowParity = total;
+  // compress - parity of each node on path to root
+  int node = iRow;
+  while (set[node] != root && node != root) {
+    int next = set[node];
+    int nextParity = total ^ parity[node];
+    set[node] = root;
+    parity[node] = static_cast< char >(total);
+    total = nextParity;
+    node = next;
+  }
+  return root;
+}
+/* Takes data from model - returns 0 if pure network, 1 if not.
+   Rows which have to be multiplied by -1 are found by two colouring -
+   for a column with two elements the rows must be flipped the same way
+   if the elements differ in sign and opposite ways if they are the same.
+*/
+int ClpNetworkSimplex::load(const ClpSimplex *model)
+{
+  gutsOfDelete();
+  const ClpMatrixBase *clpMatrix = model->clpMatrix();
+  if (!clpMatrix || !model->objectiveAsObject() || model->objectiveAsObject()->type() != 1 || model->rowObjective())
+    return 1;
+  int numberRows = model->numberRows();
+  int numberColumns = model->numberColumns();
+  if (!numberRows || !numberColumns)
+    return 1;
+  // two ends of each column (-1 if none) and signs
+  int *rowA = new int[2 * numberColumns];
+  int *rowB = rowA + numberColumns;
+  char *signA = new char[2 * numberColumns];
+  char *signB = signA + numberColumns;
+  bool network = true;
+#ifndef NO_RTTI
+  const ClpNetworkMatrix *networkMatrix = dynamic_cast< const ClpNetworkMatrix * >(clpMatrix);
+#else
+  const ClpNetworkMatrix *networkMatrix = NULL;
+  if (clpMatrix->type() == 11)
+    networkMatrix = static_cast< const ClpNetworkMatrix * >(clpMatrix);
+#endif
+  if (networkMatrix) {
+    // -1 then +1 for each column, negative index means missing
+    const int *indices = networkMatrix->getIndices();
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      rowA[iColumn] = indices[2 * iColumn];
+      signA[iColumn] = -1;
+      rowB[iColumn] = indices[2 * iColumn + 1];
+      signB[iColumn] = 1;
+      if (rowA[iColumn] < 0) {
+        rowA[iColumn] = rowB[iColumn];
+        signA[iColumn] = 1;
+        rowB[iColumn] = -1;
+      }
+    }
+  } else {
+    const CoinPackedMatrix *matrix = clpMatrix->getPackedMatrix();
+    if (!matrix->isColOrdered()) {
+      network = false;
+    } else {
+      const double *element = matrix->getElements();
+      const int *row = matrix->getIndices();
+      const CoinBigIndex *columnStart = matrix->getVectorStarts();
+      const int *columnLength = matrix->getVectorLengths();
+      for (int iColumn = 0; iColumn < numberColumns && network; iColumn++) {
+        int n = 0;
+        rowA[iColumn] = -1;
+        rowB[iColumn] = -1;
+        for (CoinBigIndex j = columnStart[iColumn];
+             j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+          double value = element[j];
+          if (!value)
+            continue;
+          if ((value != 1.0 && value != -1.0) || n == 2) {
+            network = false;
+            break;
+          }
+          if (!n) {
+            rowA[iColumn] = row[j];
+            signA[iColumn] = value > 0.0 ? 1 : -1;
+          } else {
+            rowB[iColumn] = row[j];
+            signB[iColumn] = value > 0.0 ? 1 : -1;
+          }
+          n++;
+        }
+      }
+    }
+    clpMatrix->releasePackedMatrix();
+  }
+  char *flipped = NULL;
+  if (network) {
+    // two colour
+    int *set = new int[numberRows];
+    char *parity = new char[numberRows];
+    for (int iRow = 0; iRow < numberRows; iRow++) {
+      set[iRow] = iRow;
+      parity[iRow] = 0;
+    }
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      if (rowB[iColumn] < 0)
+        continue;
+      int iRow = rowA[iColumn];
+      int jRow = rowB[iColumn];
+      if (iRow == jRow) {
+        network = false;
+        break;
+      }
+      // flip(iRow) xor flip(jRow) must be this
+      int wanted = (signA[iColumn] == signB[iColumn]) ? 1 : 0;
+      int iParity;
+      int jParity;
+      int iSet = findSet(set, parity, iRow, iParity);
+      int jSet = findSet(set, parity, jRow, jParity);
+      if (iSet == jSet) {
+        if ((iParity ^ jParity) != wanted) {
+          network = false;
+          break;
+        }
+      } else {
+        set[jSet] = iSet;
+        parity[jSet] = static_cast< char >(iParity ^ jParity ^ wanted);
+      }
+    }
+    if (network) {
+      flipped = new char[numberRows];
+      numberFlipped_ = 0;
+      for (int iRow = 0; iRow < numberRows; iRow++) {
+        int iParity;
+        findSet(set, parity, iRow, iParity);
+        flipped[iRow] = static_cast< char >(iParity);
+        numberFlipped_ += iParity;
+      }
+    }
+    delete[] set;
+    delete[] parity;
+  }
+  if (!network) {
+    delete[] rowA;
+    delete[] signA;
+    numberFlipped_ = 0;
+    return 1;
+  }
+  numberRows_ = numberRows;
+  numberColumns_ = numberColumns;
+  flipped_ = flipped;
+  int numberNodes = numberRows_ + 1;
+  int root = numberRows_;
+  numberArcs_ = numberColumns_ + 2 * numberRows_;
+  tail_ = new int[numberArcs_];
+  head_ = new int[numberArcs_];
+  cost_ = new double[numberArcs_];
+  lower_ = new double[numberArcs_];
+  upper_ = new double[numberArcs_];
+  flow_ = new double[numberArcs_];
+  state_ = new signed char[numberArcs_];
+  parent_ = new int[numberNodes];
+  predecessor_ = new int[numberNodes];
+  depth_ = new int[numberNodes];
+  thread_ = new int[numberNodes];
+  reverseThread_ = new int[numberNodes];
+  potential_ = new double[numberNodes];
+  work_ = new int[4 * numberNodes];
+  direction_ = model->optimizationDirection();
+  dualTolerance_ = model->dualTolerance();
+  primalTolerance_ = model->primalTolerance();
+  const double *objective = model->objective();
+  const double *columnLower = model->columnLower();
+  const double *columnUpper = model->columnUpper();
+  const double *rowLower = model->rowLower();
+  const double *rowUpper = model->rowUpper();
+  double maximumCost = 0.0;
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    int from = root;
+    int to = root;
+    int iRow = rowA[iColumn];
+    if (iRow >= 0) {
+      if ((signA[iColumn] > 0) != (flipped_[iRow] != 0))
+        to = iRow;
+      else
+        from = iRow;
+    }
+    iRow = rowB[iColumn];
+    if (iRow >= 0) {
+      if ((signB[iColumn] > 0) != (flipped_[iRow] != 0))
+        to = iRow;
+      else
+        from = iRow;
+    }
+    tail_[iColumn] = from;
+    head_[iColumn] = to;
+    double value = direction_ * objective[iColumn];
+    cost_[iColumn] = value;
+    maximumCost = CoinMax(maximumCost, fabs(value));
+    lower_[iColumn] = columnLower[iColumn];
+    upper_[iColumn] = columnUpper[iColumn];
+  }
+  delete[] rowA;
+  delete[] signA;
+  for (int iRow = 0; iRow < numberRows_; iRow++) {
+    int iArc = numberColumns_ + iRow;
+    tail_[iArc] = iRow;
+    head_[iArc] = root;
+    cost_[iArc] = 0.0;
+    if (!flipped_[iRow]) {
+      lower_[iArc] = rowLower[iRow];
+      upper_[iArc] = rowUpper[iRow];
+    } else {
+      lower_[iArc] = -rowUpper[iRow];
+      upper_[iArc] = -rowLower[iRow];
+    }
+  }
+  // big enough that artificials never stay in if feasible
+  artificialCost_ = (maximumCost + 1.0) * numberNodes;
+  return 0;
+}
+/* Starting flows - nonbasic arcs at a finite bound (zero if free).
+   Node i then has some excess which its slack takes if that is within
+   the row bounds (with room to increase so tree is strongly feasible),
+   otherwise the slack is put at its nearest bound and an artificial
+   takes the rest.  Tree is a star from root.
+*/
+void ClpNetworkSimplex::createTree()
+{
+  int root = numberRows_;
+  double *excess = potential_;
+  CoinZeroN(excess, numberRows_ + 1);
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    double value;
+    if (lower_[iColumn] > -CLP_NETWORK_INFINITY) {
+      value = lower_[iColumn];
+      state_[iColumn] = 1;
+    } else if (upper_[iColumn] < CLP_NETWORK_INFINITY) {
+      value = upper_[iColumn];
+      state_[iColumn] = -1;
+    } else {
+      value = 0.0;
+      state_[iColumn] = 2;
+    }
+    flow_[iColumn] = value;
+    excess[head_[iColumn]] += value;
+    excess[tail_[iColumn]] -= value;
+  }
+  int firstArtificial = numberColumns_ + numberRows_;
+  for (int iRow = 0; iRow < numberRows_; iRow++) {
+    int iSlack = numberColumns_ + iRow;
+    int iArtificial = firstArtificial + iRow;
+    double value = excess[iRow];
+    double lower = lower_[iSlack];
+    double upper = upper_[iSlack];
+    cost_[iArtificial] = artificialCost_;
+    lower_[iArtificial] = 0.0;
+    upper_[iArtificial] = COIN_DBL_MAX;
+    parent_[iRow] = root;
+    depth_[iRow] = 1;
+    if (value >= lower && value < upper) {
+      // slack basic
+      flow_[iSlack] = value;
+      state_[iSlack] = 0;
+      tail_[iArtificial] = iRow;
+      head_[iArtificial] = root;
+      flow_[iArtificial] = 0.0;
+      state_[iArtificial] = 1;
+      predecessor_[iRow] = iSlack;
+      potential_[iRow] = 0.0;
+    } else {
+      double slackValue;
+      if (value < lower) {
+        slackValue = lower;
+        state_[iSlack] = 1;
+      } else {
+        slackValue = upper;
+        state_[iSlack] = -1;
+      }
+      flow_[iSlack] = slackValue;
+      value -= slackValue;
+      state_[iArtificial] = 0;
+      predecessor_[iRow] = iArtificial;
+      if (value >= 0.0) {
+        tail_[iArtificial] = iRow;
+        head_[iArtificial] = root;
+        flow_[iArtificial] = value;
+        potential_[iRow] = -artificialCost_;
+      } else {
+        tail_[iArtificial] = root;
+        head_[iArtificial] = iRow;
+        flow_[iArtificial] = -value;
+        potential_[iRow] = artificialCost_;
+      }
+    }
+  }
+  parent_[root] = -1;
+  predecessor_[root] = -1;
+  depth_[root] = 0;
+  potential_[root] = 0.0;
+  thread_[root] = 0;
+  reverseThread_[0] = root;
+  for (int iRow = 0; iRow < numberRows_; iRow++) {
+    thread_[iRow] = iRow + 1;
+    reverseThread_[iRow + 1] = iRow;
+  }
+  int numberSearch = numberColumns_ + numberRows_;
+  blockSize_ = CoinMax(static_cast< int >(sqrt(static_cast< double >(numberSearch))), 10);
+  nextArc_ = 0;
+}
+/* Block search - scans blocks of arcs starting where last search
+   stopped and returns best in first block which has a candidate.
+   Artificials are never priced (once out they stay out).
+*/
+int ClpNetworkSimplex::findEntering()
+{
+  int numberSearch = numberColumns_ + numberRows_;
+  const int *COIN_RESTRICT tail = tail_;
+  const int *COIN_RESTRICT head = head_;
+  const double *COIN_RESTRICT cost = cost_;
+  const signed char *COIN_RESTRICT state = state_;
+  const double *COIN_RESTRICT potential = potential_;
+  double best = dualTolerance_;
+  int bestArc = -1;
+  int iArc = nextArc_;
+  int count = blockSize_;
+  for (int k = 0; k < numberSearch; k++) {
+    int arcState = state[iArc];
+    if (arcState) {
+      double dj = cost[iArc] + potential[tail[iArc]] - potential[head[iArc]];
+      double infeasibility = (arcState != 2) ? -arcState * dj : fabs(dj);
+      if (infeasibility > best) {
+        best = infeasibility;
+        bestArc = iArc;
+      }
+    }
+    if (++iArc == numberSearch)
+      iArc = 0;
+    if (!--count) {
+      if (bestArc >= 0)
+        break;
+      count = blockSize_;
+    }
+  }
+  nextArc_ = iArc;
+  return bestArc;
+}
+/* Flow goes round cycle from first along entering arc to second, up
+   tree to join and down to first.  The leaving arc is the last blocking
+   arc met going round from join (Cunningham) - so on the second side
+   ties go to the one nearest join, then the entering arc itself, then
+   on first side the one nearest first.
+*/
+int ClpNetworkSimplex::pivot(int entering)
+{
+  int *COIN_RESTRICT parent = parent_;
+  int *COIN_RESTRICT predecessor = predecessor_;
+  const int *COIN_RESTRICT depth = depth_;
+  const int *COIN_RESTRICT tail = tail_;
+  const int *COIN_RESTRICT head = head_;
+  double *COIN_RESTRICT flow = flow_;
+  const double *COIN_RESTRICT lower = lower_;
+  const double *COIN_RESTRICT upper = upper_;
+  int direction;
+  if (state_[entering] != 2) {
+    direction = state_[entering];
+  } else {
+    double dj = cost_[entering] + potential_[tail[entering]] - potential_[head[entering]];
+    direction = dj < 0.0 ? 1 : -1;
+  }
+  int first;
+  int second;
+  double delta;
+  if (direction > 0) {
+    first = tail[entering];
+    second = head[entering];
+    delta = upper[entering] < CLP_NETWORK_INFINITY ? upper[entering] - flow[entering] : COIN_DBL_MAX;
+  } else {
+    first = head[entering];
+    second = tail[entering];
+    delta = lower[entering] > -CLP_NETWORK_INFINITY ? flow[entering] - lower[entering] : COIN_DBL_MAX;
+  }
+  // find join
+  int u = first;
+  int v = second;
+  while (u != v) {
+    if (depth[u] > depth[v]) {
+      u = parent[u];
+    } else if (depth[v] > depth[u]) {
+      v = parent[v];
+    } else {
+      u = parent[u];
+      v = parent[v];
+    }
+  }
+  int join = u;
+  int result = 0;
+  int uOut = -1;
+  // first side - flow goes down from parent
+  for (u = first; u != join; u = parent[u]) {
+    int iArc = predecessor[u];
+    double room;
+    if (head[iArc] == u)
+      room = upper[iArc] < CLP_NETWORK_INFINITY ? upper[iArc] - flow[iArc] : COIN_DBL_MAX;
+    else
+      room = lower[iArc] > -CLP_NETWORK_INFINITY ? flow[iArc] - lower[iArc] : COIN_DBL_MAX;
+    if (room < delta) {
+      delta = room;
+      uOut = u;
+      result = 1;
+    }
+  }
+  // second side - flow goes up to parent
+  for (u = second; u != join; u = parent[u]) {
+    int iArc = predecessor[u];
+    double room;
+    if (tail[iArc] == u)
+      room = upper[iArc] < CLP_NETWORK_INFINITY ? upper[iArc] - flow[iArc] : COIN_DBL_MAX;
+    else
+      room = lower[iArc] > -CLP_NETWORK_INFINITY ? flow[iArc] - lower[iArc] : COIN_DBL_MAX;
+    if (room <= delta) {
+      delta = room;
+      uOut = u;
+      result = 2;
+    }
+  }
+  if (delta >= CLP_NETWORK_INFINITY)
+    return 1; // unbounded
+  if (delta < 0.0)
+    delta = 0.0;
+  if (delta) {
+    flow[entering] += direction * delta;
+    for (u = first; u != join; u = parent[u]) {
+      int iArc = predecessor[u];
+      if (head[iArc] == u)
+        flow[iArc] += delta;
+      else
+        flow[iArc] -= delta;
+    }
+    for (u = second; u != join; u = parent[u]) {
+      int iArc = predecessor[u];
+      if (tail[iArc] == u)
+        flow[iArc] += delta;
+      else
+        flow[iArc] -= delta;
+    }
+  }
+  if (!result) {
+    // bound flip
+    if (direction > 0) {
+      flow[entering] = upper[entering];
+      state_[entering] = -1;
+    } else {
+      flow[entering] = lower[entering];
+      state_[entering] = 1;
+    }
+    return 0;
+  }
+  int leaving = predecessor[uOut];
+  bool increasing = (result == 1) ? (head[leaving] == uOut) : (tail[leaving] == uOut);
+  if (increasing) {
+    flow[leaving] = upper[leaving];
+    state_[leaving] = -1;
+  } else {
+    flow[leaving] = lower[leaving];
+    state_[leaving] = 1;
+  }
+  state_[entering] = 0;
+  if (result == 1)
+    updateTree(entering, first, second, uOut);
+  else
+    updateTree(entering, second, first, uOut);
+  return 0;
+}
+/* Subtree under uOut is cut off and hung from vIn by the entering arc
+   at uIn.  The stem (path from uIn up to uOut) is reversed.  Each stem
+   node w(i) keeps the part of its subtree not under w(i-1) in the same
+   order, so the new preorder is those parts for w(0), w(1) ... joined
+   end to end and put straight after vIn.  One walk along the old thread
+   finds where the parts end and updates depths and potentials.
+*/
+void ClpNetworkSimplex::updateTree(int entering, int uIn, int vIn, int uOut)
+{
+  int numberNodes = numberRows_ + 1;
+  int *COIN_RESTRICT parent = parent_;
+  int *COIN_RESTRICT predecessor = predecessor_;
+  int *COIN_RESTRICT depth = depth_;
+  int *COIN_RESTRICT thread = thread_;
+  int *COIN_RESTRICT reverseThread = reverseThread_;
+  double *COIN_RESTRICT potential = potential_;
+  int *COIN_RESTRICT stem = work_;
+  int *COIN_RESTRICT last = stem + numberNodes;
+  int *COIN_RESTRICT beforeStem = last + numberNodes;
+  int *COIN_RESTRICT afterLast = beforeStem + numberNodes;
+  int numberStem = 0;
+  for (int node = uIn; node != uOut; node = parent[node])
+    stem[numberStem++] = node;
+  stem[numberStem++] = uOut;
+  int top = numberStem - 1;
+  // new potential of uIn
+  double newPotential;
+  if (tail_[entering] == uIn)
+    newPotential = potential[vIn] - cost_[entering];
+  else
+    newPotential = potential[vIn] + cost_[entering];
+  double change = newPotential - potential[uIn];
+  // old depth of stem(i) is outDepth+top-i, new is inDepth+i
+  int outDepth = depth[uOut];
+  int inDepth = depth[vIn] + 1;
+  int before = reverseThread[uOut];
+  // walk subtree - stem(top) is innermost stem node containing node
+  int previous = uOut;
+  depth[uOut] = inDepth + top;
+  potential[uOut] += change;
+  int node = thread[uOut];
+  while (true) {
+    int nodeDepth = depth[node];
+    while (top < numberStem && nodeDepth <= outDepth + numberStem - 1 - top) {
+      last[top] = previous;
+      top++;
+    }
+    if (top == numberStem)
+      break;
+    if (top && node == stem[top - 1])
+      top--;
+    depth[node] = nodeDepth + inDepth + 2 * top - outDepth - numberStem + 1;
+    potential[node] += change;
+    previous = node;
+    node = thread[node];
+  }
+  int after = node;
+  for (int i = 1; i < numberStem; i++) {
+    beforeStem[i] = reverseThread[stem[i - 1]];
+    afterLast[i] = thread[last[i - 1]];
+  }
+  // cut out
+  thread[before] = after;
+  reverseThread[after] = before;
+  // join parts
+  previous = last[0];
+  for (int i = 1; i < numberStem; i++) {
+    thread[previous] = stem[i];
+    reverseThread[stem[i]] = previous;
+    previous = beforeStem[i];
+    if (last[i] != last[i - 1]) {
+      thread[previous] = afterLast[i];
+      reverseThread[afterLast[i]] = previous;
+      previous = last[i];
+    }
+  }
+  // put after vIn
+  int next = thread[vIn];
+  thread[vIn] = uIn;
+  reverseThread[uIn] = vIn;
+  thread[previous] = next;
+  reverseThread[next] = previous;
+  // reverse stem
+  int newParent = vIn;
+  int newArc = entering;
+  for (int i = 0; i < numberStem; i++) {
+    node = stem[i];
+    int oldArc = predecessor[node];
+    parent[node] = newParent;
+    predecessor[node] = newArc;
+    newParent = node;
+    newArc = oldArc;
+  }
+}
+int ClpNetworkSimplex::solve(int maximumIterations)
+{
+  numberIterations_ = 0;
+  if (!numberArcs_)
+    return 3;
+  createTree();
+  int returnCode = 0;
+  while (true) {
+    int entering = findEntering();
+    if (entering < 0)
+      break;
+    if (numberIterations_ >= maximumIterations) {
+      returnCode = 3;
+      break;
+    }
+    numberIterations_++;
+    if (pivot(entering)) {
+      returnCode = 2;
+      break;
+    }
+  }
+  if (!returnCode) {
+    int firstArtificial = numberColumns_ + numberRows_;
+    for (int iRow = 0; iRow < numberRows_; iRow++) {
+      if (flow_[firstArtificial + iRow] > primalTolerance_) {
+        returnCode = 1;
+        break;
+      }
+    }
+  }
+  return returnCode;
+}
+double ClpNetworkSimplex::objectiveValue() const
+{
+  double value = 0.0;
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++)
+    value += cost_[iColumn] * flow_[iColumn];
+  return value;
+}
+/* Basic arcs give basic columns or rows.  A basic artificial (at zero
+   if optimal) joins the same node to root as the slack so the slack can
+   take its place.
+*/
+int ClpNetworkSimplex::copyBack(ClpSimplex *model) const
+{
+  if (!model->statusArray())
+    model->createStatus();
+  double *columnActivity = model->primalColumnSolution();
+  double *rowActivity = model->primalRowSolution();
+  for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+    columnActivity[iColumn] = flow_[iColumn];
+    switch (state_[iColumn]) {
+    case 0:
+      model->setColumnStatus(iColumn, ClpSimplex::basic);
+      break;
+    case 1:
+      model->setColumnStatus(iColumn, ClpSimplex::atLowerBound);
+      break;
+    case -1:
+      model->setColumnStatus(iColumn, ClpSimplex::atUpperBound);
+      break;
+    default:
+      model->setColumnStatus(iColumn, ClpSimplex::isFree);
+      break;
+    }
+  }
+  int firstArtificial = numberColumns_ + numberRows_;
+  for (int iRow = 0; iRow < numberRows_; iRow++) {
+    int iSlack = numberColumns_ + iRow;
+    int slackState = state_[iSlack];
+    if (!state_[firstArtificial + iRow])
+      slackState = 0;
+    if (!flipped_[iRow]) {
+      rowActivity[iRow] = flow_[iSlack];
+    } else {
+      rowActivity[iRow] = -flow_[iSlack];
+      if (slackState == 1 || slackState == -1)
+        slackState = -slackState;
+    }
+    switch (slackState) {
+    case 0:
+      model->setRowStatus(iRow, ClpSimplex::basic);
+      break;
+    case 1:
+      model->setRowStatus(iRow, ClpSimplex::atLowerBound);
+      break;
+    case -1:
+      model->setRowStatus(iRow, ClpSimplex::atUpperBound);
+      break;
+    default:
+      model->setRowStatus(iRow, ClpSimplex::isFree);
+      break;
+    }
+  }
+  return model->primal();
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,161 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef ClpNetworkSimplex_H
+#define ClpNetworkSimplex_H
+
+#include "ClpConfig.h"
+#include "CoinTypes.h"
+
+class ClpSimplex;
+
+/** Primal network simplex for pure network models
+
+A model is a pure network if every column has at most two nonzero
+elements, each of them +1 or -1, and one +1 and one -1 if there are two.
+load() also accepts models which only become networks after some rows
+are multiplied by -1 (it finds such rows by two colouring).  The matrix
+may be a ClpNetworkMatrix or any other ClpMatrixBase.
+
+Each row is a node and there is one extra node, the root.  Column j is
+an arc from the row where it has -1 to the row where it has +1 (a
+missing element means the root).  Row i has a slack arc from node i to
+the root whose flow is the row activity, so the bounds on the arc are
+the row bounds.  Every node also has an artificial arc to or from the
+root with a big cost (so there is only one phase).
+
+The basis is a spanning tree held as parent, arc to parent, depth,
+thread (preorder successor) and reverse thread, all plain int arrays
+indexed by node, so a pivot only touches the subtree which moves.
+The starting tree uses a slack where its row is feasible and an
+artificial where not, and is strongly feasible.  The leaving arc is
+chosen as by Cunningham so the tree stays strongly feasible and
+degenerate pivots can not cycle.  Entering arcs are priced in blocks of
+about sqrt(number of arcs) - the best in a block is taken as soon as a
+block has a candidate.
+
+copyBack() converts the tree to a Clp basis (a basic artificial makes
+its row basic) and finishes with primal simplex which normally takes
+no iterations but puts everything else (scaled arrays, duals etc) right.
+*/
+
+class CLPLIB_EXPORT ClpNetworkSimplex {
+
+public:
+  /**@name Solve */
+  //@{
+  /** Takes data from model - returns 0 if pure network, 1 if not
+        (no memory is kept if not a network).  Objective must be linear.
+    */
+  int load(const ClpSimplex *model);
+  /** Solves loaded problem.  Returns 0 optimal, 1 infeasible,
+        2 unbounded, 3 stopped on iterations.
+    */
+  int solve(int maximumIterations);
+  /** Puts solution and basis in model (which must be one loaded) and
+        cleans up with primal simplex.  Returns code from primal.
+    */
+  int copyBack(ClpSimplex *model) const;
+  //@}
+
+  /**@name Gets */
+  //@{
+  /// Number of iterations in last solve
+  inline int numberIterations() const
+  {
+    return numberIterations_;
+  }
+  /// Objective value (in minimization sense) after solve
+  double objectiveValue() const;
+  /// Number of rows multiplied by -1 to make a network
+  inline int numberFlipped() const
+  {
+    return numberFlipped_;
+  }
+  //@}
+
+  /**@name Constructors and destructor */
+  //@{
+  /// Default constructor
+  ClpNetworkSimplex();
+  /// Destructor
+  ~ClpNetworkSimplex();
+  //@}
+
+private:
+  /// Not allowed
+  ClpNetworkSimplex(const ClpNetworkSimplex &);
+  ClpNetworkSimplex &operator=(const ClpNetworkSimplex &);
+  /// Frees arrays
+  void gutsOfDelete();
+  /// Sets up starting flows, artificials and tree
+  void createTree();
+  /// Returns entering arc (-1 if optimal) - block search
+  int findEntering();
+  /** Does pivot with entering arc - returns 0 if okay, 1 if unbounded */
+  int pivot(int entering);
+  /// Moves subtree at uOut to hang from vIn by entering arc at uIn
+  void updateTree(int entering, int uIn, int vIn, int uOut);
+
+  /**@name Data */
+  //@{
+  /// Number of rows (root is node numberRows_)
+  int numberRows_;
+  /// Number of columns
+  int numberColumns_;
+  /// Number of rows flipped
+  int numberFlipped_;
+  /// Number of arcs (columns, slacks then artificials)
+  int numberArcs_;
+  /// Number of iterations
+  int numberIterations_;
+  /// Block size for pricing
+  int blockSize_;
+  /// Where next pricing block starts
+  int nextArc_;
+  /// Dual tolerance
+  double dualTolerance_;
+  /// Primal tolerance
+  double primalTolerance_;
+  /// Cost of artificial arcs
+  double artificialCost_;
+  /// Optimization direction of model
+  double direction_;
+  /// Tail (from) node of each arc
+  int *tail_;
+  /// Head (to) node of each arc
+  int *head_;
+  /// Cost of each arc (times direction)
+  double *cost_;
+  /// Lower bound of each arc
+  double *lower_;
+  /// Upper bound of each arc
+  double *upper_;
+  /// Flow on each arc
+  double *flow_;
+  /** State of each arc - 0 basic, 1 at lower, -1 at upper,
+        2 nonbasic free (at zero) */
+  signed char *state_;
+  /// True if row was multiplied by -1
+  char *flipped_;
+  /// Parent of each node (-1 for root)
+  int *parent_;
+  /// Arc joining each node to parent
+  int *predecessor_;
+  /// Depth of each node in tree (root 0)
+  int *depth_;
+  /// Next node in preorder (thread)
+  int *thread_;
+  /// Previous node in preorder
+  int *reverseThread_;
+  /// Node potentials (row duals), root is 0
+  double *potential_;
+  /// Work arrays for moving subtrees
+  int *work_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
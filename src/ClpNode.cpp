@@ -274,6 +274,10 @@ void ClpNode::gutsOfConstructor(ClpSimplex *model, const ClpNodeStuff *stuff,
       if (fabs(value - nearest) > integerTolerance) {
         numberInfeasibilities_++;
         sumInfeasibilities_ += fabs(value - nearest);
+        // pseudo costs may be being updated by other threads (parallel fathom)
+        std::unique_lock< std::mutex > lock;
+        if (stuff->shared_)
+          lock = std::unique_lock< std::mutex >(stuff->shared_->lock(iInteger));
 #if PSEUDO == 1 || PSEUDO == 2
         double upValue = 0.0;
         double downValue = 0.0;
@@ -694,7 +698,8 @@ ClpNodeStuff::ClpNodeStuff()
   handler_(NULL)
   ,
 #endif
-  nBound_(0)
+  shared_(NULL)
+  , nBound_(0)
   , saveOptions_(0)
   , solverOptions_(0)
   , maximumNodes_(0)
@@ -705,6 +710,7 @@ ClpNodeStuff::ClpNodeStuff()
   , numberNodesExplored_(0)
   , numberIterations_(0)
   , presolveType_(0)
+  , numberThreads_(1)
 #ifndef NO_FATHOM_PRINT
   , startingDepth_(-1)
   , nodeCalled_(-1)
@@ -736,7 +742,8 @@ ClpNodeStuff::ClpNodeStuff(const ClpNodeStuff &rhs)
   handler_(rhs.handler_)
   ,
 #endif
-  nBound_(0)
+  shared_(NULL)
+  , nBound_(0)
   , saveOptions_(rhs.saveOptions_)
   , solverOptions_(rhs.solverOptions_)
   , maximumNodes_(rhs.maximumNodes_)
@@ -747,6 +754,7 @@ ClpNodeStuff::ClpNodeStuff(const ClpNodeStuff &rhs)
   , numberNodesExplored_(rhs.numberNodesExplored_)
   , numberIterations_(rhs.numberIterations_)
   , presolveType_(rhs.presolveType_)
+  , numberThreads_(rhs.numberThreads_)
 #ifndef NO_FATHOM_PRINT
   , startingDepth_(rhs.startingDepth_)
   , nodeCalled_(rhs.nodeCalled_)
@@ -775,6 +783,7 @@ ClpNodeStuff::operator=(const ClpNodeStuff &rhs)
     large_ = NULL;
     whichRow_ = NULL;
     whichColumn_ = NULL;
+    shared_ = NULL;
     nBound_ = 0;
     saveOptions_ = rhs.saveOptions_;
     solverOptions_ = rhs.solverOptions_;
@@ -793,6 +802,7 @@ ClpNodeStuff::operator=(const ClpNodeStuff &rhs)
     numberNodesExplored_ = rhs.numberNodesExplored_;
     numberIterations_ = rhs.numberIterations_;
     presolveType_ = rhs.presolveType_;
+    numberThreads_ = rhs.numberThreads_;
 #ifndef NO_FATHOM_PRINT
     handler_ = rhs.handler_;
     startingDepth_ = rhs.startingDepth_;
@@ -817,6 +827,7 @@ void ClpNodeStuff::zap(int type)
     large_ = NULL;
     whichRow_ = NULL;
     whichColumn_ = NULL;
+    shared_ = NULL;
   }
   if ((type & 2) != 0) {
     nBound_ = 0;
@@ -830,6 +841,7 @@ void ClpNodeStuff::zap(int type)
     presolveType_ = 0;
     numberNodesExplored_ = 0;
     numberIterations_ = 0;
+    numberThreads_ = 1;
   }
 }
 
@@ -918,6 +930,10 @@ void ClpNodeStuff::fillPseudoCosts(const double *down, const double *up,
 // Update pseudo costs
 void ClpNodeStuff::update(int way, int sequence, double change, bool feasible)
 {
+  // pseudo costs may be shared by threads in parallel fathom
+  std::unique_lock< std::mutex > lock;
+  if (shared_)
+    lock = std::unique_lock< std::mutex >(shared_->lock(sequence));
   assert(numberDown_[sequence] >= numberDownInfeasible_[sequence]);
   assert(numberUp_[sequence] >= numberUpInfeasible_[sequence]);
   if (way < 0) {
@@ -936,6 +952,67 @@ void ClpNodeStuff::update(int way, int sequence, double change, bool feasible)
 // Constructors / Destructor / Assignment
 //#############################################################################
 
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+ClpFathomShared::ClpFathomShared()
+  : cutoff_(COIN_DBL_MAX)
+  , stop_(0)
+  , numberNodes_(0)
+  , numberIterations_(0)
+  , bestObjective_(COIN_DBL_MAX)
+  , bestLower_(NULL)
+  , bestUpper_(NULL)
+  , bestStatus_(NULL)
+{
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+ClpFathomShared::~ClpFathomShared()
+{
+  delete[] bestLower_;
+  delete[] bestUpper_;
+  delete[] bestStatus_;
+}
+// Lower cutoff to value if that is better
+void ClpFathomShared::improveCutoff(double value)
+{
+  double current = cutoff_.load(std::memory_order_relaxed);
+  while (value < current && !cutoff_.compare_exchange_weak(current, value)) {
+  }
+}
+// Ask all threads to stop - first reason is kept
+void ClpFathomShared::stop(int reason)
+{
+  int expected = 0;
+  stop_.compare_exchange_strong(expected, reason ? reason : -1);
+}
+// Keeps bounds and status of solution in model if better than any so far
+void ClpFathomShared::saveSolution(const ClpSimplex *model)
+{
+  double objectiveValue = model->objectiveValue() * model->optimizationDirection();
+  std::lock_guard< std::mutex > guard(solutionLock_);
+  if (objectiveValue < bestObjective_) {
+    int numberColumns = model->numberColumns();
+    int numberTotal = numberColumns + model->numberRows();
+    bestObjective_ = objectiveValue;
+    if (!bestLower_) {
+      bestLower_ = new double[numberColumns];
+      bestUpper_ = new double[numberColumns];
+      bestStatus_ = new unsigned char[numberTotal];
+    }
+    CoinMemcpyN(model->columnLower(), numberColumns, bestLower_);
+    CoinMemcpyN(model->columnUpper(), numberColumns, bestUpper_);
+    CoinMemcpyN(model->statusArray(), numberTotal, bestStatus_);
+  }
+}
+
+//#############################################################################
+// Constructors / Destructor / Assignment
+//#############################################################################
+
 //-------------------------------------------------------------------
 // Default Constructor
 //-------------------------------------------------------------------
@@ -8,6 +8,9 @@
 #include "CoinPragma.hpp"
 #include "CoinMessageHandler.hpp"
 
+#include <atomic>
+#include <mutex>
+
 // This implements all stuff for Clp fathom
 /** This contains what is in a Clp "node"
 
@@ -185,6 +188,82 @@ protected:
   int maximumIntegers_;
   //@}
 };
+/** What threads share in a parallel ClpSimplex::fathom
+
+    Each thread has its own clone of the model and its own ClpNodeStuff
+    but the pseudo cost arrays are those of the caller.  Updates are
+    done under one of a set of locks chosen by integer (lock striping),
+    reads in ClpNode are not locked so may see slightly stale values.
+    The cutoff (best objective less increment as used in fathom) is
+    lowered by any thread finding a solution and picked up by the others.
+*/
+class CLPLIB_EXPORT ClpFathomShared {
+
+public:
+  /**@name Useful methods */
+  //@{
+  /// Lock for pseudo costs of integer sequence
+  inline std::mutex &lock(int sequence)
+  {
+    return locks_[sequence & (numberLocks - 1)];
+  }
+  /// Current cutoff
+  inline double cutoff() const
+  {
+    return cutoff_.load(std::memory_order_relaxed);
+  }
+  /// Lower cutoff to value if that is better
+  void improveCutoff(double value);
+  /// Nonzero (a negative nNodes_ value) if search should stop
+  inline int stopped() const
+  {
+    return stop_.load(std::memory_order_relaxed);
+  }
+  /// Ask all threads to stop - first reason is kept
+  void stop(int reason);
+  /// Keeps bounds and status of solution in model if better than any so far
+  void saveSolution(const ClpSimplex *model);
+  //@}
+
+  /**@name Constructors, destructor */
+  //@{
+  /** Default constructor. */
+  ClpFathomShared();
+  /** Destructor */
+  ~ClpFathomShared();
+  //@}
+
+  /**@name Data */
+  //@{
+  /// Number of lock stripes (power of 2)
+  enum { numberLocks = 64 };
+  /// Locks for pseudo costs
+  std::mutex locks_[numberLocks];
+  /// Lock for best solution
+  std::mutex solutionLock_;
+  /// Cutoff
+  std::atomic< double > cutoff_;
+  /// Stop reason
+  std::atomic< int > stop_;
+  /// Number of nodes explored by all threads
+  std::atomic< int > numberNodes_;
+  /// Number of iterations by all threads
+  std::atomic< int > numberIterations_;
+  /// Objective of best solution
+  double bestObjective_;
+  /// Column lower bounds of best solution (or NULL)
+  double *bestLower_;
+  /// Column upper bounds of best solution
+  double *bestUpper_;
+  /// Status of best solution
+  unsigned char *bestStatus_;
+  //@}
+
+private:
+  /// Disable copy
+  ClpFathomShared(const ClpFathomShared &);
+  ClpFathomShared &operator=(const ClpFathomShared &);
+};
 class CLPLIB_EXPORT ClpNodeStuff {
 
 public:
@@ -259,6 +338,8 @@ public:
   /// Cbc's message handler
   CoinMessageHandler *handler_;
 #endif
+  /// Shared stuff if one of threads in parallel fathom (not owned)
+  ClpFathomShared *shared_;
   /// Number bounds in large model
   int nBound_;
   /// Save of specialOptions_ (local)
@@ -288,6 +369,8 @@ public:
   int numberIterations_;
   /// Type of presolve - 0 none, 1 crunch
   int presolveType_;
+  /// Number of threads for fathom (subtrees explored in parallel if > 1)
+  int numberThreads_;
 #ifndef NO_FATHOM_PRINT
   /// Depth passed in
   int startingDepth_;
@@ -7,7 +7,6 @@
 #include "CoinPragma.hpp"
 #include "CoinIndexedVector.hpp"
 #include "CoinHelperFunctions.hpp"
-//#define THREAD
 //#define FAKE_CILK
 #if ABOCA_LITE
 // 1 is not owner of abcState_
@@ -22,6 +21,8 @@
 // at end to get min/max!
 #include "ClpPackedMatrix.hpp"
 #include "ClpMessage.hpp"
+#include "ClpThreadPool.hpp"
+#include "ClpSimdKernels.hpp"
 #ifdef INTEL_MKL
 #include "mkl_spblas.h"
 #endif
@@ -1491,6 +1492,11 @@ int ClpPackedMatrix::gutsOfTransposeTimesUnscaled(const double *COIN_RESTRICT pi
   const int *COIN_RESTRICT row = matrix_->getIndices();
   const CoinBigIndex *COIN_RESTRICT columnStart = matrix_->getVectorStarts();
   const double *COIN_RESTRICT elementByColumn = matrix_->getElements();
+#if CLP_SIMD_DISPATCH
+  if (clpSimdLevel() != CLP_SIMD_NONE)
+    return clpSimdTransposeTimes(pi, columnStart, row, elementByColumn, NULL, NULL,
+      numberActiveColumns_, index, array, zeroTolerance);
+#endif
 #if 1 //ndef INTEL_MKL
   double value = 0.0;
   CoinBigIndex j;
@@ -1551,6 +1557,11 @@ int ClpPackedMatrix::gutsOfTransposeTimesScaled(const double *COIN_RESTRICT pi,
   const int *COIN_RESTRICT row = matrix_->getIndices();
   const CoinBigIndex *COIN_RESTRICT columnStart = matrix_->getVectorStarts();
   const double *COIN_RESTRICT elementByColumn = matrix_->getElements();
+#if CLP_SIMD_DISPATCH
+  if (clpSimdLevel() != CLP_SIMD_NONE)
+    return clpSimdTransposeTimes(pi, columnStart, row, elementByColumn, columnScale, NULL,
+      numberActiveColumns_, index, array, zeroTolerance);
+#endif
   double value = 0.0;
   double scale = columnScale[0];
   CoinBigIndex j;
@@ -1675,6 +1686,11 @@ int ClpPackedMatrix::gutsOfTransposeTimesUnscaled(const double *COIN_RESTRICT pi
       numberNonZero += info[i].numberAdded;
     moveAndZero(info, 2, NULL);
   } else {
+#endif
+#if CLP_SIMD_DISPATCH
+    if (clpSimdLevel() != CLP_SIMD_NONE)
+      return clpSimdTransposeTimes(pi, columnStart, row, elementByColumn, NULL, status,
+        numberActiveColumns_, index, array, zeroTolerance);
 #endif
     double value = 0.0;
     int jColumn = -1;
@@ -1996,6 +2012,11 @@ int ClpPackedMatrix::gutsOfTransposeTimesScaled(const double *COIN_RESTRICT pi,
   const int *COIN_RESTRICT row = matrix_->getIndices();
   const CoinBigIndex *COIN_RESTRICT columnStart = matrix_->getVectorStarts();
   const double *COIN_RESTRICT elementByColumn = matrix_->getElements();
+#if CLP_SIMD_DISPATCH
+  if (clpSimdLevel() != CLP_SIMD_NONE)
+    return clpSimdTransposeTimes(pi, columnStart, row, elementByColumn, columnScale, status,
+      numberActiveColumns_, index, array, zeroTolerance);
+#endif
   double value = 0.0;
   int jColumn = -1;
   for (int iColumn = 0; iColumn < numberActiveColumns_; iColumn++) {
@@ -2060,6 +2081,9 @@ int ClpPackedMatrix::gutsOfTransposeTimesByRowGEK(const CoinIndexedVector *COIN_
   const CoinBigIndex *COIN_RESTRICT rowStart = matrix_->getVectorStarts();
   const double *COIN_RESTRICT element = matrix_->getElements();
   const int *COIN_RESTRICT whichRow = piVector->getIndices();
+#if CLP_SIMD_DISPATCH
+  bool useSimd = clpSimdLevel() != CLP_SIMD_NONE;
+#endif
   // ** Row copy is already scaled
   for (int i = 0; i < numberInRowArray; i++) {
     int iRow = whichRow[i];
@@ -2069,6 +2093,12 @@ int ClpPackedMatrix::gutsOfTransposeTimesByRowGEK(const CoinIndexedVector *COIN_
     int n = static_cast< int >(end - start);
     const int *COIN_RESTRICT columnThis = column + start;
     const double *COIN_RESTRICT elementThis = element + start;
+#if CLP_SIMD_DISPATCH
+    if (useSimd) {
+      clpSimdScatterRow(value, columnThis, elementThis, n, output);
+      continue;
+    }
+#endif
 
     // could do by twos
     for (; n; n--) {
@@ -2106,16 +2136,24 @@ int ClpPackedMatrix::gutsOfTransposeTimesByRowGEK(const CoinIndexedVector *COIN_
     moveAndZero(info, 2, NULL);
   } else {
 #endif
-    for (int i = 0; i < numberColumns; i++) {
-      double value = output[i];
-      if (value) {
-        output[i] = 0.0;
-        if (fabs(value) > tolerance) {
-          output[numberNonZero] = value;
-          index[numberNonZero++] = i;
+#if CLP_SIMD_DISPATCH
+    if (useSimd) {
+      numberNonZero = clpSimdPackDown(output, index, numberColumns, tolerance);
+    } else {
+#endif
+      for (int i = 0; i < numberColumns; i++) {
+        double value = output[i];
+        if (value) {
+          output[i] = 0.0;
+          if (fabs(value) > tolerance) {
+            output[numberNonZero] = value;
+            index[numberNonZero++] = i;
+          }
         }
       }
+#if CLP_SIMD_DISPATCH
     }
+#endif
 #if ABOCA_LITE
   }
 #endif
@@ -5887,11 +5925,8 @@ ClpPackedMatrix2::ClpPackedMatrix2()
   , rowStart_(NULL)
   , column_(NULL)
   , work_(NULL)
+  , info_(NULL)
 {
-#ifdef THREAD
-  threadId_ = NULL;
-  info_ = NULL;
-#endif
 }
 //-------------------------------------------------------------------
 // Useful Constructor
@@ -5904,11 +5939,8 @@ ClpPackedMatrix2::ClpPackedMatrix2(ClpSimplex *, const CoinPackedMatrix *rowCopy
   , rowStart_(NULL)
   , column_(NULL)
   , work_(NULL)
+  , info_(NULL)
 {
-#ifdef THREAD
-  threadId_ = NULL;
-  info_ = NULL;
-#endif
   numberRows_ = rowCopy->getNumRows();
   if (!numberRows_)
     return;
@@ -5976,11 +6008,8 @@ else
 }
 // Could also analyze matrix to get natural breaks
 numberBlocks_ = (numberColumns + chunk - 1) / chunk;
-#ifdef THREAD
 // Get work areas
-threadId_ = new pthread_t[numberBlocks_];
 info_ = new dualColumn0Struct[numberBlocks_];
-#endif
 // Even out
 chunk = (numberColumns + numberBlocks_ - 1) / numberBlocks_;
 offset_ = new int[numberBlocks_ + 1];
@@ -6055,20 +6084,14 @@ ClpPackedMatrix2::ClpPackedMatrix2(const ClpPackedMatrix2 &rhs)
     column_ = CoinCopyOfArray(rhs.column_, nElement);
     int sizeWork = 6 * numberBlocks_;
     work_ = CoinCopyOfArray(rhs.work_, sizeWork);
-#ifdef THREAD
-    threadId_ = new pthread_t[numberBlocks_];
     info_ = new dualColumn0Struct[numberBlocks_];
-#endif
   } else {
     offset_ = NULL;
     count_ = NULL;
     rowStart_ = NULL;
     column_ = NULL;
     work_ = NULL;
-#ifdef THREAD
-    threadId_ = NULL;
     info_ = NULL;
-#endif
   }
 }
 //-------------------------------------------------------------------
@@ -6081,10 +6104,7 @@ ClpPackedMatrix2::~ClpPackedMatrix2()
   delete[] rowStart_;
   delete[] column_;
   delete[] work_;
-#ifdef THREAD
-  delete[] threadId_;
   delete[] info_;
-#endif
 }
 
 //----------------------------------------------------------------
@@ -6101,10 +6121,7 @@ ClpPackedMatrix2::operator=(const ClpPackedMatrix2 &rhs)
     delete[] rowStart_;
     delete[] column_;
     delete[] work_;
-#ifdef THREAD
-    delete[] threadId_;
     delete[] info_;
-#endif
     if (numberBlocks_) {
       offset_ = CoinCopyOfArray(rhs.offset_, numberBlocks_ + 1);
       int nRow = numberBlocks_ * numberRows_;
@@ -6114,20 +6131,14 @@ ClpPackedMatrix2::operator=(const ClpPackedMatrix2 &rhs)
       column_ = CoinCopyOfArray(rhs.column_, nElement);
       int sizeWork = 6 * numberBlocks_;
       work_ = CoinCopyOfArray(rhs.work_, sizeWork);
-#ifdef THREAD
-      threadId_ = new pthread_t[numberBlocks_];
       info_ = new dualColumn0Struct[numberBlocks_];
-#endif
     } else {
       offset_ = NULL;
       count_ = NULL;
       rowStart_ = NULL;
       column_ = NULL;
       work_ = NULL;
-#ifdef THREAD
-      threadId_ = NULL;
       info_ = NULL;
-#endif
     }
   }
   return *this;
@@ -6369,29 +6380,25 @@ static int doOneBlock(double *COIN_RESTRICT array, int *COIN_RESTRICT index,
   }
   return numberNonZero;
 }
-#ifdef THREAD
-static void *doOneBlockThread(void *voidInfo)
+// One block of ClpPackedMatrix2::transposeTimes as a task
+static void doOneBlockTask(dualColumn0Struct *info)
 {
-  dualColumn0Struct *info = (dualColumn0Struct *)voidInfo;
   *(info->numberInPtr) = doOneBlock(info->arrayTemp, info->indexTemp, info->pi,
     info->rowStart, info->element, info->column,
     info->numberInRowArray, info->numberLook);
-  return NULL;
 }
-static void *doOneBlockAnd0Thread(void *voidInfo)
+// Same but also dualColumn0
+static void doOneBlockAnd0Task(dualColumn0Struct *info)
 {
-  dualColumn0Struct *info = (dualColumn0Struct *)voidInfo;
   *(info->numberInPtr) = doOneBlock(info->arrayTemp, info->indexTemp, info->pi,
     info->rowStart, info->element, info->column,
     info->numberInRowArray, info->numberLook);
   *(info->numberOutPtr) = dualColumn0(info->model, info->spare,
-    info->spareIndex, (const double *)info->arrayTemp,
-    (const int *)info->indexTemp, *(info->numberInPtr),
+    info->spareIndex, info->arrayTemp,
+    info->indexTemp, *(info->numberInPtr),
     info->offset, info->acceptablePivot,
     info->upperThetaPtr, info->posFreePtr, info->freePivotPtr);
-  return NULL;
 }
-#endif
 /* Return <code>x * scalar * A in <code>z</code>.
    Note - x packed and z will be packed mode
    Squashes small elements and knows about ClpSimplex */
@@ -6523,125 +6530,119 @@ void ClpPackedMatrix2::transposeTimes(const ClpSimplex *model,
   double *COIN_RESTRICT spare = spareArray->denseVector();
   int *COIN_RESTRICT spareIndex = spareArray->getIndices();
   int saveNumberRemaining = numberRemaining;
+  // blocks go to pool if it has more than one thread
+  ClpTaskGroup group;
+  bool threaded = !group.pool()->serial();
   int iBlock;
   for (iBlock = 0; iBlock < numberBlocks_; iBlock++) {
     double *COIN_RESTRICT dwork = work_ + 6 * iBlock;
     int *COIN_RESTRICT iwork = reinterpret_cast< int * >(dwork + 3);
     if (!dualColumn) {
-#ifndef THREAD
-      int offset = offset_[iBlock];
-      int offset3 = offset;
-      offset = numberNonZero;
-      double *COIN_RESTRICT arrayTemp = array + offset;
-      int *COIN_RESTRICT indexTemp = index + offset;
-      iwork[0] = doOneBlock(arrayTemp, indexTemp, pi, rowStart_ + numberInRowArray * iBlock,
-        element, column_, numberInRowArray, offset_[iBlock + 1] - offset);
-      int number = iwork[0];
-      for (i = 0; i < number; i++) {
-        //double value = arrayTemp[i];
-        //arrayTemp[i]=0.0;
-        //array[numberNonZero]=value;
-        index[numberNonZero++] = indexTemp[i] + offset3;
+      if (!threaded) {
+        int offset = offset_[iBlock];
+        int offset3 = offset;
+        offset = numberNonZero;
+        double *COIN_RESTRICT arrayTemp = array + offset;
+        int *COIN_RESTRICT indexTemp = index + offset;
+        iwork[0] = doOneBlock(arrayTemp, indexTemp, pi, rowStart_ + numberInRowArray * iBlock,
+          element, column_, numberInRowArray, offset_[iBlock + 1] - offset);
+        int number = iwork[0];
+        for (i = 0; i < number; i++) {
+          //double value = arrayTemp[i];
+          //arrayTemp[i]=0.0;
+          //array[numberNonZero]=value;
+          index[numberNonZero++] = indexTemp[i] + offset3;
+        }
+      } else {
+        int offset = offset_[iBlock];
+        double *COIN_RESTRICT arrayTemp = array + offset;
+        int *COIN_RESTRICT indexTemp = index + offset;
+        dualColumn0Struct *infoPtr = info_ + iBlock;
+        infoPtr->arrayTemp = arrayTemp;
+        infoPtr->indexTemp = indexTemp;
+        infoPtr->numberInPtr = &iwork[0];
+        infoPtr->pi = pi;
+        infoPtr->rowStart = rowStart_ + numberInRowArray * iBlock;
+        infoPtr->element = element;
+        infoPtr->column = column_;
+        infoPtr->numberInRowArray = numberInRowArray;
+        infoPtr->numberLook = offset_[iBlock + 1] - offset;
+        group.spawn([infoPtr]() { doOneBlockTask(infoPtr); });
       }
-#else
-      int offset = offset_[iBlock];
-      double *COIN_RESTRICT arrayTemp = array + offset;
-      int *COIN_RESTRICT indexTemp = index + offset;
-      dualColumn0Struct *infoPtr = info_ + iBlock;
-      infoPtr->arrayTemp = arrayTemp;
-      infoPtr->indexTemp = indexTemp;
-      infoPtr->numberInPtr = &iwork[0];
-      infoPtr->pi = pi;
-      infoPtr->rowStart = rowStart_ + numberInRowArray * iBlock;
-      infoPtr->element = element;
-      infoPtr->column = column_;
-      infoPtr->numberInRowArray = numberInRowArray;
-      infoPtr->numberLook = offset_[iBlock + 1] - offset;
-      pthread_create(&threadId_[iBlock], NULL, doOneBlockThread, infoPtr);
-#endif
     } else {
-#ifndef THREAD
-      int offset = offset_[iBlock];
-      // allow for already saved
-      int offset2 = offset + saveNumberRemaining;
-      int offset3 = offset;
-      offset = numberNonZero;
-      offset2 = numberRemaining;
-      double *COIN_RESTRICT arrayTemp = array + offset;
-      int *COIN_RESTRICT indexTemp = index + offset;
-      iwork[0] = doOneBlock(arrayTemp, indexTemp, pi, rowStart_ + numberInRowArray * iBlock,
-        element, column_, numberInRowArray, offset_[iBlock + 1] - offset);
-      iwork[1] = dualColumn0(model, spare + offset2,
-        spareIndex + offset2,
-        arrayTemp, indexTemp,
-        iwork[0], offset3, acceptablePivot,
-        &dwork[1], &iwork[2],
-        &dwork[2]);
-      int number = iwork[0];
-      int numberLook = iwork[1];
+      if (!threaded) {
+        int offset = offset_[iBlock];
+        // allow for already saved
+        int offset2 = offset + saveNumberRemaining;
+        int offset3 = offset;
+        offset = numberNonZero;
+        offset2 = numberRemaining;
+        double *COIN_RESTRICT arrayTemp = array + offset;
+        int *COIN_RESTRICT indexTemp = index + offset;
+        iwork[0] = doOneBlock(arrayTemp, indexTemp, pi, rowStart_ + numberInRowArray * iBlock,
+          element, column_, numberInRowArray, offset_[iBlock + 1] - offset);
+        iwork[1] = dualColumn0(model, spare + offset2,
+          spareIndex + offset2,
+          arrayTemp, indexTemp,
+          iwork[0], offset3, acceptablePivot,
+          &dwork[1], &iwork[2],
+          &dwork[2]);
+        int number = iwork[0];
+        int numberLook = iwork[1];
 #if 1
-      numberRemaining += numberLook;
+        numberRemaining += numberLook;
 #else
-      double *COIN_RESTRICT spareTemp = spare + offset2;
-      const int *COIN_RESTRICT spareIndexTemp = spareIndex + offset2;
-      for (i = 0; i < numberLook; i++) {
-        double value = spareTemp[i];
-        spareTemp[i] = 0.0;
-        spare[numberRemaining] = value;
-        spareIndex[numberRemaining++] = spareIndexTemp[i];
-      }
-#endif
-      if (dwork[2] > freePivot) {
-        freePivot = dwork[2];
-        posFree = iwork[2] + numberNonZero;
-      }
-      upperTheta = CoinMin(dwork[1], upperTheta);
-      for (i = 0; i < number; i++) {
-        // double value = arrayTemp[i];
-        //arrayTemp[i]=0.0;
-        //array[numberNonZero]=value;
-        index[numberNonZero++] = indexTemp[i] + offset3;
-      }
-#else
-      int offset = offset_[iBlock];
-      // allow for already saved
-      int offset2 = offset + saveNumberRemaining;
-      double *COIN_RESTRICT arrayTemp = array + offset;
-      int *COIN_RESTRICT indexTemp = index + offset;
-      dualColumn0Struct *infoPtr = info_ + iBlock;
-      infoPtr->model = model;
-      infoPtr->spare = spare + offset2;
-      infoPtr->spareIndex = spareIndex + offset2;
-      infoPtr->arrayTemp = arrayTemp;
-      infoPtr->indexTemp = indexTemp;
-      infoPtr->numberInPtr = &iwork[0];
-      infoPtr->offset = offset;
-      infoPtr->acceptablePivot = acceptablePivot;
-      infoPtr->upperThetaPtr = &dwork[1];
-      infoPtr->posFreePtr = &iwork[2];
-      infoPtr->freePivotPtr = &dwork[2];
-      infoPtr->numberOutPtr = &iwork[1];
-      infoPtr->pi = pi;
-      infoPtr->rowStart = rowStart_ + numberInRowArray * iBlock;
-      infoPtr->element = element;
-      infoPtr->column = column_;
-      infoPtr->numberInRowArray = numberInRowArray;
-      infoPtr->numberLook = offset_[iBlock + 1] - offset;
-      if (iBlock >= 2)
-        pthread_join(threadId_[iBlock - 2], NULL);
-      pthread_create(threadId_ + iBlock, NULL, doOneBlockAnd0Thread, infoPtr);
-      //pthread_join(threadId_[iBlock],NULL);
-#endif
-    }
-  }
-  for (iBlock = CoinMax(0, numberBlocks_ - 2); iBlock < numberBlocks_; iBlock++) {
-#ifdef THREAD
-    pthread_join(threadId_[iBlock], NULL);
-#endif
-  }
-#ifdef THREAD
-  for (iBlock = 0; iBlock < numberBlocks_; iBlock++) {
-    //pthread_join(threadId_[iBlock],NULL);
+        double *COIN_RESTRICT spareTemp = spare + offset2;
+        const int *COIN_RESTRICT spareIndexTemp = spareIndex + offset2;
+        for (i = 0; i < numberLook; i++) {
+          double value = spareTemp[i];
+          spareTemp[i] = 0.0;
+          spare[numberRemaining] = value;
+          spareIndex[numberRemaining++] = spareIndexTemp[i];
+        }
+#endif
+        if (dwork[2] > freePivot) {
+          freePivot = dwork[2];
+          posFree = iwork[2] + numberNonZero;
+        }
+        upperTheta = CoinMin(dwork[1], upperTheta);
+        for (i = 0; i < number; i++) {
+          // double value = arrayTemp[i];
+          //arrayTemp[i]=0.0;
+          //array[numberNonZero]=value;
+          index[numberNonZero++] = indexTemp[i] + offset3;
+        }
+      } else {
+        int offset = offset_[iBlock];
+        // allow for already saved
+        int offset2 = offset + saveNumberRemaining;
+        double *COIN_RESTRICT arrayTemp = array + offset;
+        int *COIN_RESTRICT indexTemp = index + offset;
+        dualColumn0Struct *infoPtr = info_ + iBlock;
+        infoPtr->model = model;
+        infoPtr->spare = spare + offset2;
+        infoPtr->spareIndex = spareIndex + offset2;
+        infoPtr->arrayTemp = arrayTemp;
+        infoPtr->indexTemp = indexTemp;
+        infoPtr->numberInPtr = &iwork[0];
+        infoPtr->offset = offset;
+        infoPtr->acceptablePivot = acceptablePivot;
+        infoPtr->upperThetaPtr = &dwork[1];
+        infoPtr->posFreePtr = &iwork[2];
+        infoPtr->freePivotPtr = &dwork[2];
+        infoPtr->numberOutPtr = &iwork[1];
+        infoPtr->pi = pi;
+        infoPtr->rowStart = rowStart_ + numberInRowArray * iBlock;
+        infoPtr->element = element;
+        infoPtr->column = column_;
+        infoPtr->numberInRowArray = numberInRowArray;
+        infoPtr->numberLook = offset_[iBlock + 1] - offset;
+        group.spawn([infoPtr]() { doOneBlockAnd0Task(infoPtr); });
+      }
+    }
+  }
+  group.wait();
+  for (iBlock = 0; threaded && iBlock < numberBlocks_; iBlock++) {
     int offset = offset_[iBlock];
     double *COIN_RESTRICT dwork = work_ + 6 * iBlock;
     int *COIN_RESTRICT iwork = (int *)(dwork + 3);
@@ -6673,7 +6674,6 @@ void ClpPackedMatrix2::transposeTimes(const ClpSimplex *model,
       index[numberNonZero++] = indexTemp[i] + offset;
     }
   }
-#endif
   columnArray->setNumElements(numberNonZero);
   columnArray->setPackedMode(true);
   if (dualColumn) {
@@ -6743,6 +6743,9 @@ ClpPackedMatrix3::ClpPackedMatrix3()
   , block_(NULL)
   , ifActive_(0)
   , plusOnes_(0)
+  , dualScratch_(NULL)
+  , dualScratchIndex_(NULL)
+  , dualScratchSize_(0)
 {
 }
 #ifdef HAVE_INTRIN_H
@@ -6774,6 +6777,9 @@ ClpPackedMatrix3::ClpPackedMatrix3(ClpSimplex *model, const CoinPackedMatrix *co
   , block_(NULL)
   , ifActive_(0)
   , plusOnes_(0)
+  , dualScratch_(NULL)
+  , dualScratchIndex_(NULL)
+  , dualScratchSize_(0)
 {
   //#undef COIN_AVX2
   //#define COIN_AVX2 8
@@ -7266,6 +7272,8 @@ ClpPackedMatrix3::~ClpPackedMatrix3()
   delete[] element_;
   delete temporary_;
   delete[] block_;
+  delete[] dualScratch_;
+  delete[] dualScratchIndex_;
 }
 /* The copy constructor. */
 ClpPackedMatrix3::ClpPackedMatrix3(const ClpPackedMatrix3 &rhs)
@@ -7287,6 +7295,9 @@ ClpPackedMatrix3::ClpPackedMatrix3(const ClpPackedMatrix3 &rhs)
   , block_(NULL)
   , ifActive_(rhs.ifActive_)
   , plusOnes_(rhs.plusOnes_)
+  , dualScratch_(NULL)
+  , dualScratchIndex_(NULL)
+  , dualScratchSize_(0)
 {
   if (rhs.numberBlocks_) {
     block_ = CoinCopyOfArray(rhs.block_, numberBlocks_);
@@ -7328,6 +7339,11 @@ ClpPackedMatrix3::operator=(const ClpPackedMatrix3 &rhs)
     delete temporary_;
     temporary_ = NULL;
     delete[] block_;
+    delete[] dualScratch_;
+    dualScratch_ = NULL;
+    delete[] dualScratchIndex_;
+    dualScratchIndex_ = NULL;
+    dualScratchSize_ = 0;
     numberBlocks_ = rhs.numberBlocks_;
     numberColumns_ = rhs.numberColumns_;
     numberColumnsWithGaps_ = rhs.numberColumnsWithGaps_;
@@ -8360,6 +8376,12 @@ void ClpPackedMatrix3::transposeTimes(const ClpSimplex *model,
    Note - x packed and z will be packed mode
    Squashes small elements and knows about ClpSimplex
    - does dualColumn0 */
+// Threading dual pricing is only worth it with enough columns
+#ifndef CLP_THREAD_DUAL_COLUMNS
+#define CLP_THREAD_DUAL_COLUMNS 20000
+#endif
+// Maximum number of chunks of blocks
+#define CLP_THREAD_DUAL_CHUNKS 64
 void ClpPackedMatrix3::transposeTimes(const ClpSimplex *model,
   const double *COIN_RESTRICT pi,
   CoinIndexedVector *output,
@@ -8471,9 +8493,109 @@ void ClpPackedMatrix3::transposeTimes(const ClpSimplex *model,
       }
     }
   }
+  ClpThreadPool *pool = ClpThreadPool::pool();
+  int numberChunks = 1;
+  if (!pool->serial() && numberColumns_ >= CLP_THREAD_DUAL_COLUMNS)
+    numberChunks = CoinMin(CoinMin(2 * pool->numberThreads(), CLP_THREAD_DUAL_CHUNKS),
+      numberBlocks_);
+  if (numberChunks <= 1) {
+    int numberCandidates;
+    numberNonZero += transposeTimesDual(0, numberBlocks_, pi, reducedCost,
+      zeroTolerance, dualT, acceptablePivot,
+      array + numberNonZero, index + numberNonZero,
+      spareArray + numberRemaining, spareIndex + numberRemaining,
+      numberCandidates, upperTheta);
+    numberRemaining += numberCandidates;
+  } else {
+    // get scratch (kept for life of copy so threads write to same place)
+    if (!dualScratch_) {
+      int size = CLP_THREAD_DUAL_CHUNKS * COIN_AVX2;
+      for (int iBlock = 0; iBlock < numberBlocks_; iBlock++)
+        size += block_[iBlock].numberInBlock_ + COIN_AVX2;
+      dualScratchSize_ = size;
+      dualScratch_ = new double[2 * size];
+      CoinZeroN(dualScratch_, size);
+      dualScratchIndex_ = new int[2 * size];
+    }
+    // split blocks so chunks have about same work
+    double totalWork = 0.0;
+    for (int iBlock = 0; iBlock < numberBlocks_; iBlock++)
+      totalWork += (1 + block_[iBlock].numberElements_) * block_[iBlock].firstBasic_;
+    double eachWork = totalWork / numberChunks;
+    int endChunk[CLP_THREAD_DUAL_CHUNKS + 1];
+    int scratchStart[CLP_THREAD_DUAL_CHUNKS + 1];
+    endChunk[0] = 0;
+    scratchStart[0] = 0;
+    int nChunks = 0;
+    double thisWork = 0.0;
+    int size = 0;
+    for (int iBlock = 0; iBlock < numberBlocks_; iBlock++) {
+      thisWork += (1 + block_[iBlock].numberElements_) * block_[iBlock].firstBasic_;
+      size += block_[iBlock].firstBasic_ + COIN_AVX2;
+      if ((thisWork >= eachWork * (nChunks + 1) && nChunks < numberChunks - 1)
+        || iBlock == numberBlocks_ - 1) {
+        nChunks++;
+        endChunk[nChunks] = iBlock + 1;
+        scratchStart[nChunks] = scratchStart[nChunks - 1] + size + COIN_AVX2;
+        size = 0;
+      }
+    }
+    assert(scratchStart[nChunks] <= dualScratchSize_);
+    int numberIn[CLP_THREAD_DUAL_CHUNKS];
+    int numberCandidates[CLP_THREAD_DUAL_CHUNKS];
+    double chunkTheta[CLP_THREAD_DUAL_CHUNKS];
+    double *COIN_RESTRICT spareArray2 = dualScratch_ + dualScratchSize_;
+    int *COIN_RESTRICT spareIndex2 = dualScratchIndex_ + dualScratchSize_;
+    {
+      ClpTaskGroup group(pool);
+      for (int iChunk = 0; iChunk < nChunks; iChunk++) {
+        int put = scratchStart[iChunk];
+        chunkTheta[iChunk] = upperTheta;
+        group.spawn([=, &endChunk, &numberIn, &numberCandidates, &chunkTheta]() {
+          numberIn[iChunk] = transposeTimesDual(endChunk[iChunk], endChunk[iChunk + 1],
+            pi, reducedCost, zeroTolerance, dualT, acceptablePivot,
+            dualScratch_ + put, dualScratchIndex_ + put,
+            spareArray2 + put, spareIndex2 + put,
+            numberCandidates[iChunk], chunkTheta[iChunk]);
+        });
+      }
+      group.wait();
+    }
+    // put together in block order so same answer as serial
+    for (int iChunk = 0; iChunk < nChunks; iChunk++) {
+      int put = scratchStart[iChunk];
+      int n = numberIn[iChunk];
+      CoinMemcpyN(dualScratch_ + put, n, array + numberNonZero);
+      CoinZeroN(dualScratch_ + put, n);
+      CoinMemcpyN(dualScratchIndex_ + put, n, index + numberNonZero);
+      numberNonZero += n;
+      n = numberCandidates[iChunk];
+      CoinMemcpyN(spareArray2 + put, n, spareArray + numberRemaining);
+      CoinMemcpyN(spareIndex2 + put, n, spareIndex + numberRemaining);
+      numberRemaining += n;
+      upperTheta = CoinMin(upperTheta, chunkTheta[iChunk]);
+    }
+  }
+  output->setNumElements(numberNonZero);
+  candidate->setNumElements(numberRemaining);
+  model->spareDoubleArray_[0] = upperTheta;
+}
+/* Blocks firstBlock to lastBlock-1 of transposeTimes with dualColumn0.
+   Done by chunks of blocks when threaded. */
+int ClpPackedMatrix3::transposeTimesDual(int firstBlock, int lastBlock,
+  const double *COIN_RESTRICT pi, const double *COIN_RESTRICT reducedCost,
+  double zeroTolerance, double dualT, double acceptablePivot,
+  double *COIN_RESTRICT array, int *COIN_RESTRICT index,
+  double *COIN_RESTRICT spareArray, int *COIN_RESTRICT spareIndex,
+  int &numberCandidates, double &upperThetaInOut) const
+{
+  int numberNonZero = 0;
+  int numberRemaining = 0;
+  double tentativeTheta = 1.0e15;
+  double upperTheta = upperThetaInOut;
   int numberOld = numberNonZero;
   int nMax = 0;
-  for (int iBlock = 0; iBlock < numberBlocks_; iBlock++) {
+  for (int iBlock = firstBlock; iBlock < lastBlock; iBlock++) {
     // C) Can do two at a time (if so put odd one into start_)
     // D) can use switch
     blockStruct *block = block_ + iBlock;
@@ -8865,9 +8987,9 @@ void ClpPackedMatrix3::transposeTimes(const ClpSimplex *model,
   }
   for (int j = numberNonZero; j < nMax; j++)
     array[j] = 0.0;
-  output->setNumElements(numberNonZero);
-  candidate->setNumElements(numberRemaining);
-  model->spareDoubleArray_[0] = upperTheta;
+  numberCandidates = numberRemaining;
+  upperThetaInOut = upperTheta;
+  return numberNonZero;
 }
 static void
 transposeTimes3Bit2Odd(clpTempInfo &info)
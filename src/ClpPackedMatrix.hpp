@@ -502,8 +502,7 @@ protected:
   ClpPackedMatrix3 *columnCopy_;
   //@}
 };
-#ifdef THREAD
-#include <pthread.h>
+/// Work for one block of ClpPackedMatrix2::transposeTimes (may be a task)
 typedef struct {
   double acceptablePivot;
   const ClpSimplex *model;
@@ -526,7 +525,6 @@ typedef struct {
   int numberInRowArray;
   int numberLook;
 } dualColumn0Struct;
-#endif
 class CLPLIB_EXPORT ClpPackedMatrix2 {
 
 public:
@@ -582,10 +580,8 @@ protected:
   unsigned short *column_;
   /// work arrays
   double *work_;
-#ifdef THREAD
-  pthread_t *threadId_;
+  /// Per block information when threaded
   dualColumn0Struct *info_;
-#endif
   //@}
 };
 typedef struct {
@@ -632,6 +628,17 @@ public:
     // Array for exact devex to say what is in reference framework
     unsigned int *reference,
     double *weights, double scaleFactor);
+  /** Blocks firstBlock to lastBlock-1 of transposeTimes with dualColumn0.
+      Packed alphas go to array,index and possible pivots to spare,spareIndex.
+      Returns number in array, sets numberCandidates and reduces upperTheta.
+      With more than one thread in ClpThreadPool chunks of blocks are done
+      in parallel (each into its own part of scratch) and then merged.
+  */
+  int transposeTimesDual(int firstBlock, int lastBlock,
+    const double *pi, const double *reducedCost,
+    double zeroTolerance, double dualT, double acceptablePivot,
+    double *array, int *index, double *spare, int *spareIndex,
+    int &numberCandidates, double &upperTheta) const;
   //@}
 
   /**@name Constructors, destructor */
@@ -715,6 +722,12 @@ protected:
   /** Set if blocks sorted so +1s first and each block has equal number
       of +1s and others */
   int plusOnes_;
+  /// Scratch for threaded dual pricing (array then spare)
+  mutable double *dualScratch_;
+  /// Scratch for threaded dual pricing (index then spareIndex)
+  mutable int *dualScratchIndex_;
+  /// Size of each half of dual scratch
+  mutable int dualScratchSize_;
   //@}
 };
 #elif INCLUDE_MATRIX3_PRICING==1
@@ -54,6 +54,7 @@ public:
       BARRIER,
       BASISIN,
       BASISOUT,
+      BENCHMARK,
       CLEARCUTS,
       DUALSIMPLEX,
       EITHERSIMPLEX,
@@ -64,9 +65,11 @@ public:
       NETLIB_PRIMAL,
       NETLIB_TUNE,
       NETWORK,
+      NETWORKSIMPLEX,
       PARAMETRICS,
       PLUSMINUS,
       PRIMALSIMPLEX,
+      RACE,
       REALLY_SCALE,
       REVERSE,
       STDIN,
@@ -172,6 +175,7 @@ public:
       DENSE,
       DUALIZE,
       IDIOT,
+      IDIOTBLOCKS,
       MAXFACTOR,
       MAXITERATION,
       MORESPECIALOPTIONS,
@@ -178,6 +178,7 @@ void ClpParameters::setDefaults(int strategy) {
       parameters_[ClpParam::DENSE]->setDefault(-1);
       parameters_[ClpParam::DUALIZE]->setDefault(0);
       parameters_[ClpParam::IDIOT]->setDefault(0);
+      parameters_[ClpParam::IDIOTBLOCKS]->setDefault(1);
       parameters_[ClpParam::MAXFACTOR]->setDefault(0);
       parameters_[ClpParam::MAXITERATION]->setDefault(0);
       parameters_[ClpParam::MORESPECIALOPTIONS]->setDefault(0);
@@ -189,6 +190,7 @@ void ClpParameters::setDefaults(int strategy) {
       parameters_[ClpParam::SPECIALOPTIONS]->setDefault(0);
       parameters_[ClpParam::SPRINT]->setDefault(0);
       parameters_[ClpParam::SUBSTITUTION]->setDefault(3);
+      parameters_[ClpParam::THREADS]->setDefault(1);
 #ifdef CLP_THREAD
       parameters_[ClpParam::SUBSTITUTION]->setDefault(3);
 #endif
@@ -420,6 +422,20 @@ void ClpParameters::addClpActionParams() {
       "'default.bas'.",
       CoinParam::displayPriorityHigh);
   
+  parameters_[ClpParam::BENCHMARK]->setup(
+      "bench!mark", "Time netlib instances under several algorithms",
+      "This reads each instance from the netlib directory given by "
+      "'dirNetlib' and solves it several times under each algorithm and "
+      "thread count, recording wall and cpu time, iterations, "
+      "factorizations and peak memory.  Results go to name.json and "
+      "name.csv so that runs of different versions can be compared.  The "
+      "value is a comma separated list of instance names or the sets small, "
+      "medium, large or netlib, together with options algorithms=a+b "
+      "(dual, primal, barrier, either, race, abc-dual, abc-primal), "
+      "threads=n+m, repeats=n and output=name e.g. clp -benchmark "
+      "small,algorithms=dual+barrier,threads=1+4,repeats=5,output=rel1",
+      CoinParam::displayPriorityLow);
+
   parameters_[ClpParam::DUALSIMPLEX]->setup(
       "dualS!implex", "Do dual simplex algorithm",
       "This command solves the continuous relaxation of the current model "
@@ -486,6 +502,15 @@ void ClpParameters::addClpActionParams() {
       "probably not be as fast as a specialized network code.",
       CoinParam::displayPriorityLow);
 
+  parameters_[ClpParam::NETWORKSIMPLEX]->setup(
+      "networkS!implex", "Solve using network simplex if a network",
+      "This command solves the continuous relaxation of the current model "
+      "with a primal network simplex code if every column has at most one "
+      "+1 and one -1 (possibly after multiplying some rows by -1).  The "
+      "solution is then cleaned up by primal simplex.  If the model is not "
+      "a network dual simplex is used instead.",
+      CoinParam::displayPriorityHigh);
+
   parameters_[ClpParam::PARAMETRICS]->setup(
       "para!metrics", "Import data from file and do parametrics",
       "This will read a file with parametric data from the given file name and "
@@ -525,6 +550,16 @@ void ClpParameters::addClpActionParams() {
       "dual and primal tolerances.",
       CoinParam::displayPriorityHigh);
 
+  parameters_[ClpParam::RACE]->setup(
+      "race", "Race dual, primal and barrier algorithms",
+      "This command solves the continuous relaxation of the current model "
+      "by running dual simplex, primal simplex and barrier (with crossover) "
+      "at the same time, each on its own copy of the model.  The first to "
+      "finish wins and the others are stopped.  They only run together if "
+      "threads is at least 3.  This uses more memory but can be much faster "
+      "when it is not clear which algorithm suits a model.",
+      CoinParam::displayPriorityHigh);
+
   parameters_[ClpParam::REALLY_SCALE]->setup("reallyS!cale",
                                             "Scales model in place", "",
                                             CoinParam::displayPriorityLow);
@@ -1320,6 +1355,15 @@ void ClpParameters::addClpIntParams() {
       "simplex algorithm.  It can be set to -1 when the code decides for "
       "itself whether to use it, 0 to switch off, or n > 0 to do n passes.");
 
+  parameters_[ClpParam::IDIOTBLOCKS]->setup(
+      "idiotB!locks", "Column blocks idiot crash sweeps at the same time", 1,
+      64,
+      "Idiot crash splits the columns into this many blocks and sweeps them "
+      "at the same time using the threads set by threads.  Block moves are "
+      "averaged so the result depends on this value but not on the number of "
+      "threads.  Blocks have at least 1000 columns.  1 is the old serial "
+      "sweep.");
+
   parameters_[ClpParam::MAXFACTOR]->setup(
       "maxF!actor", "Maximum number of iterations between refactorizations", 1,
       COIN_INT_MAX, 
@@ -1400,6 +1444,12 @@ void ClpParameters::addClpIntParams() {
       "better to use one or two more than number of cpus available.  If 100+n "
       "then n threads and search is repeatable (maybe be somewhat slower), if "
       "200+n use threads for root cuts, 400+n threads used in sub-trees.");
+#else
+  parameters_[ClpParam::THREADS]->setup(
+      "thread!s", "Number of threads to try and use", 0, 1024,
+      "Number of threads (including the main one) used by the parallel parts "
+      "of Clp.  0 means one per hardware thread.  With abc on or decide the "
+      "Abc code splits its work over this many threads.");
 #endif
 
   if (cbcMode_){
@@ -24,6 +24,52 @@
 #include <string>
 #include <cstdio>
 #include <iostream>
+// Aspiration levels solved together for each centrality corrector
+#ifndef CLP_CORRECTOR_CANDIDATES
+#define CLP_CORRECTOR_CANDIDATES 2
+#endif
+// Most centrality correctors per factorization
+#ifndef CLP_MAXIMUM_CORRECTORS
+#define CLP_MAXIMUM_CORRECTORS 8
+#endif
+/* Below this estimated factorization work keep old fixed number of
+   correctors done one at a time with iterative refinement */
+#ifndef CLP_CORRECTOR_SMALL_WORK
+#define CLP_CORRECTOR_SMALL_WORK 1.0e6
+#endif
+/* Estimated work for factorization - at least rows*(average column
+   count)^2 - from sizes so iterates do not depend on machine or load */
+static double clpFactorWork(const ClpCholeskyBase *cholesky)
+{
+  int numberRows = cholesky->numberRows();
+  double sizeFactor = cholesky->size();
+  return numberRows ? sizeFactor * sizeFactor / numberRows : 0.0;
+}
+/* Number of centrality correctors worth trying given work for
+   factorization and for one direction (as Gondzio).  A direction is
+   two passes over factor and a few over matrix.
+*/
+static int clpNumberCorrectors(const ClpCholeskyBase *cholesky,
+  const ClpMatrixBase *matrix)
+{
+  int numberRows = cholesky->numberRows();
+  double sizeFactor = cholesky->size();
+  double factorWork = clpFactorWork(cholesky);
+  if (factorWork < CLP_CORRECTOR_SMALL_WORK)
+    return 5;
+  double solveWork = 2.0 * sizeFactor + 4.0 * matrix->getNumElements() + numberRows;
+  double ratio = factorWork / solveWork;
+  int number;
+  if (ratio <= 10.0)
+    number = 2;
+  else if (ratio <= 30.0)
+    number = 3;
+  else if (ratio <= 50.0)
+    number = 4;
+  else
+    number = 5 + static_cast< int >(ratio / 100.0);
+  return CoinMin(number, CLP_MAXIMUM_CORRECTORS);
+}
 #if 0
 static int yyyyyy = 0;
 void ClpPredictorCorrector::saveSolution(std::string fileName)
@@ -76,6 +122,9 @@ int ClpPredictorCorrector::solve()
 {
   problemStatus_ = -1;
   algorithm_ = 1;
+  // warm start no good if rows or columns added or deleted since
+  if (warmStart_ && (warmStartRows_ != numberRows_ || warmStartColumns_ != numberColumns_))
+    clearWarmStart();
   //create all regions
   if (!createWorkingData()) {
     problemStatus_ = 4;
@@ -136,8 +185,14 @@ int ClpPredictorCorrector::solve()
 
   //bool firstTime=true;
   //firstFactorization(true);
-  int returnCode = cholesky_->order(this);
-  if (returnCode || cholesky_->symbolic()) {
+  // ordering and symbolic can be kept if pattern same as last time
+  int returnCode = 0;
+  if (!cholesky_->reuseSymbolic(this)) {
+    returnCode = cholesky_->order(this);
+    if (!returnCode)
+      returnCode = cholesky_->symbolic();
+  }
+  if (returnCode) {
     COIN_DETAIL_PRINT(printf("Error return from symbolic - probably not enough memory\n"));
     problemStatus_ = 4;
     //delete all temporary regions
@@ -175,7 +230,12 @@ int ClpPredictorCorrector::solve()
   CoinWorkDouble *dualArray = reinterpret_cast< CoinWorkDouble * >(dual_);
   // Could try centering steps without any original step i.e. just center
   //firstFactorization(false);
-  CoinZeroN(dualArray, numberRows_);
+  if (!warmStart_) {
+    CoinZeroN(dualArray, numberRows_);
+  } else {
+    // duals set by warmSolution - only use once
+    clearWarmStart();
+  }
   multiplyAdd(solution_ + numberColumns_, numberRows_, -1.0, errorRegion_, 0.0);
   matrix_->times(1.0, solution_, errorRegion_);
   maximumRHSError_ = maximumAbsElement(errorRegion_, numberRows_);
@@ -825,7 +885,18 @@ int ClpPredictorCorrector::solve()
       goodMove = false; // don't bother
     if ((modeSwitch & 1) != 0)
       goodMove = false;
-    while (goodMove && numberTries < 5) {
+    int maximumCorrectors = clpNumberCorrectors(cholesky_, matrix_);
+    if (goodMove && cholesky_->type() < 20
+      && clpFactorWork(cholesky_) >= CLP_CORRECTOR_SMALL_WORK) {
+      // big normal equations - candidates can share solves
+      CoinWorkDouble centerGap = 0.0;
+      numberGoodTries = centralityCorrectors(maximumCorrectors, nextGap, centerGap);
+#ifdef COIN_DETAIL
+      nextCenterGap = centerGap;
+#endif
+      goodMove = false;
+    }
+    while (goodMove && numberTries < maximumCorrectors) {
       goodMove = false;
       numberTries++;
       CoinMemcpyN(deltaX_, numberTotal, saveX);
@@ -1752,6 +1823,42 @@ CoinWorkDouble ClpPredictorCorrector::findDirectionVector(const int phase)
   delete[] region1Save;
   delete[] newError;
   // now rest
+  completeDirection();
+#if 0
+     CoinWorkDouble * check = new CoinWorkDouble[numberTotal];
+     // Check out rhsC_
+     multiplyAdd(deltaY_, numberRows_, -1.0, check + numberColumns_, 0.0);
+     CoinZeroN(check, numberColumns_);
+     matrix_->transposeTimes(1.0, deltaY_, check);
+     quadraticDjs(check, deltaX_, -1.0);
+     for (iColumn = 0; iColumn < numberTotal; iColumn++) {
+          check[iColumn] += deltaZ_[iColumn] - deltaW_[iColumn];
+          if (CoinAbs(check[iColumn] - rhsC_[iColumn]) > 1.0e-3)
+               printf("rhsC %d %g %g\n", iColumn, check[iColumn], rhsC_[iColumn]);
+     }
+     // Check out rhsZ_
+     for (iColumn = 0; iColumn < numberTotal; iColumn++) {
+          check[iColumn] += lowerSlack_[iColumn] * deltaZ_[iColumn] +
+                            zVec_[iColumn] * deltaSL_[iColumn];
+          if (CoinAbs(check[iColumn] - rhsZ_[iColumn]) > 1.0e-3)
+               printf("rhsZ %d %g %g\n", iColumn, check[iColumn], rhsZ_[iColumn]);
+     }
+     // Check out rhsW_
+     for (iColumn = 0; iColumn < numberTotal; iColumn++) {
+          check[iColumn] += upperSlack_[iColumn] * deltaW_[iColumn] +
+                            wVec_[iColumn] * deltaSU_[iColumn];
+          if (CoinAbs(check[iColumn] - rhsW_[iColumn]) > 1.0e-3)
+               printf("rhsW %d %g %g\n", iColumn, check[iColumn], rhsW_[iColumn]);
+     }
+     delete [] check;
+#endif
+  return relativeError;
+}
+/* Sets deltaZ_, deltaW_, deltaSL_ and deltaSU_ from deltaX_ and
+   right hand sides */
+void ClpPredictorCorrector::completeDirection()
+{
+  int iColumn;
   CoinWorkDouble extra = eExtra;
   //multiplyAdd(deltaY_,numberRows_,1.0,deltaW_+numberColumns_,0.0);
   //CoinZeroN(deltaW_,numberColumns_);
@@ -1816,35 +1923,6 @@ CoinWorkDouble ClpPredictorCorrector::findDirectionVector(const int phase)
       }
     }
   }
-#if 0
-     CoinWorkDouble * check = new CoinWorkDouble[numberTotal];
-     // Check out rhsC_
-     multiplyAdd(deltaY_, numberRows_, -1.0, check + numberColumns_, 0.0);
-     CoinZeroN(check, numberColumns_);
-     matrix_->transposeTimes(1.0, deltaY_, check);
-     quadraticDjs(check, deltaX_, -1.0);
-     for (iColumn = 0; iColumn < numberTotal; iColumn++) {
-          check[iColumn] += deltaZ_[iColumn] - deltaW_[iColumn];
-          if (CoinAbs(check[iColumn] - rhsC_[iColumn]) > 1.0e-3)
-               printf("rhsC %d %g %g\n", iColumn, check[iColumn], rhsC_[iColumn]);
-     }
-     // Check out rhsZ_
-     for (iColumn = 0; iColumn < numberTotal; iColumn++) {
-          check[iColumn] += lowerSlack_[iColumn] * deltaZ_[iColumn] +
-                            zVec_[iColumn] * deltaSL_[iColumn];
-          if (CoinAbs(check[iColumn] - rhsZ_[iColumn]) > 1.0e-3)
-               printf("rhsZ %d %g %g\n", iColumn, check[iColumn], rhsZ_[iColumn]);
-     }
-     // Check out rhsW_
-     for (iColumn = 0; iColumn < numberTotal; iColumn++) {
-          check[iColumn] += upperSlack_[iColumn] * deltaW_[iColumn] +
-                            wVec_[iColumn] * deltaSU_[iColumn];
-          if (CoinAbs(check[iColumn] - rhsW_[iColumn]) > 1.0e-3)
-               printf("rhsW %d %g %g\n", iColumn, check[iColumn], rhsW_[iColumn]);
-     }
-     delete [] check;
-#endif
-  return relativeError;
 }
 // createSolution.  Creates solution from scratch
 int ClpPredictorCorrector::createSolution()
@@ -2010,6 +2088,8 @@ int ClpPredictorCorrector::createSolution()
   if (rhsNorm_ < 1.0) {
     rhsNorm_ = 1.0;
   }
+  if (warmStart_)
+    return warmSolution();
   int *rowsDropped = new int[numberRows_];
   int returnCode = cholesky_->factorize(diagonal_, rowsDropped);
   if (returnCode == -1) {
@@ -2336,6 +2416,144 @@ int ClpPredictorCorrector::createSolution()
 #endif
   return 0;
 }
+/* Warm start.  Previous solution and duals are scaled as in
+   createWorkingData (and createSolution for objective) and then
+   slacks and bound duals are shifted away from zero as in Mehrotra -
+   first by a small amount and then by amounts which balance
+   complementarity.  Slacks need not agree with solution as any
+   difference is treated as primal infeasibility. */
+int ClpPredictorCorrector::warmSolution()
+{
+  int numberTotal = numberRows_ + numberColumns_;
+  int iColumn;
+  const double *warmPrimal = warmStart_;
+  const double *warmDual = warmStart_ + numberTotal;
+  CoinWorkDouble *dualArray = reinterpret_cast< CoinWorkDouble * >(dual_);
+  CoinWorkDouble scaleC = optimizationDirection_ / objectiveScale_;
+  CoinWorkDouble dualScale = scaleC ? 1.0 / (scaleC * scaleFactor_) : 0.0;
+  for (iColumn = 0; iColumn < numberTotal; iColumn++) {
+    CoinWorkDouble primalMultiplier = rhsScale_;
+    CoinWorkDouble dualMultiplier = dualScale;
+    if (rowScale_) {
+      if (iColumn < numberColumns_) {
+        primalMultiplier /= columnScale_[iColumn];
+        dualMultiplier *= columnScale_[iColumn];
+      } else {
+        primalMultiplier *= rowScale_[iColumn - numberColumns_];
+        dualMultiplier /= rowScale_[iColumn - numberColumns_];
+      }
+    }
+    if (iColumn >= numberColumns_)
+      dualArray[iColumn - numberColumns_] = warmDual[iColumn] * dualMultiplier;
+    if (!flagged(iColumn)) {
+      CoinWorkDouble value = warmPrimal[iColumn] * primalMultiplier;
+      // back inside bounds
+      if (lowerBound(iColumn))
+        value = CoinMax(value, lower_[iColumn]);
+      if (upperBound(iColumn))
+        value = CoinMin(value, upper_[iColumn]);
+      solution_[iColumn] = value;
+      dj_[iColumn] = warmDual[iColumn] * dualMultiplier;
+    }
+  }
+  CoinZeroN(deltaX_, numberTotal);
+  solutionNorm_ = maximumAbsElement(solution_, numberTotal);
+  // Long way from bounds (or free) - as createSolution
+  CoinWorkDouble largeGap = CoinMax(1.0e7, 1.02 * solutionNorm_);
+  for (iColumn = 0; iColumn < numberTotal; iColumn++) {
+    if (!flagged(iColumn)) {
+      CoinWorkDouble primalValue = solution_[iColumn];
+      if (primalValue > lower_[iColumn] + largeGap && primalValue < upper_[iColumn] - largeGap) {
+        clearFixedOrFree(iColumn);
+        setLowerBound(iColumn);
+        setUpperBound(iColumn);
+        lower_[iColumn] = CoinMax(lower_[iColumn], primalValue - largeGap);
+        upper_[iColumn] = CoinMin(upper_[iColumn], primalValue + largeGap);
+      }
+    }
+  }
+  // Totals for balancing shift
+  CoinWorkDouble sumComplementarity = 0.0;
+  CoinWorkDouble sumSlack = 0.0;
+  CoinWorkDouble sumDual = 0.0;
+  int numberPairs = 0;
+  for (iColumn = 0; iColumn < numberTotal; iColumn++) {
+    if (!flagged(iColumn)) {
+      CoinWorkDouble primalValue = solution_[iColumn];
+      CoinWorkDouble reducedCost = dj_[iColumn];
+      if (lowerBound(iColumn)) {
+        CoinWorkDouble low = primalValue - lower_[iColumn];
+        CoinWorkDouble z = CoinMax(reducedCost, static_cast< CoinWorkDouble >(0.0));
+        sumComplementarity += low * z;
+        sumSlack += low;
+        sumDual += z;
+        numberPairs++;
+      }
+      if (upperBound(iColumn)) {
+        CoinWorkDouble high = upper_[iColumn] - primalValue;
+        CoinWorkDouble w = CoinMax(-reducedCost, static_cast< CoinWorkDouble >(0.0));
+        sumComplementarity += high * w;
+        sumSlack += high;
+        sumDual += w;
+        numberPairs++;
+      }
+    }
+  }
+  CoinWorkDouble primalShift = 1.0e-4 * CoinMax(static_cast< CoinWorkDouble >(1.0), solutionNorm_);
+  CoinWorkDouble dualShift = 1.0e-4 * CoinMax(static_cast< CoinWorkDouble >(1.0), objectiveNorm_);
+  if (numberPairs) {
+    CoinWorkDouble shiftedComplementarity = sumComplementarity + primalShift * sumDual
+      + dualShift * sumSlack + numberPairs * primalShift * dualShift;
+    CoinWorkDouble shiftedSlack = sumSlack + numberPairs * primalShift;
+    CoinWorkDouble shiftedDual = sumDual + numberPairs * dualShift;
+    primalShift += 0.5 * shiftedComplementarity / shiftedDual;
+    dualShift += 0.5 * shiftedComplementarity / shiftedSlack;
+  }
+  handler_->message(CLP_BARRIER_WARM, messages_)
+    << static_cast< double >(primalShift) << static_cast< double >(dualShift)
+    << CoinMessageEol;
+  CoinWorkDouble gamma2 = gamma_ * gamma_; // gamma*gamma will be added to diagonal
+  for (iColumn = 0; iColumn < numberTotal; iColumn++) {
+    if (!flagged(iColumn)) {
+      CoinWorkDouble primalValue = solution_[iColumn];
+      CoinWorkDouble reducedCost = dj_[iColumn];
+      CoinWorkDouble gammaTerm = gamma2;
+      if (primalR_)
+        gammaTerm += primalR_[iColumn];
+      CoinWorkDouble low = 0.0;
+      CoinWorkDouble high = 0.0;
+      zVec_[iColumn] = 0.0;
+      wVec_[iColumn] = 0.0;
+      if (lowerBound(iColumn)) {
+        low = primalValue - lower_[iColumn] + primalShift;
+        zVec_[iColumn] = CoinMax(reducedCost, static_cast< CoinWorkDouble >(0.0)) + dualShift;
+      }
+      if (upperBound(iColumn)) {
+        high = upper_[iColumn] - primalValue + primalShift;
+        wVec_[iColumn] = CoinMax(-reducedCost, static_cast< CoinWorkDouble >(0.0)) + dualShift;
+      }
+      if (lowerBound(iColumn)) {
+        if (upperBound(iColumn))
+          diagonal_[iColumn] = (high * low) / (low * wVec_[iColumn] + high * zVec_[iColumn] + gammaTerm * high * low);
+        else
+          diagonal_[iColumn] = low / (zVec_[iColumn] + low * gammaTerm);
+      } else if (upperBound(iColumn)) {
+        diagonal_[iColumn] = high / (wVec_[iColumn] + high * gammaTerm);
+      }
+      lowerSlack_[iColumn] = low;
+      upperSlack_[iColumn] = high;
+    } else {
+      // fixed
+      lowerSlack_[iColumn] = 0.0;
+      upperSlack_[iColumn] = 0.0;
+      solution_[iColumn] = lower_[iColumn];
+      zVec_[iColumn] = 0.0;
+      wVec_[iColumn] = 0.0;
+      diagonal_[iColumn] = 0.0;
+    }
+  }
+  return 0;
+}
 // complementarityGap.  Computes gap
 //phase 0=as is , 1 = after predictor , 2 after corrector
 CoinWorkDouble ClpPredictorCorrector::complementarityGap(int &numberComplementarityPairs,
@@ -2607,67 +2825,9 @@ void ClpPredictorCorrector::setupForSolve(const int phase)
     }
     break;
   case 3: {
-    CoinWorkDouble minBeta = 0.1 * mu_;
-    CoinWorkDouble maxBeta = 10.0 * mu_;
     CoinWorkDouble dualStep = CoinMin(1.0, actualDualStep_ + 0.1);
     CoinWorkDouble primalStep = CoinMin(1.0, actualPrimalStep_ + 0.1);
-#ifdef SOME_DEBUG
-    printf("good complementarity range %g to %g\n", minBeta, maxBeta);
-#endif
-    //minBeta=0.0;
-    //maxBeta=COIN_DBL_MAX;
-    for (iColumn = 0; iColumn < numberTotal; iColumn++) {
-      if (!flagged(iColumn)) {
-        if (lowerBound(iColumn)) {
-          CoinWorkDouble change = -rhsL_[iColumn] + deltaX_[iColumn];
-          CoinWorkDouble dualValue = zVec_[iColumn] + dualStep * deltaZ_[iColumn];
-          CoinWorkDouble primalValue = lowerSlack_[iColumn] + primalStep * change;
-          CoinWorkDouble gapProduct = dualValue * primalValue;
-          if (gapProduct > 0.0 && dualValue < 0.0)
-            gapProduct = -gapProduct;
-#ifdef FULL_DEBUG
-          delta2Z_[iColumn] = gapProduct;
-          if (delta2Z_[iColumn] < minBeta || delta2Z_[iColumn] > maxBeta)
-            printf("lower %d primal %g, dual %g, gap %g\n",
-              iColumn, primalValue, dualValue, gapProduct);
-#endif
-          CoinWorkDouble value = 0.0;
-          if (gapProduct < minBeta) {
-            value = 2.0 * (minBeta - gapProduct);
-            value = (mu_ - gapProduct);
-            value = (minBeta - gapProduct);
-            assert(value > 0.0);
-          } else if (gapProduct > maxBeta) {
-            value = CoinMax(maxBeta - gapProduct, -maxBeta);
-            assert(value < 0.0);
-          }
-          rhsZ_[iColumn] += value;
-        }
-        if (upperBound(iColumn)) {
-          CoinWorkDouble change = rhsU_[iColumn] - deltaX_[iColumn];
-          CoinWorkDouble dualValue = wVec_[iColumn] + dualStep * deltaW_[iColumn];
-          CoinWorkDouble primalValue = upperSlack_[iColumn] + primalStep * change;
-          CoinWorkDouble gapProduct = dualValue * primalValue;
-          if (gapProduct > 0.0 && dualValue < 0.0)
-            gapProduct = -gapProduct;
-#ifdef FULL_DEBUG
-          delta2W_[iColumn] = gapProduct;
-          if (delta2W_[iColumn] < minBeta || delta2W_[iColumn] > maxBeta)
-            printf("upper %d primal %g, dual %g, gap %g\n",
-              iColumn, primalValue, dualValue, gapProduct);
-#endif
-          CoinWorkDouble value = 0.0;
-          if (gapProduct < minBeta) {
-            value = (minBeta - gapProduct);
-            assert(value > 0.0);
-          } else if (gapProduct > maxBeta) {
-            value = CoinMax(maxBeta - gapProduct, -maxBeta);
-            assert(value < 0.0);
-          }
-          rhsW_[iColumn] += value;
-        }
-      }
-    }
+    centralityTargets(dualStep, primalStep, rhsZ_, rhsW_);
   } break;
   } /* endswitch */
   if (cholesky_->type() < 20) {
@@ -2739,6 +2899,232 @@ void ClpPredictorCorrector::setupForSolve(const int phase)
     }
   }
 }
+/* Adds to rhsZ and rhsW the terms which would bring complementarity
+   products into range 0.1*mu to 10*mu after steps of dualStep and
+   primalStep (Gondzio centrality corrector) */
+void ClpPredictorCorrector::centralityTargets(CoinWorkDouble dualStep, CoinWorkDouble primalStep,
+  CoinWorkDouble *rhsZ, CoinWorkDouble *rhsW)
+{
+  int numberTotal = numberRows_ + numberColumns_;
+  int iColumn;
+  CoinWorkDouble minBeta = 0.1 * mu_;
+  CoinWorkDouble maxBeta = 10.0 * mu_;
+#ifdef SOME_DEBUG
+  printf("good complementarity range %g to %g\n", minBeta, maxBeta);
+#endif
+  //minBeta=0.0;
+  //maxBeta=COIN_DBL_MAX;
+  for (iColumn = 0; iColumn < numberTotal; iColumn++) {
+    if (!flagged(iColumn)) {
+      if (lowerBound(iColumn)) {
+        CoinWorkDouble change = -rhsL_[iColumn] + deltaX_[iColumn];
+        CoinWorkDouble dualValue = zVec_[iColumn] + dualStep * deltaZ_[iColumn];
+        CoinWorkDouble primalValue = lowerSlack_[iColumn] + primalStep * change;
+        CoinWorkDouble gapProduct = dualValue * primalValue;
+        if (gapProduct > 0.0 && dualValue < 0.0)
+          gapProduct = -gapProduct;
+#ifdef FULL_DEBUG
+        delta2Z_[iColumn] = gapProduct;
+        if (delta2Z_[iColumn] < minBeta || delta2Z_[iColumn] > maxBeta)
+          printf("lower %d primal %g, dual %g, gap %g\n",
+            iColumn, primalValue, dualValue, gapProduct);
+#endif
+        CoinWorkDouble value = 0.0;
+        if (gapProduct < minBeta) {
+          value = 2.0 * (minBeta - gapProduct);
+          value = (mu_ - gapProduct);
+          value = (minBeta - gapProduct);
+          assert(value > 0.0);
+        } else if (gapProduct > maxBeta) {
+          value = CoinMax(maxBeta - gapProduct, -maxBeta);
+          assert(value < 0.0);
+        }
+        rhsZ[iColumn] += value;
+      }
+      if (upperBound(iColumn)) {
+        CoinWorkDouble change = rhsU_[iColumn] - deltaX_[iColumn];
+        CoinWorkDouble dualValue = wVec_[iColumn] + dualStep * deltaW_[iColumn];
+        CoinWorkDouble primalValue = upperSlack_[iColumn] + primalStep * change;
+        CoinWorkDouble gapProduct = dualValue * primalValue;
+        if (gapProduct > 0.0 && dualValue < 0.0)
+          gapProduct = -gapProduct;
+#ifdef FULL_DEBUG
+        delta2W_[iColumn] = gapProduct;
+        if (delta2W_[iColumn] < minBeta || delta2W_[iColumn] > maxBeta)
+          printf("upper %d primal %g, dual %g, gap %g\n",
+            iColumn, primalValue, dualValue, gapProduct);
+#endif
+        CoinWorkDouble value = 0.0;
+        if (gapProduct < minBeta) {
+          value = (minBeta - gapProduct);
+          assert(value > 0.0);
+        } else if (gapProduct > maxBeta) {
+          value = CoinMax(maxBeta - gapProduct, -maxBeta);
+          assert(value < 0.0);
+        }
+        rhsW[iColumn] += value;
+      }
+    }
+  }
+}
+/* Gondzio centrality correctors using normal equations.  The system is
+   linear so a corrector is current direction plus solution for just
+   the extra complementarity terms.  Each round does those terms for
+   several aspiration levels and solves them together, keeping the
+   candidate which gives longest acceptable steps.
+   Returns number of rounds which improved direction.
+*/
+int ClpPredictorCorrector::centralityCorrectors(int maximumCorrectors,
+  CoinWorkDouble nextGap, CoinWorkDouble &centerGap)
+{
+  int numberTotal = numberRows_ + numberColumns_;
+  CoinWorkDouble extra = eExtra;
+  const char *dropped = cholesky_->rowsDropped();
+  CoinWorkDouble *saveX = new CoinWorkDouble[numberTotal];
+  CoinWorkDouble *saveY = new CoinWorkDouble[numberRows_];
+  CoinWorkDouble *saveZ = new CoinWorkDouble[numberTotal];
+  CoinWorkDouble *saveW = new CoinWorkDouble[numberTotal];
+  CoinWorkDouble *correctionX[CLP_CORRECTOR_CANDIDATES];
+  CoinWorkDouble *correctionY[CLP_CORRECTOR_CANDIDATES];
+  CoinWorkDouble *correctionZ[CLP_CORRECTOR_CANDIDATES];
+  CoinWorkDouble *correctionW[CLP_CORRECTOR_CANDIDATES];
+  int iCandidate;
+  for (iCandidate = 0; iCandidate < CLP_CORRECTOR_CANDIDATES; iCandidate++) {
+    correctionX[iCandidate] = new CoinWorkDouble[numberTotal];
+    correctionY[iCandidate] = new CoinWorkDouble[numberRows_];
+    correctionZ[iCandidate] = new CoinWorkDouble[numberTotal];
+    correctionW[iCandidate] = new CoinWorkDouble[numberTotal];
+  }
+  int numberGoodTries = 0;
+  int iColumn;
+  int iRow;
+  for (int iTry = 0; iTry < maximumCorrectors; iTry++) {
+    CoinMemcpyN(deltaX_, numberTotal, saveX);
+    CoinMemcpyN(deltaY_, numberRows_, saveY);
+    CoinMemcpyN(rhsZ_, numberTotal, saveZ);
+    CoinMemcpyN(rhsW_, numberTotal, saveW);
+    CoinWorkDouble savePrimalStep = actualPrimalStep_;
+    CoinWorkDouble saveDualStep = actualDualStep_;
+    CoinWorkDouble saveMu = mu_;
+    // candidate right hand sides - aiming further each time
+    CoinWorkDouble *regions[CLP_CORRECTOR_CANDIDATES];
+    int numberCandidates = 0;
+    for (iCandidate = 0; iCandidate < CLP_CORRECTOR_CANDIDATES; iCandidate++) {
+      CoinWorkDouble aspiration = 0.1 + 0.2 * iCandidate;
+      CoinWorkDouble dualStep = CoinMin(1.0, saveDualStep + aspiration);
+      CoinWorkDouble primalStep = CoinMin(1.0, savePrimalStep + aspiration);
+      CoinWorkDouble *valueZ = correctionZ[numberCandidates];
+      CoinWorkDouble *valueW = correctionW[numberCandidates];
+      CoinWorkDouble *work = correctionX[numberCandidates];
+      CoinWorkDouble *region = correctionY[numberCandidates];
+      CoinZeroN(valueZ, numberTotal);
+      CoinZeroN(valueW, numberTotal);
+      centralityTargets(dualStep, primalStep, valueZ, valueW);
+      // as setupForSolve with all other right hand sides zero
+      for (iColumn = 0; iColumn < numberTotal; iColumn++) {
+        CoinWorkDouble value = 0.0;
+        if (lowerBound(iColumn))
+          value -= valueZ[iColumn] / (lowerSlack_[iColumn] + extra);
+        if (upperBound(iColumn))
+          value += valueW[iColumn] / (upperSlack_[iColumn] + extra);
+        work[iColumn] = diagonal_[iColumn] * value;
+      }
+      multiplyAdd(work + numberColumns_, numberRows_, -1.0, region, 0.0);
+      matrix_->times(1.0, work, region);
+      if (maximumAbsElement(region, numberRows_) > 1.0e-30)
+        regions[numberCandidates++] = region;
+    }
+    if (!numberCandidates)
+      break;
+    cholesky_->solveMultiple(regions, numberCandidates);
+    // back to full directions and see which is best
+    int bestCandidate = -1;
+    CoinWorkDouble bestStep = 0.0;
+    CoinWorkDouble checkDual = saveDualStep;
+    CoinWorkDouble checkPrimal = savePrimalStep;
+    // If one small then that's the one that counts
+    if (checkDual > 5.0 * checkPrimal) {
+      checkDual = 2.0 * checkPrimal;
+    } else if (checkPrimal > 5.0 * checkDual) {
+      checkPrimal = 2.0 * checkDual;
+    }
+    for (iCandidate = 0; iCandidate < numberCandidates; iCandidate++) {
+      CoinWorkDouble *work = correctionX[iCandidate];
+      CoinWorkDouble *region = correctionY[iCandidate];
+      multiplyAdd(NULL, numberRows_, 0.0, region, diagonalScaleFactor_);
+      // work still has right hand side for columns
+      CoinMemcpyN(work, numberTotal, deltaX_);
+      multiplyAdd(region, numberRows_, -1.0, work + numberColumns_, 0.0);
+      CoinZeroN(work, numberColumns_);
+      matrix_->transposeTimes(1.0, region, work);
+      for (iColumn = 0; iColumn < numberTotal; iColumn++)
+        work[iColumn] = work[iColumn] * diagonal_[iColumn] - deltaX_[iColumn];
+      for (iRow = 0; iRow < numberRows_; iRow++) {
+        if (dropped[iRow])
+          region[iRow] = 0.0;
+      }
+      for (iColumn = 0; iColumn < numberTotal; iColumn++) {
+        deltaX_[iColumn] = saveX[iColumn] + work[iColumn];
+        rhsZ_[iColumn] = saveZ[iColumn] + correctionZ[iCandidate][iColumn];
+        rhsW_[iColumn] = saveW[iColumn] + correctionW[iCandidate][iColumn];
+      }
+      completeDirection();
+      findStepLength(3);
+      int nextNumber;
+      int nextNumberItems;
+      CoinWorkDouble xGap = complementarityGap(nextNumber, nextNumberItems, 3);
+      if (actualPrimalStep_ >= checkPrimal && actualDualStep_ >= checkDual && (xGap <= nextGap || xGap <= 0.9 * complementarityGap_)) {
+        CoinWorkDouble step = CoinMin(actualPrimalStep_, actualDualStep_);
+        if (step > bestStep) {
+          bestStep = step;
+          bestCandidate = iCandidate;
+          centerGap = xGap;
+        }
+      }
+#ifdef SOME_DEBUG
+      printf("PP candidate %d gap %.18g, steps %.18g %.18g, 2 gap %.18g, steps %.18g %.18g\n",
+        iCandidate, xGap, actualPrimalStep_, actualDualStep_, nextGap, savePrimalStep, saveDualStep);
+#endif
+      mu_ = saveMu;
+    }
+    // put back best (or original)
+    for (iColumn = 0; iColumn < numberTotal; iColumn++) {
+      deltaX_[iColumn] = saveX[iColumn];
+      rhsZ_[iColumn] = saveZ[iColumn];
+      rhsW_[iColumn] = saveW[iColumn];
+    }
+    CoinMemcpyN(saveY, numberRows_, deltaY_);
+    if (bestCandidate >= 0) {
+      multiplyAdd(correctionX[bestCandidate], numberTotal, 1.0, deltaX_, 1.0);
+      multiplyAdd(correctionY[bestCandidate], numberRows_, 1.0, deltaY_, 1.0);
+      multiplyAdd(correctionZ[bestCandidate], numberTotal, 1.0, rhsZ_, 1.0);
+      multiplyAdd(correctionW[bestCandidate], numberTotal, 1.0, rhsW_, 1.0);
+    }
+    completeDirection();
+    findStepLength(3);
+    mu_ = saveMu;
+    if (bestCandidate < 0) {
+      actualPrimalStep_ = savePrimalStep;
+      actualDualStep_ = saveDualStep;
+      break;
+    }
+    numberGoodTries++;
+    // See if big enough change
+    if (actualPrimalStep_ < 1.01 * checkPrimal || actualDualStep_ < 1.01 * checkDual)
+      break;
+  }
+  for (iCandidate = 0; iCandidate < CLP_CORRECTOR_CANDIDATES; iCandidate++) {
+    delete[] correctionX[iCandidate];
+    delete[] correctionY[iCandidate];
+    delete[] correctionZ[iCandidate];
+    delete[] correctionW[iCandidate];
+  }
+  delete[] saveX;
+  delete[] saveY;
+  delete[] saveZ;
+  delete[] saveW;
+  return numberGoodTries;
+}
 //method: sees if looks plausible change in complementarity
 bool ClpPredictorCorrector::checkGoodMove(const bool doCorrector,
   CoinWorkDouble &bestNextGap,
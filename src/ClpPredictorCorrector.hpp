@@ -59,6 +59,9 @@ public:
   CoinWorkDouble findDirectionVector(const int phase);
   /// createSolution.  Creates solution from scratch (- code if no memory)
   int createSolution();
+  /** warmSolution.  Creates solution from warm start by shifting
+      previous solution back into interior (called by createSolution) */
+  int warmSolution();
   /// complementarityGap.  Computes gap
   //phase 0=as is , 1 = after predictor , 2 after corrector
   CoinWorkDouble complementarityGap(int &numberComplementarityPairs, int &numberComplementarityItems,
@@ -71,6 +74,16 @@ public:
     const CoinWorkDouble *region1In, const CoinWorkDouble *region2In,
     const CoinWorkDouble *saveRegion1, const CoinWorkDouble *saveRegion2,
     bool gentleRefine);
+  /** Adds to rhsZ and rhsW corrections to bring complementarity
+      products after given steps back towards mu (Gondzio) */
+  void centralityTargets(CoinWorkDouble dualStep, CoinWorkDouble primalStep,
+    CoinWorkDouble *rhsZ, CoinWorkDouble *rhsW);
+  /** Centrality correctors for normal equations - candidates for several
+      aspiration levels are solved together.  Returns number which helped */
+  int centralityCorrectors(int maximumCorrectors, CoinWorkDouble nextGap,
+    CoinWorkDouble &centerGap);
+  /// Sets deltaZ, deltaW, deltaSL and deltaSU from deltaX and rhs
+  void completeDirection();
   /// sees if looks plausible change in complementarity
   bool checkGoodMove(const bool doCorrector, CoinWorkDouble &bestNextGap,
     bool allowIncreasingGap);
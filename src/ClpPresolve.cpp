@@ -9,6 +9,7 @@
 
 #include <cassert>
 #include <iostream>
+#include <vector>
 
 #include "CoinHelperFunctions.hpp"
 #include "ClpConfig.h"
@@ -25,6 +26,7 @@
 #endif
 
 #include "ClpPresolve.hpp"
+#include "ClpThreadPool.hpp"
 #include "CoinPresolveMatrix.hpp"
 
 #include "CoinPresolveEmpty.hpp"
@@ -44,6 +46,15 @@
 #include "CoinPresolveIsolated.hpp"
 #include "CoinMessage.hpp"
 
+// splitmix64 finalizer
+static inline CoinUInt64 clpMix(CoinUInt64 x)
+{
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
 ClpPresolve::ClpPresolve()
   : originalModel_(NULL)
   , presolvedModel_(NULL)
@@ -70,6 +81,12 @@ ClpPresolve::ClpPresolve()
   ,
 #endif
   presolveActions_(0)
+  , savedModel_(NULL)
+  , savedValues_(NULL)
+  , savedIndex_(NULL)
+  , savedHash_(0)
+  , numberReused_(0)
+  , distantDeductions_(false)
 {
 }
 
@@ -93,6 +110,17 @@ void ClpPresolve::destroyPresolve()
   originalRow_ = NULL;
   delete[] rowObjective_;
   rowObjective_ = NULL;
+  deleteSaved();
+}
+// Deletes saved information
+void ClpPresolve::deleteSaved()
+{
+  delete savedModel_;
+  delete[] savedValues_;
+  delete[] savedIndex_;
+  savedModel_ = NULL;
+  savedValues_ = NULL;
+  savedIndex_ = NULL;
 }
 
 /* This version of presolve returns a pointer to a new presolved
@@ -380,6 +408,232 @@ void ClpPresolve::setOriginalModel(ClpSimplex *model)
 {
   originalModel_ = model;
 }
+// Hash of everything presolve looks at except values
+static CoinUInt64 clpStructureHash(const ClpSimplex *model, int presolveActions,
+  int substitution)
+{
+  const CoinPackedMatrix *matrix = model->matrix();
+  const CoinBigIndex *columnStart = matrix->getVectorStarts();
+  const int *columnLength = matrix->getVectorLengths();
+  const int *row = matrix->getIndices();
+  const double *element = matrix->getElements();
+  const char *integer = model->integerInformation();
+  int numberColumns = model->numberColumns();
+  double sense = model->optimizationDirection();
+  CoinUInt64 senseBits;
+  memcpy(&senseBits, &sense, sizeof(double));
+  CoinUInt64 hash = clpMix(static_cast< CoinUInt64 >(model->numberRows()));
+  hash = clpMix(hash ^ static_cast< CoinUInt64 >(numberColumns));
+  hash = clpMix(hash ^ senseBits);
+  hash = clpMix(hash ^ static_cast< CoinUInt64 >(static_cast< unsigned int >(presolveActions)));
+  hash = clpMix(hash ^ static_cast< CoinUInt64 >(substitution));
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    CoinUInt64 value = static_cast< CoinUInt64 >(columnLength[iColumn]);
+    if (integer && integer[iColumn])
+      value |= 0x100000000ULL;
+    hash = clpMix(hash ^ value);
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      CoinUInt64 bits;
+      memcpy(&bits, element + j, sizeof(double));
+      hash = clpMix(hash ^ static_cast< CoinUInt64 >(row[j]));
+      hash = clpMix(hash ^ bits);
+    }
+  }
+  return hash;
+}
+// Saves information after presolvedModel so can be reused
+void ClpPresolve::savePresolve()
+{
+  deleteSaved();
+  if (!presolvedModel_ || presolvedModel_ == originalModel_ || rowObjective_ || nelems_ < 0)
+    return;
+  if (originalModel_->objectiveAsObject()->type() != 1 || presolvedModel_->objectiveAsObject()->type() != 1)
+    return;
+  /* Dual, tighten and implied free deductions can rest on values any
+     number of rows and columns away, which the neighbour test below
+     can not see - so never reuse after them */
+  if (distantDeductions_)
+    return;
+  savedHash_ = clpStructureHash(originalModel_, presolveActions_, substitution_);
+  savedModel_ = new ClpSimplex(*presolvedModel_);
+  // values as presolve saw them
+  savedValues_ = new double[3 * ncols_ + 2 * nrows_];
+  CoinMemcpyN(originalModel_->columnLower(), ncols_, savedValues_);
+  CoinMemcpyN(originalModel_->columnUpper(), ncols_, savedValues_ + ncols_);
+  CoinMemcpyN(originalModel_->objective(), ncols_, savedValues_ + 2 * ncols_);
+  CoinMemcpyN(originalModel_->rowLower(), nrows_, savedValues_ + 3 * ncols_);
+  CoinMemcpyN(originalModel_->rowUpper(), nrows_, savedValues_ + 3 * ncols_ + nrows_);
+  savedIndex_ = new int[ncols_ + nrows_];
+  int *columnIndex = savedIndex_;
+  int *rowIndex = savedIndex_ + ncols_;
+  for (int i = 0; i < ncols_ + nrows_; i++)
+    savedIndex_[i] = -1;
+  const CoinPackedMatrix *matrix0 = originalModel_->matrix();
+  const CoinBigIndex *columnStart0 = matrix0->getVectorStarts();
+  const int *columnLength0 = matrix0->getVectorLengths();
+  const int *row0 = matrix0->getIndices();
+  const double *element0 = matrix0->getElements();
+  const CoinPackedMatrix *matrix = presolvedModel_->matrix();
+  const CoinBigIndex *columnStart = matrix->getVectorStarts();
+  const int *columnLength = matrix->getVectorLengths();
+  const int *row = matrix->getIndices();
+  const double *element = matrix->getElements();
+  int numberColumns = presolvedModel_->numberColumns();
+  int numberRows = presolvedModel_->numberRows();
+  // rows with same bounds and same number of elements
+  int *mark = new int[nrows_];
+  double *work = new double[nrows_];
+  CoinZeroN(mark, nrows_);
+  for (int iColumn = 0; iColumn < ncols_; iColumn++) {
+    for (CoinBigIndex j = columnStart0[iColumn];
+         j < columnStart0[iColumn] + columnLength0[iColumn]; j++)
+      mark[row0[j]]++;
+  }
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++)
+      mark[originalRow_[row[j]]]--;
+  }
+  const double *rowLower0 = originalModel_->rowLower();
+  const double *rowUpper0 = originalModel_->rowUpper();
+  const double *rowLower = presolvedModel_->rowLower();
+  const double *rowUpper = presolvedModel_->rowUpper();
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    int kRow = originalRow_[iRow];
+    if (!mark[kRow] && rowLower[iRow] == rowLower0[kRow] && rowUpper[iRow] == rowUpper0[kRow])
+      rowIndex[kRow] = iRow;
+  }
+  // columns with same bounds, cost and elements
+  for (int iRow = 0; iRow < nrows_; iRow++)
+    mark[iRow] = -1;
+  const double *columnLower0 = originalModel_->columnLower();
+  const double *columnUpper0 = originalModel_->columnUpper();
+  const double *cost0 = originalModel_->objective();
+  const double *columnLower = presolvedModel_->columnLower();
+  const double *columnUpper = presolvedModel_->columnUpper();
+  const double *cost = presolvedModel_->objective();
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    int kColumn = originalColumn_[iColumn];
+    bool same = columnLength[iColumn] == columnLength0[kColumn]
+      && columnLower[iColumn] == columnLower0[kColumn]
+      && columnUpper[iColumn] == columnUpper0[kColumn]
+      && cost[iColumn] == cost0[kColumn];
+    if (same) {
+      for (CoinBigIndex j = columnStart0[kColumn];
+           j < columnStart0[kColumn] + columnLength0[kColumn]; j++) {
+        mark[row0[j]] = kColumn;
+        work[row0[j]] = element0[j];
+      }
+      for (CoinBigIndex j = columnStart[iColumn];
+           j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+        int kRow = originalRow_[row[j]];
+        if (mark[kRow] != kColumn || work[kRow] != element[j]) {
+          same = false;
+          break;
+        }
+      }
+    }
+    if (same) {
+      columnIndex[kColumn] = iColumn;
+    } else {
+      for (CoinBigIndex j = columnStart[iColumn];
+           j < columnStart[iColumn] + columnLength[iColumn]; j++)
+        rowIndex[originalRow_[row[j]]] = -1;
+    }
+  }
+  /* Presolve may have used values of a row or column to change a
+     neighbour, so a row or column only counts if all neighbours
+     were also left alone */
+  char *bad = new char[ncols_ + nrows_];
+  memset(bad, 0, ncols_ + nrows_);
+  for (int iColumn = 0; iColumn < ncols_; iColumn++) {
+    for (CoinBigIndex j = columnStart0[iColumn];
+         j < columnStart0[iColumn] + columnLength0[iColumn]; j++) {
+      int iRow = row0[j];
+      if (columnIndex[iColumn] < 0)
+        bad[ncols_ + iRow] = 1;
+      if (rowIndex[iRow] < 0)
+        bad[iColumn] = 1;
+    }
+  }
+  for (int i = 0; i < ncols_ + nrows_; i++) {
+    if (bad[i])
+      savedIndex_[i] = -1;
+  }
+  delete[] bad;
+  delete[] mark;
+  delete[] work;
+}
+// Saves status and solution of presolved model (before postsolve)
+void ClpPresolve::saveBasis()
+{
+  if (!savedModel_ || !presolvedModel_ || !presolvedModel_->statusArray())
+    return;
+  int numberColumns = savedModel_->numberColumns();
+  int numberRows = savedModel_->numberRows();
+  if (presolvedModel_->numberColumns() != numberColumns || presolvedModel_->numberRows() != numberRows)
+    return;
+  if (!savedModel_->statusArray())
+    savedModel_->createStatus();
+  CoinMemcpyN(presolvedModel_->statusArray(), numberColumns + numberRows,
+    savedModel_->statusArray());
+  CoinMemcpyN(presolvedModel_->primalColumnSolution(), numberColumns,
+    savedModel_->primalColumnSolution());
+  CoinMemcpyN(presolvedModel_->primalRowSolution(), numberRows,
+    savedModel_->primalRowSolution());
+}
+/* Returns copy of saved presolved model with new values from si
+   or NULL if a full presolve is needed */
+ClpSimplex *
+ClpPresolve::reusedPresolvedModel(ClpSimplex &si)
+{
+  if (!savedModel_ || si.numberColumns() != ncols_ || si.numberRows() != nrows_
+    || si.objectiveAsObject()->type() != 1)
+    return NULL;
+  if (clpStructureHash(&si, presolveActions_, substitution_) != savedHash_)
+    return NULL;
+  const double *value[5];
+  value[0] = si.columnLower();
+  value[1] = si.columnUpper();
+  value[2] = si.objective();
+  value[3] = si.rowLower();
+  value[4] = si.rowUpper();
+  double *put[5];
+  put[0] = savedModel_->columnLower();
+  put[1] = savedModel_->columnUpper();
+  put[2] = savedModel_->objective();
+  put[3] = savedModel_->rowLower();
+  put[4] = savedModel_->rowUpper();
+  // first see if all changes allowed
+  for (int iType = 0; iType < 5; iType++) {
+    int n = (iType < 3) ? ncols_ : nrows_;
+    const int *index = (iType < 3) ? savedIndex_ : savedIndex_ + ncols_;
+    const double *old = savedValues_ + ((iType < 3) ? iType * ncols_ : 3 * ncols_ + (iType - 3) * nrows_);
+    const double *thisValue = value[iType];
+    for (int i = 0; i < n; i++) {
+      if (thisValue[i] != old[i] && index[i] < 0)
+        return NULL;
+    }
+  }
+  for (int iType = 0; iType < 5; iType++) {
+    int n = (iType < 3) ? ncols_ : nrows_;
+    const int *index = (iType < 3) ? savedIndex_ : savedIndex_ + ncols_;
+    double *old = savedValues_ + ((iType < 3) ? iType * ncols_ : 3 * ncols_ + (iType - 3) * nrows_);
+    const double *thisValue = value[iType];
+    double *thisPut = put[iType];
+    for (int i = 0; i < n; i++) {
+      if (thisValue[i] != old[i]) {
+        old[i] = thisValue[i];
+        thisPut[index[i]] = thisValue[i];
+      }
+    }
+  }
+  originalModel_ = &si;
+  presolvedModel_ = new ClpSimplex(*savedModel_);
+  numberReused_++;
+  return presolvedModel_;
+}
 #if 0
 // A lazy way to restrict which transformations are applied
 // during debugging.
@@ -483,6 +737,29 @@ void check_sol(CoinPresolveMatrix *prob, double tol)
   delete[] rsol;
 }
 #endif
+// Vectors per chunk below which detection scans stay serial
+#define CLP_PRESOLVE_GRAIN 4096
+/* Column is a candidate for tightenDoubletons2 if it has two elements,
+   both rows are doubletons with one other column in common.  This does
+   not look at bounds or costs (which tightenDoubletons2 changes).
+*/
+static inline bool doubletonCandidate(int icol, const CoinBigIndex *mcstrt,
+  const int *hincol, const int *hrow, const CoinBigIndex *mrstrt,
+  const int *hinrow, const int *hcol)
+{
+  if (hincol[icol] != 2)
+    return false;
+  CoinBigIndex start = mcstrt[icol];
+  int row0 = hrow[start];
+  int row1 = hrow[start + 1];
+  if (hinrow[row0] != 2 || hinrow[row1] != 2)
+    return false;
+  CoinBigIndex start0 = mrstrt[row0];
+  int other0 = (hcol[start0] != icol) ? hcol[start0] : hcol[start0 + 1];
+  CoinBigIndex start1 = mrstrt[row1];
+  int other1 = (hcol[start1] != icol) ? hcol[start1] : hcol[start1 + 1];
+  return other0 == other1 && other0 != icol;
+}
 static int tightenDoubletons2(CoinPresolveMatrix *prob)
 {
   // column-major representation
@@ -518,8 +795,19 @@ static int tightenDoubletons2(CoinPresolveMatrix *prob)
   double alpha[2] = { 0.0, 0.0 };
   double offset = 0.0;
 
+  /* Structure does not change in this pass so candidates can be found
+     in parallel - they are then done in order as before */
+  std::vector< char > candidate(ncols);
+  int numberChunks = CoinMin(ClpThreadPool::pool()->numberThreads(),
+    ncols / CLP_PRESOLVE_GRAIN + 1);
+  clpParallelFor(0, ncols, 1, [&](int first, int last) {
+    for (int icol = first; icol < last; icol++)
+      candidate[icol] = doubletonCandidate(icol, mcstrt, hincol, hrow,
+        mrstrt, hinrow, hcol);
+  },
+    numberChunks);
   for (int icol = 0; icol < ncols; icol++) {
-    if (hincol[icol] == 2) {
+    if (candidate[icol]) {
       CoinBigIndex start = mcstrt[icol];
       int row0 = hrow[start];
       if (hinrow[row0] != 2)
@@ -956,6 +1244,7 @@ const CoinPresolveAction *ClpPresolve::presolve(CoinPresolveMatrix *prob)
   }
 #endif
   prob->status_ = 0; // say feasible
+  distantDeductions_ = false;
   printProgress('A', 0);
   paction_ = make_fixed(prob, paction_);
   paction_ = testRedundant(prob, paction_);
@@ -1067,7 +1356,12 @@ const CoinPresolveAction *ClpPresolve::presolve(CoinPresolveMatrix *prob)
       int iPass = 4;
       while (lastAction != paction_ && iPass) {
         lastAction = paction_;
-        paction_ = implied_free_action::presolve(prob, paction_, fill_level);
+        {
+          const CoinPresolveAction *const before = paction_;
+          paction_ = implied_free_action::presolve(prob, paction_, fill_level);
+          if (paction_ != before)
+            distantDeductions_ = true;
+        }
         printProgress('l', 0);
         iPass--;
       }
@@ -1141,7 +1435,12 @@ const CoinPresolveAction *ClpPresolve::presolve(CoinPresolveMatrix *prob)
         }
         if (zerocost) {
           possibleBreak;
-          paction_ = do_tighten_action::presolve(prob, paction_);
+          {
+            const CoinPresolveAction *const before = paction_;
+            paction_ = do_tighten_action::presolve(prob, paction_);
+            if (paction_ != before)
+              distantDeductions_ = true;
+          }
           if (prob->status_)
             break;
           printProgress('J', iLoop + 1);
@@ -1149,7 +1448,12 @@ const CoinPresolveAction *ClpPresolve::presolve(CoinPresolveMatrix *prob)
         if (dual && whichPass == 1) {
           // this can also make E rows so do one bit here
           possibleBreak;
-          paction_ = remove_dual_action::presolve(prob, paction_);
+          {
+            const CoinPresolveAction *const before = paction_;
+            paction_ = remove_dual_action::presolve(prob, paction_);
+            if (paction_ != before)
+              distantDeductions_ = true;
+          }
           if (prob->status_)
             break;
           printProgress('G', iLoop + 1);
@@ -1182,7 +1486,12 @@ const CoinPresolveAction *ClpPresolve::presolve(CoinPresolveMatrix *prob)
 
         if (ifree && (whichPass % 5) == 1) {
           possibleBreak;
-          paction_ = implied_free_action::presolve(prob, paction_, fill_level);
+          {
+            const CoinPresolveAction *const before = paction_;
+            paction_ = implied_free_action::presolve(prob, paction_, fill_level);
+            if (paction_ != before)
+              distantDeductions_ = true;
+          }
           if (prob->status_)
             break;
           printProgress('L', iLoop + 1);
@@ -1287,7 +1596,12 @@ const CoinPresolveAction *ClpPresolve::presolve(CoinPresolveMatrix *prob)
         int itry;
         for (itry = 0; itry < 5; itry++) {
           possibleBreak;
-          paction_ = remove_dual_action::presolve(prob, paction_);
+          {
+            const CoinPresolveAction *const before = paction_;
+            paction_ = remove_dual_action::presolve(prob, paction_);
+            if (paction_ != before)
+              distantDeductions_ = true;
+          }
           if (prob->status_)
             break;
           printProgress('M', iLoop + 1);
@@ -1302,7 +1616,12 @@ const CoinPresolveAction *ClpPresolve::presolve(CoinPresolveMatrix *prob)
 #endif
             if ((itry & 1) == 0) {
               possibleBreak;
-              paction_ = implied_free_action::presolve(prob, paction_, fill_level);
+              {
+                const CoinPresolveAction *const before = paction_;
+                paction_ = implied_free_action::presolve(prob, paction_, fill_level);
+                if (paction_ != before)
+                  distantDeductions_ = true;
+              }
             }
             if (prob->status_)
               break;
@@ -1321,7 +1640,12 @@ const CoinPresolveAction *ClpPresolve::presolve(CoinPresolveMatrix *prob)
 #endif
 #endif
         possibleBreak;
-        paction_ = implied_free_action::presolve(prob, paction_, fill_level);
+        {
+          const CoinPresolveAction *const before = paction_;
+          paction_ = implied_free_action::presolve(prob, paction_, fill_level);
+          if (paction_ != before)
+            distantDeductions_ = true;
+        }
         if (prob->status_)
           break;
         printProgress('O', iLoop + 1);
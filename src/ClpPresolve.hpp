@@ -311,6 +311,47 @@ public:
   /// Gets rid of presolve actions (e.g.when infeasible)
   void destroyPresolve();
 
+  /**@name Reusing presolve for repeated solves
+
+      Often only bounds, costs or row bounds change between solves.
+      savePresolve (after presolvedModel) keeps a copy of the presolved
+      model and notes which rows and columns presolve left alone - same
+      bounds, cost and elements in both models and the same is true of
+      all their neighbours.  reusedPresolvedModel then checks the model
+      has the same structure (matrix, integers, sense and presolve options)
+      and that every changed value is on one of those rows or columns.
+      If so the new values are put in and a copy of the saved model is
+      returned, otherwise NULL and a full presolve is needed.
+      saveBasis (before postsolve) keeps the optimal basis so the next
+      solve starts from it.  Dual, tighten and implied free deductions
+      can rest on values more than one row or column away, so nothing is
+      saved if any of them changed the model - switch them off (doDual,
+      doTighten, doImpliedFree) if reuse matters more.
+      Only for linear objectives without costed slacks.
+      ClpSolve::setSavedPresolve makes initialSolve do all this.
+  */
+  //@{
+  /** Returns copy of saved presolved model with new values from si
+        or NULL if a full presolve is needed.  Up to user to destroy */
+  ClpSimplex *reusedPresolvedModel(ClpSimplex &si);
+  /// Saves information after presolvedModel so can be reused
+  void savePresolve();
+  /// Saves status and solution of presolved model (before postsolve)
+  void saveBasis();
+  /// Number of times presolve reused
+  inline int numberReused() const
+  {
+    return numberReused_;
+  }
+  /** True if values of original column iSequence (or row
+      iSequence-numberColumns) can change and saved presolve still
+      be reused */
+  inline bool reusable(int iSequence) const
+  {
+    return savedIndex_ && savedIndex_[iSequence] >= 0;
+  }
+  //@}
+
   /**@name private or protected data */
 private:
   /// Original model - must not be destroyed before postsolve
@@ -354,6 +395,20 @@ private:
          and dual stuff on integers
      */
   int presolveActions_;
+  /// Saved presolved model for reuse
+  ClpSimplex *savedModel_;
+  /** Original bounds, costs and row bounds when saved
+        (column lower, column upper, cost, row lower, row upper) */
+  double *savedValues_;
+  /** For each original column then row - index in presolved model
+        if values can be changed there, otherwise -1 */
+  int *savedIndex_;
+  /// Hash of structure when saved
+  CoinUInt64 savedHash_;
+  /// Number of times presolve reused
+  int numberReused_;
+  /// True if dual, tighten or implied free presolve changed anything
+  bool distantDeductions_;
 
 protected:
   /// If you want to apply the individual presolve routines differently,
@@ -367,6 +422,8 @@ protected:
   /// if you want to add code to test for consistency
   /// while debugging new presolve techniques.
   virtual void postsolve(CoinPostsolveMatrix &prob);
+  /// Deletes saved information for reuse
+  void deleteSaved();
   /** This is main part of Presolve */
   virtual ClpSimplex *gutsOfPresolvedModel(ClpSimplex *originalModel,
     double feasibilityTolerance,
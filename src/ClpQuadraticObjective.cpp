@@ -8,6 +8,116 @@
 #include "ClpFactorization.hpp"
 #include "ClpSimplex.hpp"
 #include "ClpQuadraticObjective.hpp"
+#include "ClpThreadPool.hpp"
+
+/* Chunks for parallel evaluation - fixed so answers do not depend on
+   number of threads (only on whether threads are being used) */
+#define CLP_QUADRATIC_CHUNKS 8
+// Elements needed before evaluation goes parallel
+#define CLP_QUADRATIC_PARALLEL 100000
+// Dot product - four sums so compiler can vectorize
+static inline double clpDot(const double *COIN_RESTRICT element,
+  const double *COIN_RESTRICT x, int n)
+{
+  double sum0 = 0.0;
+  double sum1 = 0.0;
+  double sum2 = 0.0;
+  double sum3 = 0.0;
+  int i;
+  for (i = 0; i + 3 < n; i += 4) {
+    sum0 += element[i] * x[i];
+    sum1 += element[i + 1] * x[i + 1];
+    sum2 += element[i + 2] * x[i + 2];
+    sum3 += element[i + 3] * x[i + 3];
+  }
+  for (; i < n; i++)
+    sum0 += element[i] * x[i];
+  return (sum0 + sum1) + (sum2 + sum3);
+}
+/* Quadratic products for columns first to last-1.
+   For each column gets dotX = sum of element*x (and dotY for y) using
+   consecutive rows where possible.
+   Half matrix (full false) - each off diagonal element is used for both
+   (i,j) and (j,i) so gradient part is scattered as well.
+   If gradient then adds Q*x into it; sums[0] gets x'Qx/2 and if y
+   sums[1] y'Qy/2 and sums[2] y'Qx.
+*/
+static void clpQuadraticProducts(int first, int last, bool full,
+  const CoinBigIndex *columnStart, const int *columnLength,
+  const int *row, const double *element, const int *consecutive,
+  const double *x, const double *y, double *COIN_RESTRICT gradient,
+  double *sums)
+{
+  double xQx = 0.0;
+  double yQy = 0.0;
+  double yQx = 0.0;
+  for (int iColumn = first; iColumn < last; iColumn++) {
+    int n = columnLength[iColumn];
+    if (!n)
+      continue;
+    CoinBigIndex start = columnStart[iColumn];
+    double valueX = x[iColumn];
+    double valueY = y ? y[iColumn] : 0.0;
+    double diagonal = 0.0;
+    double dotX;
+    double dotY = 0.0;
+    int firstRow = consecutive[iColumn];
+    if (firstRow >= 0) {
+      const double *COIN_RESTRICT thisElement = element + start;
+      dotX = clpDot(thisElement, x + firstRow, n);
+      if (y)
+        dotY = clpDot(thisElement, y + firstRow, n);
+      if (!full) {
+        if (gradient && valueX) {
+          double *COIN_RESTRICT thisGradient = gradient + firstRow;
+          for (int k = 0; k < n; k++)
+            thisGradient[k] += valueX * thisElement[k];
+        }
+        if (iColumn >= firstRow && iColumn < firstRow + n)
+          diagonal = thisElement[iColumn - firstRow];
+      }
+    } else {
+      dotX = 0.0;
+      if (full) {
+        for (CoinBigIndex j = start; j < start + n; j++)
+          dotX += element[j] * x[row[j]];
+        if (y) {
+          for (CoinBigIndex j = start; j < start + n; j++)
+            dotY += element[j] * y[row[j]];
+        }
+      } else {
+        for (CoinBigIndex j = start; j < start + n; j++) {
+          int jColumn = row[j];
+          double value = element[j];
+          dotX += value * x[jColumn];
+          if (y)
+            dotY += value * y[jColumn];
+          if (gradient)
+            gradient[jColumn] += valueX * value;
+          if (jColumn == iColumn)
+            diagonal += value;
+        }
+      }
+    }
+    if (full) {
+      if (gradient)
+        gradient[iColumn] += dotX;
+      xQx += valueX * dotX;
+      yQy += valueY * dotY;
+      yQx += valueY * dotX;
+    } else {
+      // diagonal was counted twice
+      if (gradient)
+        gradient[iColumn] += dotX - valueX * diagonal;
+      xQx += valueX * (2.0 * dotX - valueX * diagonal);
+      yQy += valueY * (2.0 * dotY - valueY * diagonal);
+      yQx += valueY * dotX + valueX * dotY - valueX * valueY * diagonal;
+    }
+  }
+  sums[0] = 0.5 * xQx;
+  sums[1] = 0.5 * yQy;
+  sums[2] = yQx;
+}
 //#############################################################################
 // Constructors / Destructor / Assignment
 //#############################################################################
@@ -25,6 +135,8 @@ ClpQuadraticObjective::ClpQuadraticObjective()
   numberExtendedColumns_ = 0;
   activated_ = 0;
   fullMatrix_ = false;
+  consecutive_ = NULL;
+  consecutiveSize_ = 0;
 }
 
 //-------------------------------------------------------------------
@@ -59,6 +171,8 @@ ClpQuadraticObjective::ClpQuadraticObjective(const double *objective,
   gradient_ = NULL;
   activated_ = 1;
   fullMatrix_ = false;
+  consecutive_ = NULL;
+  consecutiveSize_ = 0;
 }
 
 //-------------------------------------------------------------------
@@ -71,6 +185,8 @@ ClpQuadraticObjective::ClpQuadraticObjective(const ClpQuadraticObjective &rhs,
   numberColumns_ = rhs.numberColumns_;
   numberExtendedColumns_ = rhs.numberExtendedColumns_;
   fullMatrix_ = rhs.fullMatrix_;
+  consecutive_ = NULL;
+  consecutiveSize_ = 0;
   if (rhs.objective_) {
     objective_ = new double[numberExtendedColumns_];
     CoinMemcpyN(rhs.objective_, numberExtendedColumns_, objective_);
@@ -198,6 +314,8 @@ ClpQuadraticObjective::ClpQuadraticObjective(const ClpQuadraticObjective &rhs,
   : ClpObjective(rhs)
 {
   fullMatrix_ = rhs.fullMatrix_;
+  consecutive_ = NULL;
+  consecutiveSize_ = 0;
   objective_ = NULL;
   int extra = rhs.numberExtendedColumns_ - rhs.numberColumns_;
   numberColumns_ = 0;
@@ -248,6 +366,7 @@ ClpQuadraticObjective::~ClpQuadraticObjective()
   delete[] objective_;
   delete[] gradient_;
   delete quadraticObjective_;
+  delete[] consecutive_;
 }
 
 //----------------------------------------------------------------
@@ -260,6 +379,7 @@ ClpQuadraticObjective::operator=(const ClpQuadraticObjective &rhs)
     fullMatrix_ = rhs.fullMatrix_;
     delete quadraticObjective_;
     quadraticObjective_ = NULL;
+    deleteConsecutive();
     delete[] objective_;
     delete[] gradient_;
     ClpObjective::operator=(rhs);
@@ -286,6 +406,128 @@ ClpQuadraticObjective::operator=(const ClpQuadraticObjective &rhs)
   return *this;
 }
 
+/* First row of each column if its rows are consecutive and increasing
+   (dense block) otherwise -1.  Always worked out from matrix as
+   quadraticObjective() gives out matrix which can be changed - only
+   the array is kept.  This is one pass over indices (stopping at first
+   gap) so cheap compared to products */
+const int *
+ClpQuadraticObjective::consecutiveRows() const
+{
+  const int *row = quadraticObjective_->getIndices();
+  const CoinBigIndex *columnStart = quadraticObjective_->getVectorStarts();
+  const int *columnLength = quadraticObjective_->getVectorLengths();
+  CoinBigIndex numberElements = quadraticObjective_->getNumElements();
+  int numberColumns = quadraticObjective_->getNumCols();
+  int numberAll = CoinMax(numberColumns, numberColumns_);
+  if (numberAll > consecutiveSize_) {
+    delete[] consecutive_;
+    consecutive_ = new int[numberAll];
+    consecutiveSize_ = numberAll;
+  }
+  int *consecutive = consecutive_;
+  int numberChunks = 1;
+  if (numberElements >= CLP_QUADRATIC_PARALLEL && numberColumns >= CLP_QUADRATIC_CHUNKS
+    && !ClpThreadPool::pool()->serial())
+    numberChunks = CLP_QUADRATIC_CHUNKS;
+  clpParallelFor(0, numberColumns, 1, [&](int firstColumn, int lastColumn) {
+    for (int iColumn = firstColumn; iColumn < lastColumn; iColumn++) {
+      CoinBigIndex start = columnStart[iColumn];
+      int n = columnLength[iColumn];
+      int firstRow = n ? row[start] : -1;
+      for (int k = 1; k < n; k++) {
+        if (row[start + k] != firstRow + k) {
+          firstRow = -1;
+          break;
+        }
+      }
+      consecutive[iColumn] = firstRow;
+    }
+  },
+    numberChunks);
+  for (int iColumn = numberColumns; iColumn < numberAll; iColumn++)
+    consecutive[iColumn] = -1;
+  return consecutive_;
+}
+// Forgets consecutive row information (matrix changed)
+void ClpQuadraticObjective::deleteConsecutive()
+{
+  delete[] consecutive_;
+  consecutive_ = NULL;
+  consecutiveSize_ = 0;
+}
+/* Unscaled quadratic products for whole matrix - in parallel if big.
+   sums[0] is x'Qx/2, if y sums[1] y'Qy/2 and sums[2] y'Qx.
+   If gradient then Q*x is added in */
+void ClpQuadraticObjective::quadraticProducts(const double *x, const double *y,
+  double *gradient, double *sums) const
+{
+  const int *consecutive = consecutiveRows();
+  const int *row = quadraticObjective_->getIndices();
+  const CoinBigIndex *columnStart = quadraticObjective_->getVectorStarts();
+  const int *columnLength = quadraticObjective_->getVectorLengths();
+  const double *element = quadraticObjective_->getElements();
+  CoinBigIndex numberElements = quadraticObjective_->getNumElements();
+  int numberChunks = 1;
+  if (numberElements >= CLP_QUADRATIC_PARALLEL && numberColumns_ >= CLP_QUADRATIC_CHUNKS
+    && !ClpThreadPool::pool()->serial())
+    numberChunks = CLP_QUADRATIC_CHUNKS;
+  if (numberChunks == 1) {
+    clpQuadraticProducts(0, numberColumns_, fullMatrix_, columnStart, columnLength,
+      row, element, consecutive, x, y, gradient, sums);
+    return;
+  }
+  // about same number of elements in each chunk
+  int chunkStart[CLP_QUADRATIC_CHUNKS + 1];
+  chunkStart[0] = 0;
+  int iChunk = 1;
+  double sum = 0.0;
+  double perChunk = static_cast< double >(numberElements) / numberChunks;
+  for (int iColumn = 0; iColumn < numberColumns_ && iChunk < numberChunks; iColumn++) {
+    sum += columnLength[iColumn];
+    while (iChunk < numberChunks && sum >= perChunk * iChunk)
+      chunkStart[iChunk++] = iColumn + 1;
+  }
+  while (iChunk <= numberChunks)
+    chunkStart[iChunk++] = numberColumns_;
+  double chunkSums[CLP_QUADRATIC_CHUNKS][3];
+  // half matrix scatters so each chunk needs own gradient
+  double *work = NULL;
+  if (gradient && !fullMatrix_) {
+    work = new double[(numberChunks - 1) * numberColumns_];
+    CoinZeroN(work, (numberChunks - 1) * numberColumns_);
+  }
+  clpParallelFor(0, numberChunks, 1, [&](int firstChunk, int lastChunk) {
+    for (int iChunk = firstChunk; iChunk < lastChunk; iChunk++) {
+      double *thisGradient = (work && iChunk) ? work + (iChunk - 1) * numberColumns_ : gradient;
+      clpQuadraticProducts(chunkStart[iChunk], chunkStart[iChunk + 1], fullMatrix_,
+        columnStart, columnLength, row, element, consecutive, x, y,
+        thisGradient, chunkSums[iChunk]);
+    }
+  },
+    numberChunks);
+  if (work) {
+    int numberColumns = numberColumns_;
+    clpParallelFor(0, numberColumns, 1, [&](int firstColumn, int lastColumn) {
+      for (int iColumn = firstColumn; iColumn < lastColumn; iColumn++) {
+        double value = gradient[iColumn];
+        for (int iChunk = 1; iChunk < numberChunks; iChunk++)
+          value += work[(iChunk - 1) * numberColumns + iColumn];
+        gradient[iColumn] = value;
+      }
+    },
+      numberChunks);
+    delete[] work;
+  }
+  sums[0] = 0.0;
+  sums[1] = 0.0;
+  sums[2] = 0.0;
+  for (int iChunk = 0; iChunk < numberChunks; iChunk++) {
+    sums[0] += chunkSums[iChunk][0];
+    sums[1] += chunkSums[iChunk][1];
+    sums[2] += chunkSums[iChunk][2];
+  }
+}
 // Returns gradient
 double *
 ClpQuadraticObjective::gradient(const ClpSimplex *model,
@@ -311,10 +553,6 @@ ClpQuadraticObjective::gradient(const ClpSimplex *model,
       if (refresh || !gradient_) {
         if (!gradient_)
           gradient_ = new double[numberExtendedColumns_];
-        const int *columnQuadratic = quadraticObjective_->getIndices();
-        const CoinBigIndex *columnQuadraticStart = quadraticObjective_->getVectorStarts();
-        const int *columnQuadraticLength = quadraticObjective_->getVectorLengths();
-        const double *quadraticElement = quadraticObjective_->getElements();
         offset = 0.0;
         // use current linear cost region
         if (includeLinear == 1)
@@ -324,56 +562,9 @@ ClpQuadraticObjective::gradient(const ClpSimplex *model,
         else
           memset(gradient_, 0, numberExtendedColumns_ * sizeof(double));
         if (activated_) {
-          if (!fullMatrix_) {
-            int iColumn;
-            for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
-              double valueI = solution[iColumn];
-              CoinBigIndex j;
-              for (j = columnQuadraticStart[iColumn];
-                   j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-                int jColumn = columnQuadratic[j];
-                double valueJ = solution[jColumn];
-                double elementValue = quadraticElement[j];
-                if (iColumn != jColumn) {
-                  offset += valueI * valueJ * elementValue;
-                  //if (fabs(valueI*valueJ*elementValue)>1.0e-12)
-                  //printf("%d %d %g %g %g -> %g\n",
-                  //       iColumn,jColumn,valueI,valueJ,elementValue,
-                  //       valueI*valueJ*elementValue);
-                  double gradientI = valueJ * elementValue;
-                  double gradientJ = valueI * elementValue;
-                  gradient_[iColumn] += gradientI;
-                  gradient_[jColumn] += gradientJ;
-                } else {
-                  offset += 0.5 * valueI * valueI * elementValue;
-                  //if (fabs(valueI*valueI*elementValue)>1.0e-12)
-                  //printf("XX %d %g %g -> %g\n",
-                  //       iColumn,valueI,elementValue,
-                  //       0.5*valueI*valueI*elementValue);
-                  double gradientI = valueI * elementValue;
-                  gradient_[iColumn] += gradientI;
-                }
-              }
-            }
-          } else {
-            // full matrix
-            int iColumn;
-            offset *= 2.0;
-            for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
-              CoinBigIndex j;
-              double value = 0.0;
-              double current = gradient_[iColumn];
-              for (j = columnQuadraticStart[iColumn];
-                   j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-                int jColumn = columnQuadratic[j];
-                double valueJ = solution[jColumn] * quadraticElement[j];
-                value += valueJ;
-              }
-              offset += value * solution[iColumn];
-              gradient_[iColumn] = current + value;
-            }
-            offset *= 0.5;
-          }
+          double sums[3];
+          quadraticProducts(solution, NULL, gradient_, sums);
+          offset = sums[0];
         }
       }
       if (model)
@@ -514,6 +705,7 @@ void ClpQuadraticObjective::resize(int newNumberColumns)
       for (i = numberColumns_; i < newNumberColumns; i++)
         gradient_[i] = 0.0;
     }
+    deleteConsecutive();
     if (quadraticObjective_) {
       if (newNumberColumns < numberColumns_) {
         int *which = new int[numberColumns_ - newNumberColumns];
@@ -592,6 +784,7 @@ void ClpQuadraticObjective::deleteSome(int numberToDelete, const int *which)
   }
   numberColumns_ = newNumberColumns;
   numberExtendedColumns_ = newExtended;
+  deleteConsecutive();
   if (quadraticObjective_) {
     quadraticObjective_->deleteCols(numberToDelete, which);
     quadraticObjective_->deleteRows(numberToDelete, which);
@@ -604,6 +797,7 @@ void ClpQuadraticObjective::loadQuadraticObjective(const int numberColumns, cons
 {
   fullMatrix_ = false;
   delete quadraticObjective_;
+  deleteConsecutive();
   quadraticObjective_ = new CoinPackedMatrix(true, numberColumns, numberColumns,
     start[numberColumns], element, column, start, NULL);
   numberColumns_ = numberColumns;
@@ -632,6 +826,7 @@ void ClpQuadraticObjective::loadQuadraticObjective(const int numberColumns, cons
 void ClpQuadraticObjective::loadQuadraticObjective(const CoinPackedMatrix &matrix)
 {
   delete quadraticObjective_;
+  deleteConsecutive();
   quadraticObjective_ = new CoinPackedMatrix(matrix);
 }
 // Get rid of quadratic objective
@@ -639,6 +834,7 @@ void ClpQuadraticObjective::deleteQuadraticObjective()
 {
   delete quadraticObjective_;
   quadraticObjective_ = NULL;
+  deleteConsecutive();
 }
 /* Returns reduced gradient.Returns an offset (to be added to current one).
  */
@@ -761,51 +957,11 @@ ClpQuadraticObjective::stepLength(ClpSimplex *model,
   double b = delta;
   double c = 0.0;
   if (!scaling) {
-    if (!fullMatrix_) {
-      int iColumn;
-      for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
-        double valueI = solution[iColumn];
-        double changeI = change[iColumn];
-        CoinBigIndex j;
-        for (j = columnQuadraticStart[iColumn];
-             j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-          int jColumn = columnQuadratic[j];
-          double valueJ = solution[jColumn];
-          double changeJ = change[jColumn];
-          double elementValue = quadraticElement[j];
-          if (iColumn != jColumn) {
-            a += changeI * changeJ * elementValue;
-            b += (changeI * valueJ + changeJ * valueI) * elementValue;
-            c += valueI * valueJ * elementValue;
-          } else {
-            a += 0.5 * changeI * changeI * elementValue;
-            b += changeI * valueI * elementValue;
-            c += 0.5 * valueI * valueI * elementValue;
-          }
-        }
-      }
-    } else {
-      // full matrix stored
-      int iColumn;
-      for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
-        double valueI = solution[iColumn];
-        double changeI = change[iColumn];
-        CoinBigIndex j;
-        for (j = columnQuadraticStart[iColumn];
-             j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-          int jColumn = columnQuadratic[j];
-          double valueJ = solution[jColumn];
-          double changeJ = change[jColumn];
-          double elementValue = quadraticElement[j];
-          valueJ *= elementValue;
-          a += changeI * changeJ * elementValue;
-          b += changeI * valueJ;
-          c += valueI * valueJ;
-        }
-      }
-      a *= 0.5;
-      c *= 0.5;
-    }
+    double sums[3];
+    quadraticProducts(solution, change, NULL, sums);
+    c = sums[0];
+    a = sums[1];
+    b += sums[2];
   } else {
     // scaling
     // for now only if half
@@ -916,40 +1072,9 @@ ClpQuadraticObjective::objectiveValue(const ClpSimplex *model, const double *sol
   const double *quadraticElement = quadraticObjective_->getElements();
   double c = 0.0;
   if (!scaling) {
-    if (!fullMatrix_) {
-      int iColumn;
-      for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
-        double valueI = solution[iColumn];
-        CoinBigIndex j;
-        for (j = columnQuadraticStart[iColumn];
-             j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-          int jColumn = columnQuadratic[j];
-          double valueJ = solution[jColumn];
-          double elementValue = quadraticElement[j];
-          if (iColumn != jColumn) {
-            c += valueI * valueJ * elementValue;
-          } else {
-            c += 0.5 * valueI * valueI * elementValue;
-          }
-        }
-      }
-    } else {
-      // full matrix stored
-      int iColumn;
-      for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
-        double valueI = solution[iColumn];
-        CoinBigIndex j;
-        for (j = columnQuadraticStart[iColumn];
-             j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-          int jColumn = columnQuadratic[j];
-          double valueJ = solution[jColumn];
-          double elementValue = quadraticElement[j];
-          valueJ *= elementValue;
-          c += valueI * valueJ;
-        }
-      }
-      c *= 0.5;
-    }
+    double sums[3];
+    quadraticProducts(solution, NULL, NULL, sums);
+    c = sums[0];
   } else {
     // scaling
     // for now only if half
@@ -136,6 +136,20 @@ public:
   }
   //@}
 
+  ///@name Kernels
+  //@{
+  /** Unscaled products with quadratic matrix.  sums[0] gets x'Qx/2 and
+        if y is given sums[1] y'Qy/2 and sums[2] y'Qx.  If gradient is
+        given Q*x is added into it.  A half matrix is used as symmetric
+        (each off diagonal element once for (i,j) and (j,i)) so there is
+        no need for a full copy.  Columns whose rows are consecutive (dense
+        blocks such as covariance matrices) use loops without indices and
+        large matrices are done in chunks in parallel.
+    */
+  void quadraticProducts(const double *x, const double *y,
+    double *gradient, double *sums) const;
+  //@}
+
   //---------------------------------------------------------------------------
 
 private:
@@ -152,7 +166,15 @@ private:
   int numberExtendedColumns_;
   /// True if full symmetric matrix, false if half
   bool fullMatrix_;
+  /// First row of each column if rows consecutive, otherwise -1
+  mutable int *consecutive_;
+  /// Allocated length of consecutive_
+  mutable int consecutiveSize_;
   //@}
+  /// Fills in consecutive_ from current matrix
+  const int *consecutiveRows() const;
+  /// Deletes consecutive_
+  void deleteConsecutive();
 };
 
 #endif
@@ -0,0 +1,448 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+
+#include <atomic>
+#include <cmath>
+
+#include "CoinHelperFunctions.hpp"
+#include "ClpSimdKernels.hpp"
+
+#if CLP_SIMD_DISPATCH
+/* avx512f implies fma to both compilers - products must not be fused
+   with adds or exact mode would not match the scalar code */
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#else
+#pragma GCC optimize("fp-contract=off")
+#endif
+#include <immintrin.h>
+#define CLP_TARGET_AVX2 __attribute__((target("avx2")))
+#define CLP_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+/* Atomic as kernels run on pool threads and may read these while
+   another thread sets them */
+// -1 until processor asked
+static std::atomic< int > clpSimdBest(-1);
+// -1 means best
+static std::atomic< int > clpSimdWanted(-1);
+static std::atomic< bool > clpSimdExactMode(false);
+
+int clpSimdAvailable()
+{
+  int best = clpSimdBest.load(std::memory_order_relaxed);
+  if (best < 0) {
+    best = CLP_SIMD_NONE;
+#if CLP_SIMD_DISPATCH
+    // this also checks operating system saves registers
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+      best = CLP_SIMD_AVX512;
+    else if (__builtin_cpu_supports("avx2"))
+      best = CLP_SIMD_AVX2;
+#endif
+    // any thread asking gets same answer so no harm if several do
+    clpSimdBest.store(best, std::memory_order_relaxed);
+  }
+  return best;
+}
+int clpSimdLevel()
+{
+  int best = clpSimdAvailable();
+  int wanted = clpSimdWanted.load(std::memory_order_relaxed);
+  return wanted < 0 ? best : CoinMin(wanted, best);
+}
+void clpSetSimdLevel(int level)
+{
+  clpSimdWanted.store(level, std::memory_order_relaxed);
+}
+bool clpSimdExact()
+{
+  return clpSimdExactMode.load(std::memory_order_relaxed);
+}
+void clpSetSimdExact(bool exact)
+{
+  clpSimdExactMode.store(exact, std::memory_order_relaxed);
+}
+/* Products are always formed as a separate statement so that no
+   compiler fuses them with the add - the scalar code in ClpPackedMatrix
+   is not fused either so exact mode gives the same bits. */
+static int clpTransposeTimesScalar(const double *COIN_RESTRICT pi,
+  const CoinBigIndex *COIN_RESTRICT columnStart,
+  const int *COIN_RESTRICT row,
+  const double *COIN_RESTRICT element,
+  const double *COIN_RESTRICT columnScale,
+  const unsigned char *COIN_RESTRICT status,
+  int numberColumns,
+  int *COIN_RESTRICT index,
+  double *COIN_RESTRICT array,
+  double zeroTolerance)
+{
+  int numberNonZero = 0;
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    if (status && (status[iColumn] & 3) == 1)
+      continue;
+    double value = 0.0;
+    for (CoinBigIndex j = columnStart[iColumn]; j < columnStart[iColumn + 1]; j++) {
+      double product = pi[row[j]] * element[j];
+      value += product;
+    }
+    if (columnScale)
+      value *= columnScale[iColumn];
+    if (fabs(value) > zeroTolerance) {
+      array[numberNonZero] = value;
+      index[numberNonZero++] = iColumn;
+    }
+  }
+  return numberNonZero;
+}
+#if CLP_SIMD_DISPATCH
+//-------------------------------------------------------------------
+// AVX2
+//-------------------------------------------------------------------
+/* Gathers start from zero rather than the undefined register the
+   plain intrinsics use, which gcc warns may be uninitialized */
+CLP_TARGET_AVX2 static inline __m256d
+clpGatherAvx2(const double *COIN_RESTRICT base, __m128i index)
+{
+  const __m256d zero = _mm256_setzero_pd();
+  return _mm256_mask_i32gather_pd(zero, base, index,
+    _mm256_cmp_pd(zero, zero, _CMP_EQ_OQ), 8);
+}
+CLP_TARGET_AVX2 static inline double
+clpColumnAvx2(const double *COIN_RESTRICT pi,
+  const int *COIN_RESTRICT row,
+  const double *COIN_RESTRICT element,
+  CoinBigIndex start, CoinBigIndex end, bool exact)
+{
+  CoinBigIndex j = start;
+  double value = 0.0;
+  if (exact) {
+    // gather and multiply four at a time but add in order
+    double products[4];
+    for (; j + 4 <= end; j += 4) {
+      __m128i rows = _mm_loadu_si128(reinterpret_cast< const __m128i * >(row + j));
+      __m256d product = _mm256_mul_pd(clpGatherAvx2(pi, rows),
+        _mm256_loadu_pd(element + j));
+      _mm256_storeu_pd(products, product);
+      value += products[0];
+      value += products[1];
+      value += products[2];
+      value += products[3];
+    }
+  } else if (j + 4 <= end) {
+    __m256d sum = _mm256_setzero_pd();
+    for (; j + 4 <= end; j += 4) {
+      __m128i rows = _mm_loadu_si128(reinterpret_cast< const __m128i * >(row + j));
+      sum = _mm256_add_pd(sum, _mm256_mul_pd(clpGatherAvx2(pi, rows),
+                                 _mm256_loadu_pd(element + j)));
+    }
+    __m128d half = _mm_add_pd(_mm256_castpd256_pd128(sum),
+      _mm256_extractf128_pd(sum, 1));
+    value = _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+  }
+  for (; j < end; j++) {
+    double product = pi[row[j]] * element[j];
+    value += product;
+  }
+  return value;
+}
+CLP_TARGET_AVX2 static int
+clpTransposeTimesAvx2(const double *COIN_RESTRICT pi,
+  const CoinBigIndex *COIN_RESTRICT columnStart,
+  const int *COIN_RESTRICT row,
+  const double *COIN_RESTRICT element,
+  const double *COIN_RESTRICT columnScale,
+  const unsigned char *COIN_RESTRICT status,
+  int numberColumns,
+  int *COIN_RESTRICT index,
+  double *COIN_RESTRICT array,
+  double zeroTolerance, bool exact)
+{
+  int numberNonZero = 0;
+  double values[4];
+  const __m256d tolerance = _mm256_set1_pd(zeroTolerance);
+  const __m256d signBit = _mm256_set1_pd(-0.0);
+  for (int iColumn = 0; iColumn < numberColumns; iColumn += 4) {
+    int number = CoinMin(4, numberColumns - iColumn);
+    for (int k = 0; k < 4; k++) {
+      int jColumn = iColumn + k;
+      double value = 0.0;
+      if (k < number && (!status || (status[jColumn] & 3) != 1)) {
+        value = clpColumnAvx2(pi, row, element, columnStart[jColumn],
+          columnStart[jColumn + 1], exact);
+        if (columnScale)
+          value *= columnScale[jColumn];
+      }
+      values[k] = value;
+    }
+    __m256d absolute = _mm256_andnot_pd(signBit, _mm256_loadu_pd(values));
+    int mask = _mm256_movemask_pd(_mm256_cmp_pd(absolute, tolerance, _CMP_GT_OQ));
+    while (mask) {
+      int k = __builtin_ctz(mask);
+      mask &= mask - 1;
+      array[numberNonZero] = values[k];
+      index[numberNonZero++] = iColumn + k;
+    }
+  }
+  return numberNonZero;
+}
+CLP_TARGET_AVX2 static int
+clpPackDownAvx2(double *COIN_RESTRICT output,
+  int *COIN_RESTRICT index,
+  int number,
+  double zeroTolerance)
+{
+  int numberNonZero = 0;
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d tolerance = _mm256_set1_pd(zeroTolerance);
+  const __m256d signBit = _mm256_set1_pd(-0.0);
+  double values[4];
+  int i = 0;
+  for (; i + 4 <= number; i += 4) {
+    __m256d value = _mm256_loadu_pd(output + i);
+    if (!_mm256_movemask_pd(_mm256_cmp_pd(value, zero, _CMP_NEQ_UQ)))
+      continue;
+    _mm256_storeu_pd(values, value);
+    // entries go at or before i so zero first
+    _mm256_storeu_pd(output + i, zero);
+    __m256d absolute = _mm256_andnot_pd(signBit, value);
+    int mask = _mm256_movemask_pd(_mm256_cmp_pd(absolute, tolerance, _CMP_GT_OQ));
+    while (mask) {
+      int k = __builtin_ctz(mask);
+      mask &= mask - 1;
+      output[numberNonZero] = values[k];
+      index[numberNonZero++] = i + k;
+    }
+  }
+  for (; i < number; i++) {
+    double value = output[i];
+    if (value) {
+      output[i] = 0.0;
+      if (fabs(value) > zeroTolerance) {
+        output[numberNonZero] = value;
+        index[numberNonZero++] = i;
+      }
+    }
+  }
+  return numberNonZero;
+}
+//-------------------------------------------------------------------
+// AVX-512
+//-------------------------------------------------------------------
+CLP_TARGET_AVX512 static inline __m512d
+clpGatherAvx512(const double *COIN_RESTRICT base, __m256i index)
+{
+  return _mm512_mask_i32gather_pd(_mm512_setzero_pd(), 0xff, index, base, 8);
+}
+CLP_TARGET_AVX512 static inline double
+clpColumnAvx512(const double *COIN_RESTRICT pi,
+  const int *COIN_RESTRICT row,
+  const double *COIN_RESTRICT element,
+  CoinBigIndex start, CoinBigIndex end, bool exact)
+{
+  CoinBigIndex j = start;
+  double value = 0.0;
+  if (exact) {
+    double products[8];
+    for (; j + 8 <= end; j += 8) {
+      __m256i rows = _mm256_loadu_si256(reinterpret_cast< const __m256i * >(row + j));
+      __m512d product = _mm512_mul_pd(clpGatherAvx512(pi, rows),
+        _mm512_loadu_pd(element + j));
+      _mm512_storeu_pd(products, product);
+      for (int k = 0; k < 8; k++)
+        value += products[k];
+    }
+  } else if (j + 8 <= end) {
+    __m512d sum = _mm512_setzero_pd();
+    for (; j + 8 <= end; j += 8) {
+      __m256i rows = _mm256_loadu_si256(reinterpret_cast< const __m256i * >(row + j));
+      sum = _mm512_add_pd(sum, _mm512_mul_pd(clpGatherAvx512(pi, rows),
+                                 _mm512_loadu_pd(element + j)));
+    }
+    double sums[8];
+    _mm512_storeu_pd(sums, sum);
+    value = ((sums[0] + sums[4]) + (sums[2] + sums[6]))
+      + ((sums[1] + sums[5]) + (sums[3] + sums[7]));
+  }
+  for (; j < end; j++) {
+    double product = pi[row[j]] * element[j];
+    value += product;
+  }
+  return value;
+}
+CLP_TARGET_AVX512 static int
+clpTransposeTimesAvx512(const double *COIN_RESTRICT pi,
+  const CoinBigIndex *COIN_RESTRICT columnStart,
+  const int *COIN_RESTRICT row,
+  const double *COIN_RESTRICT element,
+  const double *COIN_RESTRICT columnScale,
+  const unsigned char *COIN_RESTRICT status,
+  int numberColumns,
+  int *COIN_RESTRICT index,
+  double *COIN_RESTRICT array,
+  double zeroTolerance, bool exact)
+{
+  int numberNonZero = 0;
+  double values[8];
+  const __m512d tolerance = _mm512_set1_pd(zeroTolerance);
+  const __m512i offset = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,
+    0, 0, 0, 0, 0, 0, 0, 0);
+  for (int iColumn = 0; iColumn < numberColumns; iColumn += 8) {
+    int number = CoinMin(8, numberColumns - iColumn);
+    for (int k = 0; k < 8; k++) {
+      int jColumn = iColumn + k;
+      double value = 0.0;
+      if (k < number && (!status || (status[jColumn] & 3) != 1)) {
+        value = clpColumnAvx512(pi, row, element, columnStart[jColumn],
+          columnStart[jColumn + 1], exact);
+        if (columnScale)
+          value *= columnScale[jColumn];
+      }
+      values[k] = value;
+    }
+    __m512d value = _mm512_loadu_pd(values);
+    __mmask8 mask = _mm512_cmp_pd_mask(_mm512_abs_pd(value), tolerance, _CMP_GT_OQ);
+    if (mask) {
+      _mm512_mask_compressstoreu_pd(array + numberNonZero, mask, value);
+      __m512i columns = _mm512_add_epi32(_mm512_set1_epi32(iColumn), offset);
+      _mm512_mask_compressstoreu_epi32(index + numberNonZero, mask, columns);
+      numberNonZero += __builtin_popcount(mask);
+    }
+  }
+  return numberNonZero;
+}
+CLP_TARGET_AVX512 static void
+clpScatterRowAvx512(double value,
+  const int *COIN_RESTRICT column,
+  const double *COIN_RESTRICT element,
+  int number,
+  double *COIN_RESTRICT output)
+{
+  const __m512d multiplier = _mm512_set1_pd(value);
+  int j = 0;
+  // columns in a row are distinct so scatter has no conflicts
+  for (; j + 8 <= number; j += 8) {
+    __m256i columns = _mm256_loadu_si256(reinterpret_cast< const __m256i * >(column + j));
+    __m512d product = _mm512_mul_pd(_mm512_loadu_pd(element + j), multiplier);
+    __m512d old = clpGatherAvx512(output, columns);
+    _mm512_i32scatter_pd(output, columns, _mm512_add_pd(old, product), 8);
+  }
+  for (; j < number; j++) {
+    double product = element[j] * value;
+    output[column[j]] += product;
+  }
+}
+CLP_TARGET_AVX512 static int
+clpPackDownAvx512(double *COIN_RESTRICT output,
+  int *COIN_RESTRICT index,
+  int number,
+  double zeroTolerance)
+{
+  int numberNonZero = 0;
+  const __m512d zero = _mm512_setzero_pd();
+  const __m512d tolerance = _mm512_set1_pd(zeroTolerance);
+  const __m512i offset = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,
+    0, 0, 0, 0, 0, 0, 0, 0);
+  int i = 0;
+  for (; i + 8 <= number; i += 8) {
+    __m512d value = _mm512_loadu_pd(output + i);
+    if (!_mm512_cmp_pd_mask(value, zero, _CMP_NEQ_UQ))
+      continue;
+    // entries go at or before i so zero first
+    _mm512_storeu_pd(output + i, zero);
+    __mmask8 mask = _mm512_cmp_pd_mask(_mm512_abs_pd(value), tolerance, _CMP_GT_OQ);
+    if (mask) {
+      _mm512_mask_compressstoreu_pd(output + numberNonZero, mask, value);
+      __m512i columns = _mm512_add_epi32(_mm512_set1_epi32(i), offset);
+      _mm512_mask_compressstoreu_epi32(index + numberNonZero, mask, columns);
+      numberNonZero += __builtin_popcount(mask);
+    }
+  }
+  for (; i < number; i++) {
+    double value = output[i];
+    if (value) {
+      output[i] = 0.0;
+      if (fabs(value) > zeroTolerance) {
+        output[numberNonZero] = value;
+        index[numberNonZero++] = i;
+      }
+    }
+  }
+  return numberNonZero;
+}
+#endif
+//-------------------------------------------------------------------
+// Dispatch
+//-------------------------------------------------------------------
+int clpSimdTransposeTimes(const double *COIN_RESTRICT pi,
+  const CoinBigIndex *COIN_RESTRICT columnStart,
+  const int *COIN_RESTRICT row,
+  const double *COIN_RESTRICT element,
+  const double *COIN_RESTRICT columnScale,
+  const unsigned char *COIN_RESTRICT status,
+  int numberColumns,
+  int *COIN_RESTRICT index,
+  double *COIN_RESTRICT array,
+  double zeroTolerance)
+{
+#if CLP_SIMD_DISPATCH
+  int level = clpSimdLevel();
+  if (level == CLP_SIMD_AVX512)
+    return clpTransposeTimesAvx512(pi, columnStart, row, element, columnScale,
+      status, numberColumns, index, array, zeroTolerance, clpSimdExact());
+  else if (level == CLP_SIMD_AVX2)
+    return clpTransposeTimesAvx2(pi, columnStart, row, element, columnScale,
+      status, numberColumns, index, array, zeroTolerance, clpSimdExact());
+#endif
+  return clpTransposeTimesScalar(pi, columnStart, row, element, columnScale,
+    status, numberColumns, index, array, zeroTolerance);
+}
+void clpSimdScatterRow(double value,
+  const int *COIN_RESTRICT column,
+  const double *COIN_RESTRICT element,
+  int number,
+  double *COIN_RESTRICT output)
+{
+#if CLP_SIMD_DISPATCH
+  // AVX2 has gather but no scatter so is no help here
+  if (clpSimdLevel() == CLP_SIMD_AVX512) {
+    clpScatterRowAvx512(value, column, element, number, output);
+    return;
+  }
+#endif
+  for (int j = 0; j < number; j++) {
+    double product = element[j] * value;
+    output[column[j]] += product;
+  }
+}
+int clpSimdPackDown(double *COIN_RESTRICT output,
+  int *COIN_RESTRICT index,
+  int number,
+  double tolerance)
+{
+#if CLP_SIMD_DISPATCH
+  int level = clpSimdLevel();
+  if (level == CLP_SIMD_AVX512)
+    return clpPackDownAvx512(output, index, number, tolerance);
+  else if (level == CLP_SIMD_AVX2)
+    return clpPackDownAvx2(output, index, number, tolerance);
+#endif
+  int numberNonZero = 0;
+  for (int i = 0; i < number; i++) {
+    double value = output[i];
+    if (value) {
+      output[i] = 0.0;
+      if (fabs(value) > tolerance) {
+        output[numberNonZero] = value;
+        index[numberNonZero++] = i;
+      }
+    }
+  }
+  return numberNonZero;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
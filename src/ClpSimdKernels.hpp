@@ -0,0 +1,89 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef ClpSimdKernels_H
+#define ClpSimdKernels_H
+
+#include "ClpConfig.h"
+#include "CoinTypes.h"
+
+/** Vector versions of the ClpPackedMatrix pricing loops
+
+The loops which form the pivot row (pi times matrix by column, and the
+scatter and pack down used by row) have AVX2 and AVX-512 versions.
+Which is used is decided the first time by asking the processor, so
+one binary runs everywhere.  Only GCC and clang on x86 build the vector
+versions (define CLP_NO_SIMD to stop them) - otherwise
+clpSimdAvailable() is always CLP_SIMD_NONE.
+
+By default a column is summed in vector lanes which changes rounding.
+clpSetSimdExact(true) makes the vector versions add in exactly the
+same order as the scalar code so results are identical bit for bit.
+*/
+
+#if !defined(CLP_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) \
+  && (defined(__x86_64__) || defined(__i386__))
+#define CLP_SIMD_DISPATCH 1
+#else
+#define CLP_SIMD_DISPATCH 0
+#endif
+
+/// Instruction sets
+enum ClpSimdLevel {
+  CLP_SIMD_NONE = 0,
+  CLP_SIMD_AVX2,
+  CLP_SIMD_AVX512
+};
+
+/**@name Selection */
+//@{
+/// Best instruction set processor and build support
+CLPLIB_EXPORT int clpSimdAvailable();
+/// Instruction set kernels use (default best available)
+CLPLIB_EXPORT int clpSimdLevel();
+/// Set instruction set (reduced to what is available)
+CLPLIB_EXPORT void clpSetSimdLevel(int level);
+/// True if vector kernels add in same order as scalar code
+CLPLIB_EXPORT bool clpSimdExact();
+CLPLIB_EXPORT void clpSetSimdExact(bool exact);
+//@}
+
+/**@name Kernels (plain loops if clpSimdLevel() is CLP_SIMD_NONE) */
+//@{
+/** pi times columns 0 to numberColumns-1 - entries with absolute value
+    above zeroTolerance go to array/index (packed).  columnScale may be
+    NULL.  If status is not NULL columns with (status&3)==1 (basic) are
+    skipped.  Returns number of entries.
+*/
+int clpSimdTransposeTimes(const double *pi,
+  const CoinBigIndex *columnStart,
+  const int *row,
+  const double *element,
+  const double *columnScale,
+  const unsigned char *status,
+  int numberColumns,
+  int *index,
+  double *array,
+  double zeroTolerance);
+/** Adds value times row to dense output.  Columns in a row must be
+    distinct (as they are in a packed matrix).
+*/
+void clpSimdScatterRow(double value,
+  const int *column,
+  const double *element,
+  int number,
+  double *output);
+/** Packs dense output of length number - zeroes output and puts entries
+    with absolute value above tolerance at start of output/index.
+    Returns number of entries.
+*/
+int clpSimdPackDown(double *output,
+  int *index,
+  int number,
+  double tolerance);
+//@}
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -32,6 +32,7 @@
 #include "CoinMpsIO.hpp"
 #include "CoinModel.hpp"
 #include "CoinLpIO.hpp"
+#include "ClpThreadPool.hpp"
 #include <cfloat>
 #if CLP_HAS_ABC
 #include "CoinAbcCommon.hpp"
@@ -108,6 +109,7 @@ ClpSimplex::ClpSimplex(bool emptyMessages)
   , savedSolution_(NULL)
   , numberTimesOptimal_(0)
   , disasterArea_(NULL)
+  , choleskySymbolic_(NULL)
   , changeMade_(1)
   , algorithm_(0)
   , forceFactorization_(-1)
@@ -231,6 +233,7 @@ ClpSimplex::ClpSimplex(const ClpModel *rhs,
   , savedSolution_(NULL)
   , numberTimesOptimal_(0)
   , disasterArea_(NULL)
+  , choleskySymbolic_(NULL)
   , changeMade_(1)
   , algorithm_(0)
   , forceFactorization_(-1)
@@ -391,6 +394,7 @@ ClpSimplex::ClpSimplex(const ClpSimplex *rhs,
   , savedSolution_(NULL)
   , numberTimesOptimal_(0)
   , disasterArea_(NULL)
+  , choleskySymbolic_(NULL)
   , changeMade_(1)
   , algorithm_(0)
   , forceFactorization_(-1)
@@ -2453,6 +2457,7 @@ ClpSimplex::ClpSimplex(const ClpSimplex &rhs, int scalingMode)
   , savedSolution_(NULL)
   , numberTimesOptimal_(0)
   , disasterArea_(NULL)
+  , choleskySymbolic_(NULL)
   , changeMade_(1)
   , algorithm_(0)
   , forceFactorization_(-1)
@@ -2562,6 +2567,7 @@ ClpSimplex::ClpSimplex(const ClpModel &rhs, int scalingMode)
   , savedSolution_(NULL)
   , numberTimesOptimal_(0)
   , disasterArea_(NULL)
+  , choleskySymbolic_(NULL)
   , changeMade_(1)
   , algorithm_(0)
   , forceFactorization_(-1)
@@ -2752,6 +2758,7 @@ void ClpSimplex::gutsOfCopy(const ClpSimplex &rhs)
   primalColumnPivot_->setModel(this);
   numberTimesOptimal_ = rhs.numberTimesOptimal_;
   disasterArea_ = NULL;
+  choleskySymbolic_ = NULL;
   changeMade_ = rhs.changeMade_;
   algorithm_ = rhs.algorithm_;
   forceFactorization_ = rhs.forceFactorization_;
@@ -6500,10 +6507,12 @@ int ClpSimplex::barrier(bool crossover, int startFinishOptions)
 #else
   if (!doKKT) {
     ClpCholeskyBase *cholesky = new ClpCholeskyBase();
+    cholesky->setSymbolicCache(choleskySymbolic_);
     barrier.setCholesky(cholesky);
   } else {
     ClpCholeskyBase *cholesky = new ClpCholeskyBase();
     cholesky->setKKT(true);
+    cholesky->setSymbolicCache(choleskySymbolic_);
     barrier.setCholesky(cholesky);
   }
 #endif
@@ -6710,13 +6719,42 @@ int ClpSimplex::barrier(bool crossover, int startFinishOptions)
   model2->setPerturbation(savePerturbation);
   return model2->status();
 }
-typedef struct {
+typedef struct ClpHotSaveData {
   char *spareArrays_;
   ClpFactorization *factorization_;
   int logLevel_;
+  /// Size of arrays in bytes (multiple of 8)
+  int size_;
+  /// Full snapshot this is a delta from (or NULL if full)
+  const struct ClpHotSaveData *base_;
+  /// Number of 8 byte words of arrays which differ from base
+  int numberChanged_;
+  /// Which words differ
+  int *whichChanged_;
+  /// New values of those words
+  CoinInt64 *changed_;
+  /// True if factorization_ belongs to this snapshot
+  bool ownFactorization_;
 } ClpHotSaveData;
+// Size of arrays for hot start (rounded up to whole 8 byte words)
+static int hotStartArraySize(int numberRows, int numberColumns)
+{
+  // Get space for strong branching
+  int size = static_cast< int >((1 + 4 * (numberRows + numberColumns)) * sizeof(double));
+  // and for save of original column bounds
+  size += static_cast< int >(2 * numberColumns * sizeof(double));
+  size += static_cast< int >((1 + 4 * numberRows + 2 * numberColumns) * sizeof(int));
+  size += numberRows + numberColumns;
+  return ((size + 7) / 8) * 8;
+}
 // Create a hotstart point of the optimization process
 void ClpSimplex::markHotStart(void *&saveStuff)
+{
+  markHotStart(saveStuff, NULL);
+}
+/* Create a hotstart point of the optimization process recording only
+   what differs from baseStuff */
+void ClpSimplex::markHotStart(void *&saveStuff, const void *baseStuff)
 {
   ClpHotSaveData *saveData = new ClpHotSaveData;
   saveStuff = saveData;
@@ -6724,16 +6762,23 @@ void ClpSimplex::markHotStart(void *&saveStuff)
   saveData->logLevel_ = logLevel();
   if (logLevel() < 2)
     setLogLevel(0);
-  // Get space for strong branching
-  int size = static_cast< int >((1 + 4 * (numberRows_ + numberColumns_)) * sizeof(double));
-  // and for save of original column bounds
-  size += static_cast< int >(2 * numberColumns_ * sizeof(double));
-  size += static_cast< int >((1 + 4 * numberRows_ + 2 * numberColumns_) * sizeof(int));
-  size += numberRows_ + numberColumns_;
-  saveData->spareArrays_ = new char[size];
+  int size = hotStartArraySize(numberRows_, numberColumns_);
+  saveData->size_ = size;
+  saveData->base_ = NULL;
+  saveData->numberChanged_ = 0;
+  saveData->whichChanged_ = NULL;
+  saveData->changed_ = NULL;
+  saveData->ownFactorization_ = true;
+  const ClpHotSaveData *base = reinterpret_cast< const ClpHotSaveData * >(baseStuff);
+  // base must be full snapshot of same sized model
+  if (base && (base->base_ || base->size_ != size))
+    base = NULL;
+  // zeroed so unused parts never show as changes
+  char *arrays = new char[size];
+  memset(arrays, 0, size);
   // Setup for strong branching
-  saveData->factorization_ = static_cast< ClpSimplexDual * >(this)->setupForStrongBranching(saveData->spareArrays_, numberRows_, numberColumns_, true);
-  double *arrayD = reinterpret_cast< double * >(saveData->spareArrays_);
+  saveData->factorization_ = static_cast< ClpSimplexDual * >(this)->setupForStrongBranching(arrays, numberRows_, numberColumns_, true);
+  double *arrayD = reinterpret_cast< double * >(arrays);
   arrayD[0] = objectiveValue() * optimizationDirection();
   double *saveSolution = arrayD + 1;
   double *saveLower = saveSolution + (numberRows_ + numberColumns_);
@@ -6743,6 +6788,59 @@ void ClpSimplex::markHotStart(void *&saveStuff)
   double *saveUpperOriginal = saveLowerOriginal + numberColumns_;
   CoinMemcpyN(columnLower(), numberColumns_, saveLowerOriginal);
   CoinMemcpyN(columnUpper(), numberColumns_, saveUpperOriginal);
+  if (!base) {
+    saveData->spareArrays_ = arrays;
+    return;
+  }
+  // delta - keep words which differ from base
+  saveData->spareArrays_ = NULL;
+  saveData->base_ = base;
+  const char *baseArrays = base->spareArrays_;
+  int numberWords = size / 8;
+  int numberChanged = 0;
+  for (int i = 0; i < numberWords; i++) {
+    if (memcmp(arrays + 8 * i, baseArrays + 8 * i, 8))
+      numberChanged++;
+  }
+  saveData->numberChanged_ = numberChanged;
+  if (numberChanged) {
+    saveData->whichChanged_ = new int[numberChanged];
+    saveData->changed_ = new CoinInt64[numberChanged];
+    numberChanged = 0;
+    for (int i = 0; i < numberWords; i++) {
+      if (memcmp(arrays + 8 * i, baseArrays + 8 * i, 8)) {
+        saveData->whichChanged_[numberChanged] = i;
+        memcpy(saveData->changed_ + numberChanged, arrays + 8 * i, 8);
+        numberChanged++;
+      }
+    }
+  }
+  // same basis (pivots and status) means base factorization will do
+  const char *basis = reinterpret_cast< const char * >(saveUpperOriginal + numberColumns_);
+  int offset = static_cast< int >(basis - arrays);
+  int pivotSize = static_cast< int >(numberRows_ * sizeof(int));
+  int statusOffset = offset + static_cast< int >((4 * numberRows_ + 2 * numberColumns_ + 1) * sizeof(int));
+  if (saveData->factorization_ && base->factorization_
+    && !memcmp(arrays + offset, baseArrays + offset, pivotSize)
+    && !memcmp(arrays + statusOffset, baseArrays + statusOffset,
+         numberRows_ + numberColumns_)) {
+    delete saveData->factorization_;
+    saveData->factorization_ = base->factorization_;
+    saveData->ownFactorization_ = false;
+  }
+  delete[] arrays;
+}
+// Bytes held by a hot start snapshot (factorization estimated)
+int ClpSimplex::hotStartSize(const void *saveStuff) const
+{
+  const ClpHotSaveData *saveData = reinterpret_cast< const ClpHotSaveData * >(saveStuff);
+  int size = static_cast< int >(sizeof(ClpHotSaveData));
+  if (saveData->spareArrays_)
+    size += saveData->size_;
+  size += static_cast< int >(saveData->numberChanged_ * (sizeof(int) + sizeof(CoinInt64)));
+  if (saveData->ownFactorization_ && saveData->factorization_)
+    size += static_cast< int >(saveData->factorization_->numberElements() * (sizeof(double) + sizeof(int)));
+  return size;
 }
 // Optimize starting from the hotstart
 void ClpSimplex::solveFromHotStart(void *saveStuff)
@@ -6750,7 +6848,15 @@ void ClpSimplex::solveFromHotStart(void *saveStuff)
   ClpHotSaveData *saveData = reinterpret_cast< ClpHotSaveData * >(saveStuff);
   int iterationLimit = intParam_[ClpMaxNumIteration];
   intParam_[ClpMaxNumIteration] = intParam_[ClpMaxNumIterationHotStart];
-  double *arrayD = reinterpret_cast< double * >(saveData->spareArrays_);
+  char *arrays = saveData->spareArrays_;
+  if (!arrays) {
+    // delta - base arrays plus changes
+    arrays = new char[saveData->size_];
+    memcpy(arrays, saveData->base_->spareArrays_, saveData->size_);
+    for (int i = 0; i < saveData->numberChanged_; i++)
+      memcpy(arrays + 8 * saveData->whichChanged_[i], saveData->changed_ + i, 8);
+  }
+  double *arrayD = reinterpret_cast< double * >(arrays);
   double saveObjectiveValue = arrayD[0];
   double *saveSolution = arrayD + 1;
   int number = numberRows_ + numberColumns_;
@@ -6872,6 +6978,8 @@ void ClpSimplex::solveFromHotStart(void *saveStuff)
   CoinMemcpyN(saveLower, number, lowerRegion());
   CoinMemcpyN(saveUpper, number, upperRegion());
   intParam_[ClpMaxNumIteration] = iterationLimit;
+  if (arrays != saveData->spareArrays_)
+    delete[] arrays;
 }
 // Delete the snapshot
 void ClpSimplex::unmarkHotStart(void *saveStuff)
@@ -6879,8 +6987,11 @@ void ClpSimplex::unmarkHotStart(void *saveStuff)
   ClpHotSaveData *saveData = reinterpret_cast< ClpHotSaveData * >(saveStuff);
   setLogLevel(saveData->logLevel_);
   deleteRim(0);
-  delete saveData->factorization_;
+  if (saveData->ownFactorization_)
+    delete saveData->factorization_;
   delete[] saveData->spareArrays_;
+  delete[] saveData->whichChanged_;
+  delete[] saveData->changed_;
   delete saveData;
 }
 /* For strong branching.  On input lower and upper are new bounds
@@ -6894,13 +7005,112 @@ int ClpSimplex::strongBranching(int numberVariables, const int *variables,
   int *outputStatus, int *outputIterations,
   bool stopOnFirstInfeasible,
   bool alwaysFinish,
-  int startFinishOptions)
+  int startFinishOptions,
+  int numberThreads)
 {
   return static_cast< ClpSimplexDual * >(this)->strongBranching(numberVariables, variables,
     newLower, newUpper, outputSolution,
     outputStatus, outputIterations,
     stopOnFirstInfeasible,
-    alwaysFinish, startFinishOptions);
+    alwaysFinish, startFinishOptions, numberThreads);
+}
+// Solves scenarios first to last-1 on model - see solveScenarios
+static int solveScenarioChunk(ClpSimplex *model, int first, int last,
+  const double *const *rowLowers, const double *const *rowUppers,
+  const double *const *objectives,
+  double *objectiveValues, int *statuses,
+  double **columnSolutions, double **rowDuals, int *iterations)
+{
+  int numberRows = model->numberRows();
+  int numberColumns = model->numberColumns();
+  // a scenario only changes what it gives
+  double *saveLower = CoinCopyOfArray(model->rowLower(), numberRows);
+  double *saveUpper = CoinCopyOfArray(model->rowUpper(), numberRows);
+  double *saveObjective = CoinCopyOfArray(model->objective(), numberColumns);
+  int numberBad = 0;
+  for (int iScenario = first; iScenario < last; iScenario++) {
+    const double *lower = (rowLowers && rowLowers[iScenario]) ? rowLowers[iScenario] : saveLower;
+    const double *upper = (rowUppers && rowUppers[iScenario]) ? rowUppers[iScenario] : saveUpper;
+    const double *cost = (objectives && objectives[iScenario]) ? objectives[iScenario] : saveObjective;
+    // These keep work arrays up to date and only flag what changed
+    for (int iRow = 0; iRow < numberRows; iRow++)
+      model->setRowBounds(iRow, lower[iRow], upper[iRow]);
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+      model->setObjectiveCoefficient(iColumn, cost[iColumn]);
+    // re-use factorization and keep work arrays until last one
+    int startFinishOptions = 2 + 4;
+    if (iScenario < last - 1)
+      startFinishOptions |= 1;
+    model->dual(0, startFinishOptions);
+    objectiveValues[iScenario] = model->objectiveValue();
+    statuses[iScenario] = model->problemStatus();
+    if (!model->isProvenOptimal())
+      numberBad++;
+    if (columnSolutions && columnSolutions[iScenario])
+      CoinMemcpyN(model->primalColumnSolution(), numberColumns, columnSolutions[iScenario]);
+    if (rowDuals && rowDuals[iScenario])
+      CoinMemcpyN(model->dualRowSolution(), numberRows, rowDuals[iScenario]);
+    if (iterations)
+      iterations[iScenario] = model->numberIterations();
+  }
+  // put back data
+  for (int iRow = 0; iRow < numberRows; iRow++)
+    model->setRowBounds(iRow, saveLower[iRow], saveUpper[iRow]);
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+    model->setObjectiveCoefficient(iColumn, saveObjective[iColumn]);
+  delete[] saveLower;
+  delete[] saveUpper;
+  delete[] saveObjective;
+  return numberBad;
+}
+// Solves many variants of model - see header
+int ClpSimplex::solveScenarios(int numberScenarios,
+  const double *const *rowLowers, const double *const *rowUppers,
+  const double *const *objectives,
+  double *objectiveValues, int *statuses,
+  double **columnSolutions, double **rowDuals,
+  int *iterations, int numberThreads)
+{
+  if (numberScenarios <= 0)
+    return 0;
+  int numberChunks = CoinMax(1, CoinMin(numberThreads, numberScenarios));
+  if (numberChunks == 1)
+    return solveScenarioChunk(this, 0, numberScenarios, rowLowers, rowUppers,
+      objectives, objectiveValues, statuses, columnSolutions, rowDuals,
+      iterations);
+  // Clones must be made before this model starts changing
+  ClpSimplex **models = new ClpSimplex *[numberChunks];
+  CoinMessageHandler **handlers = new CoinMessageHandler *[numberChunks];
+  int *numberBad = new int[numberChunks];
+  models[0] = this;
+  handlers[0] = NULL;
+  for (int i = 1; i < numberChunks; i++) {
+    models[i] = new ClpSimplex(*this);
+    // own handler as not threadsafe
+    handlers[i] = new CoinMessageHandler(*handler_);
+    models[i]->passInMessageHandler(handlers[i]);
+  }
+  int chunk = numberScenarios / numberChunks;
+  int extra = numberScenarios - chunk * numberChunks;
+  clpParallelTasks(numberChunks, numberChunks, [&](int i) {
+    int first = i * chunk + CoinMin(i, extra);
+    int last = first + chunk + (i < extra ? 1 : 0);
+    numberBad[i] = solveScenarioChunk(models[i], first, last,
+      rowLowers, rowUppers, objectives, objectiveValues, statuses,
+      columnSolutions, rowDuals, iterations);
+  });
+  int returnCode = 0;
+  for (int i = 0; i < numberChunks; i++) {
+    returnCode += numberBad[i];
+    if (i) {
+      delete models[i];
+      delete handlers[i];
+    }
+  }
+  delete[] models;
+  delete[] handlers;
+  delete[] numberBad;
+  return returnCode;
 }
 #endif
 /* Borrow model.  This is so we dont have to copy large amounts
@@ -11608,7 +11818,7 @@ int ClpSimplex::fathom(void *stuff)
     setDblParam(ClpDualObjectiveLimit, saveObjLimit);
     return returnCode;
   }
-  if ((moreSpecialOptions_ & 2048) != 0) {
+  if ((moreSpecialOptions_ & 2048) != 0 && !info->shared_) {
     // perturb true objective
     int saveFlag = scalingFlag_;
     int savePerturbation = perturbation_;
@@ -11621,6 +11831,12 @@ int ClpSimplex::fathom(void *stuff)
     scalingFlag_ = saveFlag;
     perturbation_ = savePerturbation;
   }
+  if (info->numberThreads_ > 1 && !info->shared_) {
+    // clones should start from untouched limits
+    setMaximumIterations(saveMaxIterations);
+    setDblParam(ClpDualObjectiveLimit, saveObjLimit);
+    return parallelFathom(info);
+  }
   int returnCode = startFastDual2(info);
   if (returnCode) {
     stopFastDual2(info);
@@ -11742,6 +11958,18 @@ int ClpSimplex::fathom(void *stuff)
   // Say can stop without cleaning up in primal
   moreSpecialOptions_ |= 2097152;
   while (depth >= 0) {
+    if (info->shared_) {
+      // other threads may have given up or found better solutions
+      if (info->shared_->stopped()) {
+        info->nNodes_ = -1;
+        break;
+      }
+      double cutoff = info->shared_->cutoff();
+      if (cutoff < bestObjective) {
+        bestObjective = cutoff;
+        setDblParam(ClpDualObjectiveLimit, bestObjective * optimizationDirection_);
+      }
+    }
     // If backtrack get to correct depth
     if (backtrack) {
       depth--;
@@ -12017,6 +12245,8 @@ int ClpSimplex::fathom(void *stuff)
               objectiveValue - 1.0e-5);
           }
           setDblParam(ClpDualObjectiveLimit, bestObjective * optimizationDirection_);
+          if (info->shared_)
+            info->shared_->improveCutoff(bestObjective);
         } else {
           //#define CLP_INVESTIGATE
 #ifdef COIN_DEVELOP
@@ -12090,6 +12320,251 @@ int ClpSimplex::fathom(void *stuff)
   setDblParam(ClpDualObjectiveLimit, saveObjLimit);
   return returnCode;
 }
+// Chooses integer to split on in parallelFathom (-1 if none fractional)
+static int fathomSplitVariable(const ClpSimplex *model, ClpNodeStuff *info,
+  const int *back)
+{
+  const double *solution = model->primalColumnSolution();
+  const char *integerType = model->integerInformation();
+  int numberColumns = model->numberColumns();
+  double integerTolerance = info->integerTolerance_;
+  double smallChange = info->smallChange_;
+  int bestColumn = -1;
+  double bestScore = -1.0;
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    if (!integerType[iColumn])
+      continue;
+    double value = solution[iColumn];
+    double fraction = value - floor(value);
+    if (fraction < integerTolerance || fraction > 1.0 - integerTolerance)
+      continue;
+    double score;
+    if (info->upPseudo_) {
+      // product of estimates as in ClpNode
+      int iInteger = back[iColumn];
+      double downValue;
+      double upValue;
+      {
+        std::lock_guard< std::mutex > lock(info->shared_->lock(iInteger));
+        downValue = info->downPseudo_[iInteger] / (1.0 + info->numberDown_[iInteger]);
+        upValue = info->upPseudo_[iInteger] / (1.0 + info->numberUp_[iInteger]);
+      }
+      downValue *= fraction;
+      upValue *= 1.0 - fraction;
+      score = CoinMax(downValue, smallChange) * CoinMax(upValue, smallChange);
+    } else {
+      score = CoinMin(fraction, 1.0 - fraction);
+    }
+    if (score > bestScore) {
+      bestScore = score;
+      bestColumn = iColumn;
+    }
+  }
+  return bestColumn;
+}
+/* Fathom with subtrees explored in parallel.
+   The tree is split a few levels below the root (plain dual at each
+   split node) into enough subtrees that idle threads can steal them
+   from ClpThreadPool deques.  Each subtree is done by serial fathom on
+   a clone of this model checked out of a free list for the length of
+   the task - a thread waiting inside dual may run another subtree so
+   clones can not be tied to threads.  Pseudo costs and cutoff are
+   shared through ClpFathomShared.  At end the best solution is put
+   into this model as serial fathom does.
+*/
+int ClpSimplex::parallelFathom(ClpNodeStuff *info)
+{
+  // shared pool if big enough - otherwise a private one for this call
+  ClpThreadPool *pool = ClpThreadPool::pool();
+  ClpThreadPool *privatePool = NULL;
+  if (pool->numberThreads() < info->numberThreads_) {
+    privatePool = new ClpThreadPool(info->numberThreads_);
+    pool = privatePool;
+  }
+  int numberThreads = pool->numberThreads();
+  int numberTotal = numberRows_ + numberColumns_;
+  ClpFathomShared shared;
+  // clones - made when free list is empty
+  std::vector< ClpSimplex * > models;
+  std::vector< ClpNodeStuff * > infos;
+  std::vector< CoinMessageHandler * > handlers;
+  std::vector< int > freeClones;
+  std::mutex cloneMutex;
+  int *back = new int[numberColumns_];
+  int numberIntegers = 0;
+  for (int i = 0; i < numberColumns_; i++) {
+    if (integerType_[i])
+      back[i] = numberIntegers++;
+    else
+      back[i] = -1;
+  }
+  double *saveLower = CoinCopyOfArray(columnLower_, numberColumns_);
+  double *saveUpper = CoinCopyOfArray(columnUpper_, numberColumns_);
+  unsigned char *saveStatus = CoinCopyOfArray(status_, numberTotal);
+  double saveObjLimit;
+  getDblParam(ClpDualObjectiveLimit, saveObjLimit);
+  // enough subtrees for stealing to even out work
+  int splitDepth = 0;
+  while ((1 << splitDepth) < 4 * numberThreads)
+    splitDepth++;
+  ClpTaskGroup group(pool);
+  // a subtree is given by bounds changed from root (column, lower, upper)
+  std::function< void(const std::vector< int > &, const std::vector< double > &, int) > doSubtree;
+  doSubtree = [&](const std::vector< int > &which, const std::vector< double > &bounds,
+                int depth) {
+    if (shared.stopped())
+      return;
+    int iClone = -1;
+    ClpSimplex *model = NULL;
+    ClpNodeStuff *threadInfo = NULL;
+    {
+      std::lock_guard< std::mutex > lock(cloneMutex);
+      if (!freeClones.empty()) {
+        iClone = freeClones.back();
+        freeClones.pop_back();
+        model = models[iClone];
+        threadInfo = infos[iClone];
+      } else {
+        iClone = static_cast< int >(models.size());
+        models.push_back(NULL);
+        infos.push_back(NULL);
+        handlers.push_back(NULL);
+      }
+    }
+    if (!model) {
+      // this model is not changed while tasks run so can be copied here
+      model = new ClpSimplex(*this);
+      // own handler as not threadsafe
+      CoinMessageHandler *handler = new CoinMessageHandler(*handler_);
+      model->passInMessageHandler(handler);
+      threadInfo = new ClpNodeStuff(*info);
+      threadInfo->downPseudo_ = info->downPseudo_;
+      threadInfo->upPseudo_ = info->upPseudo_;
+      threadInfo->priority_ = info->priority_;
+      threadInfo->numberDown_ = info->numberDown_;
+      threadInfo->numberUp_ = info->numberUp_;
+      threadInfo->numberDownInfeasible_ = info->numberDownInfeasible_;
+      threadInfo->numberUpInfeasible_ = info->numberUpInfeasible_;
+      threadInfo->shared_ = &shared;
+      threadInfo->numberThreads_ = 1;
+      // crunching would pack down the shared pseudo costs
+      threadInfo->presolveType_ = 0;
+#ifndef NO_FATHOM_PRINT
+      if (info->handler_)
+        threadInfo->handler_ = info->handler_->clone();
+#endif
+      std::lock_guard< std::mutex > lock(cloneMutex);
+      models[iClone] = model;
+      infos[iClone] = threadInfo;
+      handlers[iClone] = handler;
+    }
+    // back to root and apply branches
+    CoinMemcpyN(saveLower, numberColumns_, model->columnLower_);
+    CoinMemcpyN(saveUpper, numberColumns_, model->columnUpper_);
+    if (saveStatus)
+      CoinMemcpyN(saveStatus, numberTotal, model->status_);
+    int numberChanged = static_cast< int >(which.size());
+    for (int i = 0; i < numberChanged; i++) {
+      model->columnLower_[which[i]] = bounds[2 * i];
+      model->columnUpper_[which[i]] = bounds[2 * i + 1];
+    }
+    model->setDblParam(ClpDualObjectiveLimit, saveObjLimit);
+    int splitColumn = -1;
+    double splitValue = 0.0;
+    bool doFathom = true;
+    if (depth < splitDepth) {
+      model->dual();
+      shared.numberNodes_++;
+      shared.numberIterations_ += model->numberIterations();
+      int status = model->problemStatus();
+      if (status) {
+        doFathom = false;
+        if (status != 1)
+          shared.stop(-1);
+      } else if (model->objectiveValue() * optimizationDirection_ > shared.cutoff()) {
+        doFathom = false;
+      } else {
+        splitColumn = fathomSplitVariable(model, threadInfo, back);
+        if (splitColumn >= 0) {
+          splitValue = model->columnActivity_[splitColumn];
+          doFathom = false;
+        }
+        // else integer feasible - fathom will find solution
+      }
+    }
+    if (doFathom) {
+      int returnCode = model->fathom(threadInfo);
+      shared.numberNodes_ += threadInfo->numberNodesExplored_;
+      shared.numberIterations_ += threadInfo->numberIterations_;
+      if (threadInfo->nNodes_ < 0)
+        shared.stop(threadInfo->nNodes_);
+      if (returnCode)
+        shared.saveSolution(model);
+    }
+    double splitLower = splitColumn >= 0 ? model->columnLower_[splitColumn] : 0.0;
+    double splitUpper = splitColumn >= 0 ? model->columnUpper_[splitColumn] : 0.0;
+    // give clone back before spawning (a serial pool runs tasks at once)
+    {
+      std::lock_guard< std::mutex > lock(cloneMutex);
+      freeClones.push_back(iClone);
+    }
+    if (splitColumn >= 0) {
+      std::vector< int > which2(which);
+      which2.push_back(splitColumn);
+      std::vector< double > down(bounds);
+      down.push_back(splitLower);
+      down.push_back(floor(splitValue));
+      std::vector< double > up(bounds);
+      up.push_back(ceil(splitValue));
+      up.push_back(splitUpper);
+      int depth2 = depth + 1;
+      group.spawn([&doSubtree, which2, down, depth2]() {
+        doSubtree(which2, down, depth2);
+      });
+      group.spawn([&doSubtree, which2, up, depth2]() {
+        doSubtree(which2, up, depth2);
+      });
+    }
+  };
+  doSubtree(std::vector< int >(), std::vector< double >(), 0);
+  group.wait();
+  int numberClones = static_cast< int >(models.size());
+  for (int i = 0; i < numberClones; i++) {
+#ifndef NO_FATHOM_PRINT
+    delete infos[i]->handler_;
+#endif
+    // pseudo costs belong to info
+    infos[i]->zap(1);
+    delete infos[i];
+    delete models[i];
+    delete handlers[i];
+  }
+  delete privatePool;
+  delete[] back;
+  info->nNodes_ = shared.stopped();
+  info->numberNodesExplored_ = shared.numberNodes_;
+  info->numberIterations_ = shared.numberIterations_;
+  int returnCode = 0;
+  if (shared.bestLower_) {
+    // as serial fathom - fix integers and resolve
+    CoinMemcpyN(shared.bestLower_, numberColumns_, columnLower_);
+    CoinMemcpyN(shared.bestUpper_, numberColumns_, columnUpper_);
+    CoinMemcpyN(shared.bestStatus_, numberTotal, status_);
+    int saveOptions = specialOptions_;
+    specialOptions_ &= ~65536;
+    dual();
+    specialOptions_ = saveOptions;
+    returnCode = 1;
+    if (info->nNodes_ < 0) {
+      CoinMemcpyN(saveLower, numberColumns_, columnLower_);
+      CoinMemcpyN(saveUpper, numberColumns_, columnUpper_);
+    }
+  }
+  delete[] saveLower;
+  delete[] saveUpper;
+  delete[] saveStatus;
+  return returnCode;
+}
 //#define CHECK_PATH
 #ifdef CHECK_PATH
 const double *debuggerSolution_Z = NULL;
@@ -30,6 +30,7 @@ class CoinStructuredModel;
 class OsiClpSolverInterface;
 class CoinWarmStartBasis;
 class ClpDisasterHandler;
+class ClpCholeskySymbolic;
 class ClpConstraint;
 /*
   May want to use Clp defaults so that with ABC defined but not used
@@ -563,6 +564,16 @@ public:
   void setPrimalColumnPivotAlgorithm(ClpPrimalColumnPivot &choice);
   /// Create a hotstart point of the optimization process
   void markHotStart(void *&saveStuff);
+  /** Create a hotstart point recording only what differs from baseStuff
+         (bound, solution and cost changes as 8 byte words, status bytes
+         and pivots) - the factorization of baseStuff is shared if the
+         basis is the same.  baseStuff must be a full snapshot (from
+         markHotStart above) of this model and must be unmarked after
+         any snapshots made from it.  If it is NULL or not usable a
+         full snapshot is made. */
+  void markHotStart(void *&saveStuff, const void *baseStuff);
+  /// Bytes held by a hot start snapshot (factorization estimated)
+  int hotStartSize(const void *saveStuff) const;
   /// Optimize starting from the hotstart
   void solveFromHotStart(void *saveStuff);
   /// Delete the snapshot
@@ -574,6 +585,12 @@ public:
          ways and +1 if infeasible one way (check values to see which one(s))
          Solutions are filled in as well - even down, odd up - also
          status and number of iterations
+         If numberThreads > 1 candidates are split into that many
+         consecutive chunks and each chunk is done on a clone (first
+         chunk on this model) using ClpThreadPool.  Every candidate
+         starts from the same hot start state so results are those of
+         the serial code - including where it stops early (solutions
+         for candidates after that point are not meaningful).
      */
   int strongBranching(int numberVariables, const int *variables,
     double *newLower, double *newUpper,
@@ -581,9 +598,39 @@ public:
     int *outputStatus, int *outputIterations,
     bool stopOnFirstInfeasible = true,
     bool alwaysFinish = false,
-    int startFinishOptions = 0);
-  /// Fathom - 1 if solution
+    int startFinishOptions = 0,
+    int numberThreads = 1);
+  /** Solves numberScenarios variants of a model with linear objective which
+         differ only in row bounds and/or objective (scenario analysis).
+         rowLowers, rowUppers and objectives are arrays of numberScenarios
+         pointers - the array or any entry may be NULL which means use
+         the model's own values.
+         Scenarios are solved by dual in order, each warm started from the
+         previous one keeping factorization and work arrays, so only
+         changed values are re-scaled.
+         If numberThreads > 1 scenarios are split into that many
+         consecutive chunks and each chunk is solved on a clone (first
+         chunk on this model) using ClpThreadPool (a private pool if the
+         shared one has fewer threads).
+         On output objectiveValues and statuses (problemStatus) are filled in
+         and, if not NULL, columnSolutions[i], rowDuals[i] and iterations.
+         The model's bounds and objective are put back at end but solution
+         and basis are left from its last scenario.
+         Returns number of scenarios which were not proven optimal.
+     */
+  int solveScenarios(int numberScenarios,
+    const double *const *rowLowers, const double *const *rowUppers,
+    const double *const *objectives,
+    double *objectiveValues, int *statuses,
+    double **columnSolutions = NULL, double **rowDuals = NULL,
+    int *iterations = NULL, int numberThreads = 1);
+  /** Fathom - 1 if solution.
+         If numberThreads_ in stuff (a ClpNodeStuff) is > 1 subtrees are
+         explored in parallel, each on a clone it has to itself while it
+         runs, sharing pseudo costs and cutoff (see ClpFathomShared). */
   int fathom(void *stuff);
+  /// Parallel part of fathom
+  int parallelFathom(ClpNodeStuff *stuff);
   /** Do up to N deep - returns
          -1 - no solution nNodes_ valid nodes
          >= if solution and that node gives solution
@@ -996,6 +1043,17 @@ public:
   {
     return disasterArea_;
   }
+  /** Set symbolic Cholesky cache (not owned) - barrier with native
+      Cholesky then skips ordering when pattern has not changed */
+  inline void setCholeskySymbolic(ClpCholeskySymbolic *cache)
+  {
+    choleskySymbolic_ = cache;
+  }
+  /// Get symbolic Cholesky cache
+  inline ClpCholeskySymbolic *choleskySymbolic() const
+  {
+    return choleskySymbolic_;
+  }
   /// Large bound value (for complementarity etc)
   inline double largeValue() const
   {
@@ -1911,6 +1969,8 @@ protected:
   int numberTimesOptimal_;
   /// Disaster handler
   ClpDisasterHandler *disasterArea_;
+  /// Symbolic Cholesky cache for barrier (not owned)
+  ClpCholeskySymbolic *choleskySymbolic_;
   /// If change has been made (first attempt at stopping looping)
   int changeMade_;
   /// Algorithm >0 == Primal, <0 == Dual
@@ -2038,6 +2098,11 @@ typedef struct {
   int status;
   int stuff[4];
 } CoinThreadInfo;
+/** Deprecated - pthread driver which solveDW and solveBenders used to
+    solve blocks.  They now use ClpThreadPool tasks and nothing in Clp
+    uses this.  Kept so existing code still builds and links, it will be
+    removed in a later release.
+*/
 class CLPLIB_EXPORT CoinPthreadStuff {
 public:
   /**@name Constructors and destructor and copy */
@@ -2102,6 +2167,7 @@ public:
   int stopStart_;
   int numberThreads_;
 };
+/// Deprecated - thread function for CoinPthreadStuff (see above)
 void *clp_parallelManager(void *stuff);
 typedef struct {
   double upperTheta;
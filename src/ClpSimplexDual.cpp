@@ -111,6 +111,7 @@
 #include "ClpMessage.hpp"
 #include "ClpLinearObjective.hpp"
 #include "CoinTime.hpp"
+#include "ClpThreadPool.hpp"
 #include <cfloat>
 #include <cassert>
 #include <string>
@@ -6833,8 +6834,15 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
   int *outputStatus, int *outputIterations,
   bool stopOnFirstInfeasible,
   bool alwaysFinish,
-  int startFinishOptions)
+  int startFinishOptions,
+  int numberThreads)
 {
+  if (numberThreads > 1 && numberVariables > 1)
+    return parallelStrongBranching(numberVariables, variables,
+      newLower, newUpper, outputSolution,
+      outputStatus, outputIterations,
+      stopOnFirstInfeasible, alwaysFinish,
+      startFinishOptions, numberThreads);
   int i;
   int returnCode = 0;
   double saveObjectiveValue = objectiveValue_;
@@ -7102,6 +7110,96 @@ int ClpSimplexDual::strongBranching(int numberVariables, const int *variables,
   objectiveValue_ = saveObjectiveValue;
   return returnCode;
 }
+/* Strong branching with candidates split into consecutive chunks.
+   Each chunk is done by serial strongBranching on a clone (first chunk
+   on this model).  Clones are taken before anything is changed so each
+   has its own copy of factorization, rim arrays and dual pivot weights
+   and as every candidate starts from that same state results are those
+   of serial code.  Chunks can not see each other stopping early so the
+   serial stopping rule is applied afterwards and anything done beyond
+   where serial code would have stopped is put back.
+*/
+int ClpSimplexDual::parallelStrongBranching(int numberVariables, const int *variables,
+  double *newLower, double *newUpper,
+  double **outputSolution,
+  int *outputStatus, int *outputIterations,
+  bool stopOnFirstInfeasible,
+  bool alwaysFinish,
+  int startFinishOptions,
+  int numberThreads)
+{
+  int numberChunks = CoinMin(numberThreads, numberVariables);
+  ClpSimplexDual **models = new ClpSimplexDual *[numberChunks];
+  CoinMessageHandler **handlers = new CoinMessageHandler *[numberChunks];
+  int *returnCodes = new int[numberChunks];
+  models[0] = this;
+  handlers[0] = NULL;
+  for (int i = 1; i < numberChunks; i++) {
+    models[i] = static_cast< ClpSimplexDual * >(new ClpSimplex(*this));
+    // own handler as not threadsafe
+    handlers[i] = new CoinMessageHandler(*handler_);
+    models[i]->passInMessageHandler(handlers[i]);
+  }
+  // save input so can put back where serial would not have got to
+  double *saveLower = CoinCopyOfArray(newLower, numberVariables);
+  double *saveUpper = CoinCopyOfArray(newUpper, numberVariables);
+  int *saveStatus = CoinCopyOfArray(outputStatus, 2 * numberVariables);
+  int *saveIterations = CoinCopyOfArray(outputIterations, 2 * numberVariables);
+  int chunk = numberVariables / numberChunks;
+  int extra = numberVariables - chunk * numberChunks;
+  // shared pool if big enough - otherwise a private one for this call
+  clpParallelTasks(numberChunks, numberChunks, [&](int i) {
+    int first = i * chunk + CoinMin(i, extra);
+    int n = chunk + (i < extra ? 1 : 0);
+    returnCodes[i] = models[i]->strongBranching(n, variables + first,
+      newLower + first, newUpper + first,
+      outputSolution ? outputSolution + 2 * first : NULL,
+      outputStatus + 2 * first, outputIterations + 2 * first,
+      stopOnFirstInfeasible, alwaysFinish, startFinishOptions, 1);
+  });
+  int returnCode = 0;
+  for (int i = 0; i < numberChunks; i++) {
+    if (returnCodes[i] == -2)
+      returnCode = -2;
+    if (i) {
+      delete models[i];
+      delete handlers[i];
+    }
+  }
+  if (!returnCode) {
+    // same rules as serial code
+    int i;
+    for (i = 0; i < numberVariables; i++) {
+      bool downInfeasible = newUpper[i] >= 1.0e100;
+      bool upInfeasible = newLower[i] >= 1.0e100;
+      if (downInfeasible && upInfeasible) {
+        returnCode = -1;
+        break;
+      } else if (downInfeasible || upInfeasible) {
+        returnCode = 1;
+        if (stopOnFirstInfeasible)
+          break;
+      }
+    }
+    // put back rest (solutions are not - they should not be looked at)
+    for (i++; i < numberVariables; i++) {
+      newLower[i] = saveLower[i];
+      newUpper[i] = saveUpper[i];
+      outputStatus[2 * i] = saveStatus[2 * i];
+      outputStatus[2 * i + 1] = saveStatus[2 * i + 1];
+      outputIterations[2 * i] = saveIterations[2 * i];
+      outputIterations[2 * i + 1] = saveIterations[2 * i + 1];
+    }
+  }
+  delete[] saveLower;
+  delete[] saveUpper;
+  delete[] saveStatus;
+  delete[] saveIterations;
+  delete[] models;
+  delete[] handlers;
+  delete[] returnCodes;
+  return returnCode;
+}
 // treat no pivot as finished (unless interesting)
 int ClpSimplexDual::fastDual(bool alwaysFinish)
 {
@@ -121,6 +121,8 @@ public:
          ways and +1 if infeasible one way (check values to see which one(s))
          Solutions are filled in as well - even down, odd up - also
          status and number of iterations
+         If numberThreads > 1 candidates are split into that many chunks
+         each done on a clone using ClpThreadPool - results are as serial.
      */
   int strongBranching(int numberVariables, const int *variables,
     double *newLower, double *newUpper,
@@ -128,7 +130,17 @@ public:
     int *outputStatus, int *outputIterations,
     bool stopOnFirstInfeasible = true,
     bool alwaysFinish = false,
-    int startFinishOptions = 0);
+    int startFinishOptions = 0,
+    int numberThreads = 1);
+  /// Strong branching on chunks of candidates in parallel (see above)
+  int parallelStrongBranching(int numberVariables, const int *variables,
+    double *newLower, double *newUpper,
+    double **outputSolution,
+    int *outputStatus, int *outputIterations,
+    bool stopOnFirstInfeasible,
+    bool alwaysFinish,
+    int startFinishOptions,
+    int numberThreads);
   /// This does first part of StrongBranching
   ClpFactorization *setupForStrongBranching(char *arrays, int numberRows,
     int numberColumns, bool solveLp = false);
@@ -42,22 +42,8 @@ int ClpSimplexNonlinear::primal()
 
   // Save objective
   ClpObjective *saveObjective = NULL;
-  if (objective_->type() > 1) {
-    // expand to full if quadratic
-#ifndef NO_RTTI
-    ClpQuadraticObjective *quadraticObj = (dynamic_cast< ClpQuadraticObjective * >(objective_));
-#else
-    ClpQuadraticObjective *quadraticObj = NULL;
-    if (objective_->type() == 2)
-      quadraticObj = (static_cast< ClpQuadraticObjective * >(objective_));
-#endif
-    // for moment only if no scaling
-    // May be faster if switched off - but can't see why
-    if (!quadraticObj->fullMatrix() && (!rowScale_ && !scalingFlag_) && objectiveScale_ == 1.0) {
-      saveObjective = objective_;
-      objective_ = new ClpQuadraticObjective(*quadraticObj, 1);
-    }
-  }
+  /* Quadratic objective is left as half matrix - ClpQuadraticObjective
+     uses it as symmetric so no need for full copy */
   double bestObjectiveWhenFlagged = COIN_DBL_MAX;
   int pivotMode = 15;
   //pivotMode=20;
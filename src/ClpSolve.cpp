@@ -12,6 +12,8 @@
 #endif
 
 #include <math.h>
+#include <atomic>
+#include <vector>
 #ifdef _MSC_VER
 #include <windows.h> // for Sleep()
 #ifdef small
@@ -35,6 +37,7 @@
 #include "ClpCholeskyBase.hpp"
 #include "ClpPlusMinusOneMatrix.hpp"
 #include "ClpNetworkMatrix.hpp"
+#include "ClpNetworkSimplex.hpp"
 #endif
 #include "ClpEventHandler.hpp"
 #include "ClpLinearObjective.hpp"
@@ -42,6 +45,7 @@
 #include "ClpPackedMatrix.hpp"
 #include "ClpMessage.hpp"
 #include "CoinTime.hpp"
+#include "ClpThreadPool.hpp"
 #if CLP_HAS_ABC
 #include "CoinAbcCommon.hpp"
 #endif
@@ -550,12 +554,6 @@ void instrument_print()
   }
 }
 #endif
-#if ABC_PARALLEL == 2
-#ifndef FAKE_CILK
-int number_cilk_workers = 0;
-#include <cilk/cilk_api.h>
-#endif
-#endif
 #ifdef ABC_INHERIT
 AbcSimplex *
 ClpSimplex::dealWithAbc(int solveType, int startUp,
@@ -639,13 +637,15 @@ ClpSimplex::dealWithAbc(int solveType, int startUp,
 #endif
     }
     int numberCpu = this->abcState() & 15;
+#if ABC_PARALLEL == 2
+    // threads come from ClpThreadPool (-threads in clp)
+    int numberThreads = ClpThreadPool::wantedNumberThreads();
+#endif
     if (numberCpu == 9) {
       numberCpu = 1;
 #if ABC_PARALLEL == 2
-#ifndef FAKE_CILK
-      if (number_cilk_workers > 1)
-        numberCpu = CoinMin(2 * number_cilk_workers, 8);
-#endif
+      if (numberThreads > 1)
+        numberCpu = CoinMin(2 * numberThreads, 8);
 #endif
     } else if (numberCpu == 10) {
       // maximum
@@ -655,37 +655,21 @@ ClpSimplex::dealWithAbc(int solveType, int startUp,
       if (abcModel2->getNumElements() < 5000)
         numberCpu = 1;
 #if ABC_PARALLEL == 2
-#ifndef FAKE_CILK
-      else if (number_cilk_workers > 1)
-        numberCpu = CoinMin(2 * number_cilk_workers, 8);
-#endif
+      else if (numberThreads > 1)
+        numberCpu = CoinMin(2 * numberThreads, 8);
 #endif
       else
         numberCpu = 1;
-    } else {
-#if ABC_PARALLEL == 2
-#ifndef FAKE_CILK
-      char temp[3];
-      sprintf(temp, "%d", numberCpu);
-      __cilkrts_set_param("nworkers", temp);
-      printf("setting cilk workers to %d\n", numberCpu);
-      number_cilk_workers = numberCpu;
-
-#endif
-#endif
     }
     char line[200];
 #if ABC_PARALLEL
 #if ABC_PARALLEL == 2
-#ifndef FAKE_CILK
-    if (!number_cilk_workers) {
-      number_cilk_workers = __cilkrts_get_nworkers();
-      sprintf(line, "%d cilk workers", number_cilk_workers);
-      handler_->message(CLP_GENERAL, messages_)
+    if (numberCpu > 1) {
+      sprintf(line, "%d threads, %d blocks", numberThreads, numberCpu);
+      handler_->message(CLP_GENERAL2, messages_)
         << line
         << CoinMessageEol;
     }
-#endif
 #endif
     abcModel2->setParallelMode(numberCpu - 1);
 #endif
@@ -837,6 +821,188 @@ ClpSimplex::dealWithAbc(int solveType, int startUp,
   return abcModel2;
 }
 #endif
+/* Event handler given to each copy in ClpSolve::useRace.  Once another
+   copy has finished it stops this one at the end of an iteration.
+   Everything else is passed on to a copy of user's handler.
+*/
+class ClpRaceEventHandler : public ClpEventHandler {
+
+public:
+  ClpRaceEventHandler(std::atomic< int > *winner, int which,
+    const ClpEventHandler *userHandler)
+    : ClpEventHandler()
+    , winner_(winner)
+    , which_(which)
+    , userHandler_(userHandler ? userHandler->clone() : NULL)
+  {
+  }
+  ClpRaceEventHandler(const ClpRaceEventHandler &rhs)
+    : ClpEventHandler(rhs)
+    , winner_(rhs.winner_)
+    , which_(rhs.which_)
+    , userHandler_(rhs.userHandler_ ? rhs.userHandler_->clone() : NULL)
+  {
+  }
+  virtual ~ClpRaceEventHandler()
+  {
+    delete userHandler_;
+  }
+  virtual ClpEventHandler *clone() const
+  {
+    return new ClpRaceEventHandler(*this);
+  }
+  virtual int event(Event whichEvent)
+  {
+    if (whichEvent == endOfIteration) {
+      int winner = winner_->load(std::memory_order_relaxed);
+      if (winner >= 0 && winner != which_)
+        return 0; // lost
+    }
+    if (userHandler_) {
+      userHandler_->setSimplex(model_);
+      return userHandler_->event(whichEvent);
+    }
+    return -1;
+  }
+  virtual int eventWithInfo(Event whichEvent, void *info)
+  {
+    if (userHandler_) {
+      userHandler_->setSimplex(model_);
+      return userHandler_->eventWithInfo(whichEvent, info);
+    }
+    return -1;
+  }
+
+private:
+  ClpRaceEventHandler &operator=(const ClpRaceEventHandler &);
+  /// Shared - which copy has finished (-1 if none yet)
+  std::atomic< int > *winner_;
+  /// Which copy this is
+  int which_;
+  /// Copy of user's handler
+  ClpEventHandler *userHandler_;
+};
+/* ClpSolve::useRace - dual, primal and barrier (with crossover) are run on
+   copies of model, as tasks on ClpThreadPool.  The first to prove optimality,
+   infeasibility or unboundedness wins, the others are stopped through their
+   event handlers and the winner's solution and basis are copied back.
+*/
+static int clpRaceSolve(ClpSimplex *model, ClpSolve &options)
+{
+#ifndef SLIM_CLP
+  const int numberRacers = 3;
+#else
+  const int numberRacers = 2;
+#endif
+  const ClpSolve::SolveType methods[] = { ClpSolve::useDual, ClpSolve::usePrimal, ClpSolve::useBarrier };
+  const char *names[] = { "dual simplex", "primal simplex", "barrier" };
+  double time1 = CoinCpuTime();
+  double wallTime1 = CoinGetTimeOfDay();
+  std::atomic< int > winner(-1);
+  ClpSimplex *racers[3];
+  CoinMessageHandler *handlers[3];
+  int returnCodes[3];
+  int logLevel = model->logLevel();
+  for (int i = 0; i < numberRacers; i++) {
+    racers[i] = new ClpSimplex(*model);
+    // own handlers as not threadsafe - only print if asked for lots
+    handlers[i] = new CoinMessageHandler(*model->messageHandler());
+    handlers[i]->setLogLevel(logLevel > 1 ? logLevel : 0);
+    racers[i]->passInMessageHandler(handlers[i]);
+    ClpRaceEventHandler handler(&winner, i, model->eventHandler());
+    racers[i]->passInEventHandler(&handler);
+    returnCodes[i] = -1;
+  }
+  auto race = [&](int i) {
+    ClpSolve racerOptions(options);
+    racerOptions.setSolveType(methods[i]);
+    // a saved presolve can only be used by one solve at a time
+    racerOptions.setSavedPresolve(NULL);
+    // no interrupt handling (not threadsafe)
+    racerOptions.setSpecialOption(2, 1);
+    // idiot can not be stopped early
+    if (methods[i] == ClpSolve::usePrimal && !racerOptions.getSpecialOption(1))
+      racerOptions.setSpecialOption(1, 5);
+    returnCodes[i] = racers[i]->initialSolve(racerOptions);
+    int status = racers[i]->problemStatus();
+    if (status >= 0 && status <= 2) {
+      int none = -1;
+      winner.compare_exchange_strong(none, i);
+    }
+  };
+  // as many racers at once as -threads allows - with one thread they run
+  // in turn and the later ones stop at their first iteration
+  clpParallelTasks(numberRacers, ClpThreadPool::wantedNumberThreads(), race);
+  int which = winner.load();
+  if (which < 0) {
+    // nobody finished properly - take first not stopped by others
+    which = 0;
+    for (int i = 0; i < numberRacers; i++) {
+      if (racers[i]->problemStatus() != 5) {
+        which = i;
+        break;
+      }
+    }
+  }
+  ClpSimplex *best = racers[which];
+  int numberRows = model->numberRows();
+  int numberColumns = model->numberColumns();
+  CoinMemcpyN(best->primalColumnSolution(), numberColumns, model->primalColumnSolution());
+  CoinMemcpyN(best->dualColumnSolution(), numberColumns, model->dualColumnSolution());
+  CoinMemcpyN(best->primalRowSolution(), numberRows, model->primalRowSolution());
+  CoinMemcpyN(best->dualRowSolution(), numberRows, model->dualRowSolution());
+  model->copyinStatus(best->statusArray());
+  model->setObjectiveValue(best->objectiveValue());
+  model->setProblemStatus(best->problemStatus());
+  model->setSecondaryStatus(best->secondaryStatus());
+  model->setNumberIterations(best->numberIterations());
+  model->setSumPrimalInfeasibilities(best->sumPrimalInfeasibilities());
+  model->setNumberPrimalInfeasibilities(best->numberPrimalInfeasibilities());
+  model->setSumDualInfeasibilities(best->sumDualInfeasibilities());
+  model->setNumberDualInfeasibilities(best->numberDualInfeasibilities());
+  int returnCode = returnCodes[which];
+  for (int i = 0; i < numberRacers; i++) {
+    delete racers[i];
+    delete handlers[i];
+  }
+  char line[200];
+  sprintf(line, "Race won by %s - %.2f seconds (%.2f cpu)",
+    names[which], CoinGetTimeOfDay() - wallTime1, CoinCpuTime() - time1);
+  model->messageHandler()->message(CLP_GENERAL, *model->messagesPointer())
+    << line << CoinMessageEol;
+  return returnCode;
+}
+#ifndef SLIM_CLP
+/* ClpSolve::useNetwork - primal network simplex on the tree then primal
+   to clean up.  Returns -2 if not a network or network simplex did not
+   finish optimal, in which case the normal solve carries on (and finds
+   rays etc).
+*/
+static int clpNetworkSolve(ClpSimplex *model)
+{
+  ClpNetworkSimplex network;
+  if (network.load(model))
+    return -2;
+  double time1 = CoinCpuTime();
+  int status = network.solve(model->maximumIterations());
+  char line[200];
+  if (status) {
+    const char *why[] = { "", "infeasible", "unbounded", "stopped" };
+    sprintf(line, "Network simplex %s after %d iterations - using normal simplex",
+      why[status], network.numberIterations());
+    model->messageHandler()->message(CLP_GENERAL, *model->messagesPointer())
+      << line << CoinMessageEol;
+    return -2;
+  }
+  sprintf(line, "Network simplex took %d iterations and %.2f seconds (%d rows flipped)",
+    network.numberIterations(), CoinCpuTime() - time1, network.numberFlipped());
+  model->messageHandler()->message(CLP_GENERAL, *model->messagesPointer())
+    << line << CoinMessageEol;
+  network.copyBack(model);
+  model->setNumberIterations(model->numberIterations() + network.numberIterations());
+  return model->status();
+}
+#endif
 /** General solve algorithm which can do presolve
     special options (bits)
     1 - do not perturb
@@ -879,6 +1045,16 @@ int ClpSimplex::initialSolve(ClpSolve &options)
   } else if (!numberRows_ || !numberColumns_ || !getNumElements()) {
     presolve = ClpSolve::presolveOff;
   }
+  if (method == ClpSolve::useRace)
+    return clpRaceSolve(this, options);
+#ifndef SLIM_CLP
+  if (method == ClpSolve::useNetwork) {
+    int returnCode = clpNetworkSolve(this);
+    if (returnCode != -2)
+      return returnCode;
+    method = ClpSolve::useDual;
+  }
+#endif
   if (objective_->type() >= 2 && optimizationDirection_ == 0) {
     // pretend linear
     savedObjective = objective_;
@@ -909,7 +1085,9 @@ int ClpSimplex::initialSolve(ClpSolve &options)
   // If no status array - set up basis
   if (!status_)
     allSlackBasis();
-  ClpPresolve *pinfo = new ClpPresolve();
+  // presolve may be kept from last time
+  ClpPresolve *savedPresolve = options.savedPresolve();
+  ClpPresolve *pinfo = savedPresolve ? savedPresolve : new ClpPresolve();
   pinfo->setSubstitution(options.substitution());
   int presolveOptions = options.presolveActions();
   bool presolveToFile = (presolveOptions & 0x40000000) != 0;
@@ -974,8 +1152,18 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       model2 = this;
     } else {
 #endif
-      model2 = pinfo->presolvedModel(*this, dblParam_[ClpPresolveTolerance],
-        false, numberPasses, true, costedSlacks);
+      model2 = NULL;
+      if (savedPresolve)
+        model2 = pinfo->reusedPresolvedModel(*this);
+      if (!model2) {
+        // values changed where presolve made use of them (or first time)
+        if (savedPresolve)
+          pinfo->destroyPresolve();
+        model2 = pinfo->presolvedModel(*this, dblParam_[ClpPresolveTolerance],
+          false, numberPasses, true, costedSlacks);
+        if (savedPresolve && model2)
+          pinfo->savePresolve();
+      }
 #ifndef CLP_NO_STD
     }
 #endif
@@ -993,7 +1181,8 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       problemStatus_ = pinfo->presolveStatus();
       secondaryStatus_ = 11;
       if (options.infeasibleReturn() || (moreSpecialOptions_ & 1) != 0) {
-        delete pinfo;
+        if (pinfo != savedPresolve)
+          delete pinfo;
         return -1;
       }
       presolve = ClpSolve::presolveOff;
@@ -1028,11 +1217,13 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       // see if too big or small
       if (rcode == 2) {
         delete model2;
-        delete pinfo;
+        if (pinfo != savedPresolve)
+          delete pinfo;
         return -2;
       } else if (rcode == 3) {
         delete model2;
-        delete pinfo;
+        if (pinfo != savedPresolve)
+          delete pinfo;
         return -3;
       }
     }
@@ -1794,6 +1985,7 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       Idiot info(*model2);
       info.setMinIntervalStatusUpdate(model2->getMinIntervalProgressUpdate());
       info.setStrategy(idiotOptions | info.getStrategy());
+      info.setNumberBlocks(options.idiotBlocks());
       // Get average number of elements per column
       double ratio = static_cast< double >(numberElements) / static_cast< double >(numberColumns);
       // look at rhs
@@ -1981,6 +2173,7 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       Idiot info(*model2);
       info.setMinIntervalStatusUpdate(model2->getMinIntervalProgressUpdate());
       info.setStrategy(idiotOptions | info.getStrategy());
+      info.setNumberBlocks(options.idiotBlocks());
       // Get average number of elements per column
       double ratio = static_cast< double >(numberElements) / static_cast< double >(numberColumns);
       // look at rhs
@@ -3193,10 +3386,12 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       if (!doKKT) {
         ClpCholeskyBase *cholesky = new ClpCholeskyBase(options.getExtraInfo(1));
         cholesky->setIntegerParameter(0, speed);
+        cholesky->setSymbolicCache(choleskySymbolic_);
         barrier.setCholesky(cholesky);
       } else {
         ClpCholeskyBase *cholesky = new ClpCholeskyBase();
         cholesky->setKKT(true);
+        cholesky->setSymbolicCache(choleskySymbolic_);
         barrier.setCholesky(cholesky);
       }
       break;
@@ -3768,9 +3963,12 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       setLogLevel(CoinMin(1, saveLevel));
     else
       setLogLevel(CoinMin(0, saveLevel));
+    if (pinfo == savedPresolve)
+      pinfo->saveBasis();
     pinfo->postsolve(true);
     numberIterations_ = 0;
-    delete pinfo;
+    if (pinfo != savedPresolve)
+      delete pinfo;
     pinfo = NULL;
     factorization_->areaFactor(model2->factorization()->adjustedAreaFactor());
     time2 = CoinCpuTime();
@@ -3983,7 +4181,8 @@ int ClpSimplex::initialSolve(ClpSolve &options)
     finalStatus = status();
   }
   eventHandler()->event(ClpEventHandler::presolveEnd);
-  delete pinfo;
+  if (pinfo != savedPresolve)
+    delete pinfo;
   moreSpecialOptions_ = saveMoreOptions;
 #ifdef CLP_USEFUL_PRINTOUT
   debugInt[23] = numberIterations_;
@@ -4049,6 +4248,8 @@ ClpSolve::ClpSolve()
   independentOptions_[1] = 512;
   // Substitute up to 3
   independentOptions_[2] = 3;
+  idiotBlocks_ = 1;
+  savedPresolve_ = NULL;
 }
 // Constructor when you really know what you are doing
 ClpSolve::ClpSolve(SolveType method, PresolveType presolveType,
@@ -4067,6 +4268,8 @@ ClpSolve::ClpSolve(SolveType method, PresolveType presolveType,
   extraInfo_[6] = 0;
   for (i = 0; i < 3; i++)
     independentOptions_[i] = independentOptions[i];
+  idiotBlocks_ = 1;
+  savedPresolve_ = NULL;
 }
 
 // Copy constructor.
@@ -4082,6 +4285,8 @@ ClpSolve::ClpSolve(const ClpSolve &rhs)
     extraInfo_[i] = rhs.extraInfo_[i];
   for (i = 0; i < 3; i++)
     independentOptions_[i] = rhs.independentOptions_[i];
+  idiotBlocks_ = rhs.idiotBlocks_;
+  savedPresolve_ = rhs.savedPresolve_;
 }
 // Assignment operator. This copies the data
 ClpSolve &
@@ -4098,6 +4303,8 @@ ClpSolve::operator=(const ClpSolve &rhs)
       extraInfo_[i] = rhs.extraInfo_[i];
     for (i = 0; i < 3; i++)
       independentOptions_[i] = rhs.independentOptions_[i];
+    idiotBlocks_ = rhs.idiotBlocks_;
+    savedPresolve_ = rhs.savedPresolve_;
   }
   return *this;
 }
@@ -4165,6 +4372,10 @@ void ClpSolve::generateCpp(FILE *fp)
     "ClpSolve::useBarrier",
     "ClpSolve::useBarrierNoCross",
     "ClpSolve::automatic",
+    "ClpSolve::tryDantzigWolfe",
+    "ClpSolve::tryBenders",
+    "ClpSolve::useRace",
+    "ClpSolve::useNetwork",
     "ClpSolve::notImplemented"
   };
   std::string presolveType[] = {
@@ -5126,6 +5337,7 @@ ClpSimplex::scaleObjective(double value)
   return largest;
 }
 #if defined(ABC_INHERIT) || defined(THREADS_IN_ANALYZE)
+// Deprecated - nothing in Clp uses CoinPthreadStuff now
 void *clp_parallelManager(void *stuff)
 {
   CoinPthreadStuff *driver = reinterpret_cast< CoinPthreadStuff * >(stuff);
@@ -5469,8 +5681,6 @@ int ClpSimplex::solveDW(CoinStructuredModel *model, ClpSolve &options)
   //AbcSimplex abcMaster;
   //if (!this->abcState())
   //setAbcState(1);
-  int numberCpu = CoinMin((this->abcState() & 15), 4);
-  CoinPthreadStuff threadInfo(numberCpu, clp_parallelManager);
   master.setAbcState(this->abcState());
   //AbcSimplex * tempMaster=master.dealWithAbc(2,10,true);
   //abcMaster=*tempMaster;
@@ -5656,77 +5866,61 @@ int ClpSimplex::solveDW(CoinStructuredModel *model, ClpSolve &options)
       int numberColumns2 = sub[iBlock].numberColumns();
       saveObj2[iBlock] = new double[numberColumns2];
     }
-    for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
-      int numberColumns2 = sub[iBlock].numberColumns();
-      double *saveObj = saveObj2[iBlock];
-      double *objective2 = sub[iBlock].objective();
-      memcpy(saveObj, objective2, numberColumns2 * sizeof(double));
-      // new objective
-      top[iBlock]->transposeTimes(dual, objective2);
-      int i;
-      if (problemStatus == 0) {
-        for (i = 0; i < numberColumns2; i++)
-          objective2[i] = saveObj[i] - objective2[i];
-      } else {
-        for (i = 0; i < numberColumns2; i++)
-          objective2[i] = -objective2[i];
-      }
-      // scale objective to be reasonable
-      //double scaleFactor =
-      //   sub[iBlock].scaleObjective((sumArtificials > 1.0e-5) ? -1.0e-4 : -1.0e9);
-
-      if (reducePrint)
-        sub[iBlock].setLogLevel(0);
-    }
-#if defined(ABC_INHERIT)
-    if (numberCpu < 2) {
-#endif
+    /*
+      Sub problems only share the (read only) duals so they are solved
+      as separate tasks - each keeps its own basis for a warm start next
+      pass.  Proposals are then collected in block order and added to
+      the master in one batch so the result does not depend on threads.
+    */
+    {
+      ClpTaskGroup blockGroup;
       for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
-        if (iPass) {
-          sub[iBlock].primal();
-        } else {
-          sub[iBlock].dual();
-        }
-      }
-#if defined(ABC_INHERIT)
-    } else {
-      int iBlock = 0;
-      while (iBlock < numberBlocks) {
-        if (sub[iBlock].secondaryStatus() != 99 || true) {
-          int iThread;
-          threadInfo.waitParallelTask(1, iThread, true);
-#ifdef DETAIL_THREAD
-          printf("Starting block %d on thread %d\n",
-            iBlock, iThread);
-#endif
-          threadInfo.startParallelTask(1, iThread, sub + iBlock);
-        }
-        iBlock++;
+        blockGroup.spawn([&, iBlock]() {
+          int numberColumns2 = sub[iBlock].numberColumns();
+          double *saveObj = saveObj2[iBlock];
+          double *objective2 = sub[iBlock].objective();
+          memcpy(saveObj, objective2, numberColumns2 * sizeof(double));
+          // new objective
+          top[iBlock]->transposeTimes(dual, objective2);
+          int i;
+          if (problemStatus == 0) {
+            for (i = 0; i < numberColumns2; i++)
+              objective2[i] = saveObj[i] - objective2[i];
+          } else {
+            for (i = 0; i < numberColumns2; i++)
+              objective2[i] = -objective2[i];
+          }
+          if (reducePrint)
+            sub[iBlock].setLogLevel(0);
+          if (iPass) {
+            sub[iBlock].primal();
+          } else {
+            sub[iBlock].dual();
+          }
+          sub[iBlock].scaleObjective(scaleFactor);
+          if (!sub[iBlock].isProvenOptimal() && !sub[iBlock].isProvenDualInfeasible()) {
+            memset(objective2, 0, numberColumns2 * sizeof(double));
+            sub[iBlock].primal();
+            if (problemStatus == 0) {
+              for (i = 0; i < numberColumns2; i++)
+                objective2[i] = saveObj[i] - objective2[i];
+            } else {
+              for (i = 0; i < numberColumns2; i++)
+                objective2[i] = -objective2[i];
+            }
+            double scaleFactor = sub[iBlock].scaleObjective(-1.0e9);
+            sub[iBlock].primal(1);
+            sub[iBlock].scaleObjective(scaleFactor);
+          }
+          memcpy(objective2, saveObj, numberColumns2 * sizeof(double));
+        });
       }
-      threadInfo.waitAllTasks();
+      blockGroup.wait();
     }
-#endif
     for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
       int numberColumns2 = sub[iBlock].numberColumns();
       double *saveObj = saveObj2[iBlock];
-      double *objective2 = sub[iBlock].objective();
       int i;
-      sub[iBlock].scaleObjective(scaleFactor);
-      if (!sub[iBlock].isProvenOptimal() && !sub[iBlock].isProvenDualInfeasible()) {
-        memset(objective2, 0, numberColumns2 * sizeof(double));
-        sub[iBlock].primal();
-        if (problemStatus == 0) {
-          for (int i = 0; i < numberColumns2; i++)
-            objective2[i] = saveObj[i] - objective2[i];
-        } else {
-          for (i = 0; i < numberColumns2; i++)
-            objective2[i] = -objective2[i];
-        }
-        double scaleFactor = sub[iBlock].scaleObjective(-1.0e9);
-        sub[iBlock].primal(1);
-        sub[iBlock].scaleObjective(scaleFactor);
-      }
-      memcpy(objective2, saveObj, numberColumns2 * sizeof(double));
       // get proposal
       if (sub[iBlock].numberIterations() || !iPass) {
         double objValue = 0.0;
@@ -6447,8 +6641,6 @@ int ClpSimplex::solveBenders(CoinStructuredModel *model, ClpSolve &options)
   //AbcSimplex abcMaster;
   //if (!this->abcState())
   //setAbcState(1);
-  int numberCpu = CoinMin((this->abcState() & 15), 4);
-  CoinPthreadStuff threadInfo(numberCpu, clp_parallelManager);
   masterModel.setAbcState(this->abcState());
   //AbcSimplex * tempMaster=masterModel.dealWithAbc(2,10,true);
   //abcMaster=*tempMaster;
@@ -6837,7 +7029,7 @@ int ClpSimplex::solveBenders(CoinStructuredModel *model, ClpSolve &options)
       sub[0].scaling(0);
 #endif
 #ifdef ABC_INHERIT
-      sub[0].setAbcState(numberCpu);
+      sub[0].setAbcState(CoinMin((this->abcState() & 15), 4));
       //sub[0].dealWithAbc(0,0,true);
       sub[0].dealWithAbc(1, 1, true);
       sub[0].setAbcState(0);
@@ -6884,66 +7076,57 @@ int ClpSimplex::solveBenders(CoinStructuredModel *model, ClpSolve &options)
       // mark
       sub[0].setSecondaryStatus(99);
     }
-#ifdef ABC_INHERIT
-    if (numberCpu < 2) {
-#endif
-      numberSubInfeasible = 0;
+    /*
+      Each task only touches its own block (which keeps its basis for a
+      warm start next pass).  Cuts are generated afterwards in block order
+      so the result does not depend on the number of threads.
+    */
+    {
+      std::atomic< int > numberStillInfeasible(0);
+      // messages from tasks are printed afterwards in block order
+      std::vector< std::vector< std::string > > blockPrint(numberBlocks);
+      ClpTaskGroup blockGroup;
       for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
+        blockGroup.spawn([&, iBlock]() {
+          char line[200];
 #ifdef TRY_NO_SCALING
-        sub[iBlock].scaling(0);
-#endif
-        if (sub[iBlock].secondaryStatus() != 99 || false) {
-          //int ix=sub[iBlock].secondaryStatus();
-          int lastStatus = sub[iBlock].problemStatus();
-          // was do dual unless unbounded
-          double saveTolerance = sub[iBlock].primalTolerance();
-          if (lastStatus == 0 || !iPass) {
-            //if (lastStatus<2||!iPass) {
-            //sub[iBlock].dual();
-            sub[iBlock].primal();
-            if (!sub[iBlock].isProvenOptimal() && sub[iBlock].sumPrimalInfeasibilities() < treatSubAsFeasible) {
-              printf("Block %d was feasible now has small infeasibility %g\n", iBlock,
-                sub[iBlock].sumPrimalInfeasibilities());
-              sub[iBlock].setPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
-              sub[iBlock].setCurrentPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
-              sub[iBlock].primal();
-              sub[iBlock].setProblemStatus(0);
-              problemState[iBlock] |= 4; // force actions
-            }
-            if ((maxPass == 5000 && scalingFlag_) || (maxPass == 4000 && !scalingFlag_)) {
-              int n = sub[iBlock].numberIterations();
-              sub[iBlock].scaling(0);
+          sub[iBlock].scaling(0);
+#endif
+          if (sub[iBlock].secondaryStatus() != 99 || false) {
+            //int ix=sub[iBlock].secondaryStatus();
+            int lastStatus = sub[iBlock].problemStatus();
+            // was do dual unless unbounded
+            double saveTolerance = sub[iBlock].primalTolerance();
+            if (lastStatus == 0 || !iPass) {
+              //if (lastStatus<2||!iPass) {
+              //sub[iBlock].dual();
               sub[iBlock].primal();
-              sub[iBlock].setNumberIterations(n + sub[iBlock].numberIterations());
-              sub[iBlock].scaling(scalingFlag_);
-            }
-          } else if (lastStatus == 1) {
-            // zero out objective
-            double saveScale = sub[iBlock].infeasibilityCost();
-            ClpObjective *saveObjective = sub[iBlock].objectiveAsObject();
-            int numberColumns = sub[iBlock].numberColumns();
-            ClpLinearObjective fake(NULL, numberColumns);
-            sub[iBlock].setObjectivePointer(&fake);
-            int saveOptions = sub[iBlock].specialOptions();
-            sub[iBlock].setSpecialOptions(saveOptions | 8192);
-            sub[iBlock].primal();
-            if ((maxPass == 5000 && scalingFlag_) || (maxPass == 4000 && !scalingFlag_)) {
-              int n = sub[iBlock].numberIterations();
-              sub[iBlock].scaling(0);
-              sub[iBlock].primal();
-              sub[iBlock].setNumberIterations(n + sub[iBlock].numberIterations());
-              sub[iBlock].scaling(scalingFlag_);
-            }
-            sub[iBlock].setObjectivePointer(saveObjective);
-            sub[iBlock].setInfeasibilityCost(saveScale);
-            if (!sub[iBlock].isProvenOptimal() && sub[iBlock].sumPrimalInfeasibilities() < treatSubAsFeasible) {
-              printf("Block %d was infeasible now has small infeasibility %g\n", iBlock,
-                sub[iBlock].sumPrimalInfeasibilities());
-              sub[iBlock].setProblemStatus(0);
-              sub[iBlock].setPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
-              sub[iBlock].setCurrentPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
-            }
-            if (sub[iBlock].isProvenOptimal()) {
+              if (!sub[iBlock].isProvenOptimal() && sub[iBlock].sumPrimalInfeasibilities() < treatSubAsFeasible) {
+                sprintf(line, "Block %d was feasible now has small infeasibility %g", iBlock,
+                  sub[iBlock].sumPrimalInfeasibilities());
+                blockPrint[iBlock].push_back(line);
+                sub[iBlock].setPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
+                sub[iBlock].setCurrentPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
+                sub[iBlock].primal();
+                sub[iBlock].setProblemStatus(0);
+                problemState[iBlock] |= 4; // force actions
+              }
+              if ((maxPass == 5000 && scalingFlag_) || (maxPass == 4000 && !scalingFlag_)) {
+                int n = sub[iBlock].numberIterations();
+                sub[iBlock].scaling(0);
+                sub[iBlock].primal();
+                sub[iBlock].setNumberIterations(n + sub[iBlock].numberIterations());
+                sub[iBlock].scaling(scalingFlag_);
+              }
+            } else if (lastStatus == 1) {
+              // zero out objective
+              double saveScale = sub[iBlock].infeasibilityCost();
+              ClpObjective *saveObjective = sub[iBlock].objectiveAsObject();
+              int numberColumns = sub[iBlock].numberColumns();
+              ClpLinearObjective fake(NULL, numberColumns);
+              sub[iBlock].setObjectivePointer(&fake);
+              int saveOptions = sub[iBlock].specialOptions();
+              sub[iBlock].setSpecialOptions(saveOptions | 8192);
               sub[iBlock].primal();
               if ((maxPass == 5000 && scalingFlag_) || (maxPass == 4000 && !scalingFlag_)) {
                 int n = sub[iBlock].numberIterations();
@@ -6952,66 +7135,81 @@ int ClpSimplex::solveBenders(CoinStructuredModel *model, ClpSolve &options)
                 sub[iBlock].setNumberIterations(n + sub[iBlock].numberIterations());
                 sub[iBlock].scaling(scalingFlag_);
               }
-              if (!sub[iBlock].isProvenOptimal()) {
-                printf("Block %d infeasible on second go has small infeasibility %g\n", iBlock,
+              sub[iBlock].setObjectivePointer(saveObjective);
+              sub[iBlock].setInfeasibilityCost(saveScale);
+              if (!sub[iBlock].isProvenOptimal() && sub[iBlock].sumPrimalInfeasibilities() < treatSubAsFeasible) {
+                sprintf(line, "Block %d was infeasible now has small infeasibility %g", iBlock,
                   sub[iBlock].sumPrimalInfeasibilities());
+                blockPrint[iBlock].push_back(line);
                 sub[iBlock].setProblemStatus(0);
+                sub[iBlock].setPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
+                sub[iBlock].setCurrentPrimalTolerance(CoinMin(treatSubAsFeasible, 1.0e-4));
               }
-              problemState[iBlock] |= 4; // force actions
-            } else {
-              printf("Block %d still infeasible - sum %g - %d iterations\n", iBlock,
-                sub[iBlock].sumPrimalInfeasibilities(),
-                sub[iBlock].numberIterations());
-              numberSubInfeasible++;
-              if (!sub[iBlock].ray()) {
-                printf("Block %d has no ray!\n", iBlock);
+              if (sub[iBlock].isProvenOptimal()) {
                 sub[iBlock].primal();
-                assert(sub[iBlock].ray()); // otherwise declare optimal
+                if ((maxPass == 5000 && scalingFlag_) || (maxPass == 4000 && !scalingFlag_)) {
+                  int n = sub[iBlock].numberIterations();
+                  sub[iBlock].scaling(0);
+                  sub[iBlock].primal();
+                  sub[iBlock].setNumberIterations(n + sub[iBlock].numberIterations());
+                  sub[iBlock].scaling(scalingFlag_);
+                }
+                if (!sub[iBlock].isProvenOptimal()) {
+                  sprintf(line, "Block %d infeasible on second go has small infeasibility %g", iBlock,
+                    sub[iBlock].sumPrimalInfeasibilities());
+                  blockPrint[iBlock].push_back(line);
+                  sub[iBlock].setProblemStatus(0);
+                }
+                problemState[iBlock] |= 4; // force actions
+              } else {
+                sprintf(line, "Block %d still infeasible - sum %g - %d iterations", iBlock,
+                  sub[iBlock].sumPrimalInfeasibilities(),
+                  sub[iBlock].numberIterations());
+                blockPrint[iBlock].push_back(line);
+                numberStillInfeasible++;
+                if (!sub[iBlock].ray()) {
+                  sprintf(line, "Block %d has no ray!", iBlock);
+                  blockPrint[iBlock].push_back(line);
+                  sub[iBlock].primal();
+                  assert(sub[iBlock].ray()); // otherwise declare optimal
+                }
               }
+              sub[iBlock].setSpecialOptions(saveOptions);
+            } else {
+              sub[iBlock].primal();
             }
-            sub[iBlock].setSpecialOptions(saveOptions);
-          } else {
-            sub[iBlock].primal();
-          }
-          sub[iBlock].setPrimalTolerance(saveTolerance);
-          sub[iBlock].setCurrentPrimalTolerance(saveTolerance);
-          if (!sub[iBlock].isProvenOptimal() && !sub[iBlock].isProvenPrimalInfeasible()) {
-            printf("!!!Block %d has bad status %d\n", iBlock, sub[iBlock].problemStatus());
-            sub[iBlock].primal(); // last go
-          }
-          //#define WRITE_ALL
+            sub[iBlock].setPrimalTolerance(saveTolerance);
+            sub[iBlock].setCurrentPrimalTolerance(saveTolerance);
+            if (!sub[iBlock].isProvenOptimal() && !sub[iBlock].isProvenPrimalInfeasible()) {
+              sprintf(line, "!!!Block %d has bad status %d", iBlock, sub[iBlock].problemStatus());
+              blockPrint[iBlock].push_back(line);
+              sub[iBlock].primal(); // last go
+            }
+            //#define WRITE_ALL
 #ifdef WRITE_ALL
-          char name[20];
-          sprintf(name, "pass_%d_block_%d.mps", iPass, iBlock);
-          sub[iBlock].writeMps(name);
-          sprintf(name, "pass_%d_block_%d.bas", iPass, iBlock);
-          sub[iBlock].writeBasis(name, true);
-          if (sub[iBlock].problemStatus() == 1) {
-            sub[iBlock].readBasis(name);
-            sub[iBlock].primal();
-          }
+            char name[20];
+            sprintf(name, "pass_%d_block_%d.mps", iPass, iBlock);
+            sub[iBlock].writeMps(name);
+            sprintf(name, "pass_%d_block_%d.bas", iPass, iBlock);
+            sub[iBlock].writeBasis(name, true);
+            if (sub[iBlock].problemStatus() == 1) {
+              sub[iBlock].readBasis(name);
+              sub[iBlock].primal();
+            }
 #endif
-          //assert (!sub[iBlock].numberIterations()||ix!=99);
-        }
+            //assert (!sub[iBlock].numberIterations()||ix!=99);
+          }
+        });
       }
-#ifdef ABC_INHERIT
-    } else {
-      int iBlock = 0;
-      while (iBlock < numberBlocks) {
-        if (sub[iBlock].secondaryStatus() != 99) {
-          int iThread;
-          threadInfo.waitParallelTask(1, iThread, true);
-#ifdef DETAIL_THREAD
-          printf("Starting block %d on thread %d\n",
-            iBlock, iThread);
-#endif
-          threadInfo.startParallelTask(1, iThread, sub + iBlock);
-        }
-        iBlock++;
+      blockGroup.wait();
+      for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
+        for (size_t i = 0; i < blockPrint[iBlock].size(); i++)
+          handler_->message(CLP_GENERAL, messages_)
+            << blockPrint[iBlock][i]
+            << CoinMessageEol;
       }
-      threadInfo.waitAllTasks();
+      numberSubInfeasible = numberStillInfeasible;
     }
-#endif
     for (iBlock = 0; iBlock < numberBlocks; iBlock++) {
       if (!iPass)
         problemState[iBlock] |= 4; // force actions
@@ -10,6 +10,8 @@
 #ifndef ClpSolve_H
 #define ClpSolve_H
 
+class ClpPresolve;
+
 /**
     This is a very simple class to guide algorithms.  It is used to tidy up
     passing parameters to initialSolve and maybe for output from that
@@ -29,6 +31,8 @@ public:
     automatic,
     tryDantzigWolfe,
     tryBenders,
+    useRace,
+    useNetwork,
     notImplemented
   };
   enum PresolveType {
@@ -103,7 +107,12 @@ public:
   void setSpecialOption(int which, int value, int extraInfo = -1);
   int getSpecialOption(int which) const;
 
-  /// Solve types
+  /** Solve types.
+      useNetwork solves a pure network (see ClpNetworkSimplex) by network
+      simplex, otherwise carries on as useDual.  This is before presolve
+      so presolve is skipped when network simplex finishes optimal.
+      It is only used when asked for - automatic never tries it.
+  */
   void setSolveType(SolveType method, int extraInfo = -1);
   SolveType getSolveType();
 
@@ -278,6 +287,27 @@ public:
   {
     return independentOptions_[type];
   }
+  /** Blocks of columns idiot sweeps at the same time (see
+      Idiot::setNumberBlocks) - default 1 */
+  inline int idiotBlocks() const
+  {
+    return idiotBlocks_;
+  }
+  inline void setIdiotBlocks(int value)
+  {
+    idiotBlocks_ = value;
+  }
+  /** Presolve kept between solves (not owned).  If set initialSolve
+      tries ClpPresolve::reusedPresolvedModel before doing a full presolve
+      and leaves what is needed for next time in it.  Default NULL */
+  inline ClpPresolve *savedPresolve() const
+  {
+    return savedPresolve_;
+  }
+  inline void setSavedPresolve(ClpPresolve *value)
+  {
+    savedPresolve_ = value;
+  }
   //@}
 
   ////////////////// data //////////////////
@@ -302,6 +332,10 @@ private:
 	 If Dantzig Wolfe/benders 0 is number blocks, 2 is #passes (notional)
      */
   int independentOptions_[3];
+  /// Blocks of columns for parallel idiot
+  int idiotBlocks_;
+  /// Presolve to reuse (not owned)
+  ClpPresolve *savedPresolve_;
   //@}
 };
 
@@ -72,6 +72,7 @@
 #include "ClpSimplexOther.hpp"
 #include "ClpSolve.hpp"
 #include "ClpSolver.hpp"
+#include "ClpThreadPool.hpp"
 
 #include "ClpModelParameters.hpp"
 #ifdef ABC_INHERIT
@@ -114,6 +115,22 @@ void printGeneralWarning(ClpSimplex &model, std::string message, int type)
 //#############################################################################
 //#############################################################################
 
+/* Number of threads for ClpThreadPool from threads parameter.  When
+   built with CLP_THREAD the parameter is the one shared with Cbc where
+   100+n, 200+n and 400+n (and -n) all mean n threads used in different
+   ways, so only n is wanted. */
+static int clpThreadsWanted(int value)
+{
+#ifdef CLP_THREAD
+  return CoinMax(1, abs(value) % 100);
+#else
+  return value;
+#endif
+}
+
+//#############################################################################
+//#############################################################################
+
 #ifdef NDEBUG
 #undef NDEBUG
 #endif
@@ -201,6 +218,7 @@ int ClpMain1(std::deque<std::string> inputQueue, AbcSimplex &model,
   int allowImportErrors = 0;
   int keepImportNames = 1;
   int doIdiot = -1;
+  int idiotBlocks = 1;
   int outputFormat = 2;
   int slpValue = -1;
   int cppValue = -1;
@@ -564,6 +582,8 @@ int ClpMain1(std::deque<std::string> inputQueue, AbcSimplex &model,
          preSolve = iValue;
       else if (paramCode == ClpParam::IDIOT)
          doIdiot = iValue;
+      else if (paramCode == ClpParam::IDIOTBLOCKS)
+         idiotBlocks = iValue;
       else if (paramCode == ClpParam::SPRINT)
          doSprint = iValue;
       else if (paramCode == ClpParam::OUTPUTFORMAT)
@@ -582,6 +602,8 @@ int ClpMain1(std::deque<std::string> inputQueue, AbcSimplex &model,
          dualize = iValue;
       else if (paramCode == ClpParam::VERBOSE)
          verbose = iValue;
+      else if (paramCode == ClpParam::THREADS)
+         ClpThreadPool::setNumberThreads(clpThreadsWanted(iValue));
 #if 0
       else if (paramCode == ClpParam::MAXFACTOR)
          model_.factorization()->maximumPivots(iValue);
@@ -839,6 +861,8 @@ int ClpMain1(std::deque<std::string> inputQueue, AbcSimplex &model,
       case ClpParam::DUALSIMPLEX:
       case ClpParam::PRIMALSIMPLEX:
       case ClpParam::EITHERSIMPLEX:
+      case ClpParam::RACE:
+      case ClpParam::NETWORKSIMPLEX:
       case ClpParam::SOLVE:
       case ClpParam::BARRIER:{
         if (!goodModel){
@@ -966,6 +990,7 @@ int ClpMain1(std::deque<std::string> inputQueue, AbcSimplex &model,
           presolveOptions |= 32768;
           solveOptions.setPresolveActions(presolveOptions);
           solveOptions.setSubstitution(substitution);
+          solveOptions.setIdiotBlocks(idiotBlocks);
           if (preSolve != DEFAULT_PRESOLVE_PASSES && preSolve) {
             presolveType = ClpSolve::presolveNumber;
             if (preSolve < 0) {
@@ -993,6 +1018,10 @@ int ClpMain1(std::deque<std::string> inputQueue, AbcSimplex &model,
             method = ClpSolve::useDual;
           } else if (paramCode == ClpParam::PRIMALSIMPLEX) {
             method = ClpSolve::usePrimalorSprint;
+          } else if (paramCode == ClpParam::RACE) {
+            method = ClpSolve::useRace;
+          } else if (paramCode == ClpParam::NETWORKSIMPLEX) {
+            method = ClpSolve::useNetwork;
           } else if (paramCode == ClpParam::EITHERSIMPLEX) {
             method = ClpSolve::automatic;
             if (doCrash > 6) {
@@ -2012,6 +2041,7 @@ int ClpMain1(std::deque<std::string> inputQueue, AbcSimplex &model,
           presolveType = ClpSolve::presolveOff;
         }
         solveOptions.setPresolveType(presolveType, 5);
+        solveOptions.setIdiotBlocks(idiotBlocks);
         if (doSprint >= 0 || doIdiot >= 0) {
           if (doSprint > 0) {
             // sprint overrides idiot
@@ -2070,6 +2100,19 @@ int ClpMain1(std::deque<std::string> inputQueue, AbcSimplex &model,
                  doVector != 0);
 #endif
         } break;
+      case ClpParam::BENCHMARK: {
+        if (status = param->readValue(inputQueue, field, &message)){
+          printGeneralMessage(model_, message);
+          continue;
+        }
+        ClpSolve solveOptions;
+        if (preSolve)
+          solveOptions.setPresolveType(ClpSolve::presolveOn, 5);
+        else
+          solveOptions.setPresolveType(ClpSolve::presolveOff);
+        mainBenchmark(field, parameters[ClpParam::DIRNETLIB]->dirName(),
+                      solveOptions);
+      } break;
       case ClpParam::UNITTEST: {
         // create fields for unitTest
         const char *fields[2];
@@ -2167,7 +2210,8 @@ int ClpMain1(std::deque<std::string> inputQueue, AbcSimplex &model,
 Dual steepest edge steep/partial on matrix shape and factorization density\n\
 Clpnnnn taken out of messages\n\
 If Factorization frequency default then done on size of matrix\n\n\
-(-)unitTest, (-)netlib or (-)netlibp will do standard tests\n\n\
+(-)unitTest, (-)netlib or (-)netlibp will do standard tests\n\
+(-)benchmark small,output=name will time netlib models\n\n\
 You can switch to interactive mode at any time so\n\
 clp watson.mps -scaling off -primalsimplex\nis the same as\n\
 clp watson.mps -\nscaling off\nprimalsimplex");
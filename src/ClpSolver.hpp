@@ -66,6 +66,9 @@ int mainTest(int argc, const char *argv[], int algorithm,
 int mainTest(int argc, const char *argv[], int algorithm,
   AbcSimplex empty, ClpSolve solveOptions, int switchOff, bool doVector);
 #endif
+/// Benchmark netlib instances - see unitTest.cpp for spec
+int mainBenchmark(const std::string &spec, const std::string &dirNetlib,
+  ClpSolve solveOptions);
 
 #ifndef ABC_INHERIT
 CLPLIB_EXPORT
@@ -0,0 +1,203 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+
+#include "ClpThreadPool.hpp"
+
+// Pool shared by everything in the process
+static std::atomic< ClpThreadPool * > clpPool(static_cast< ClpThreadPool * >(NULL));
+static std::mutex clpPoolMutex;
+static int clpWantedThreads = 1;
+// Index of worker (0 if not a worker of any pool)
+static thread_local int clpThreadIndex = 0;
+// Pool the current thread is a worker of (NULL if none)
+static thread_local ClpThreadPool *clpThreadPool = NULL;
+
+ClpThreadPool *
+ClpThreadPool::pool()
+{
+  ClpThreadPool *pool = clpPool.load(std::memory_order_acquire);
+  if (!pool) {
+    std::lock_guard< std::mutex > lock(clpPoolMutex);
+    pool = clpPool.load(std::memory_order_relaxed);
+    if (!pool) {
+      pool = new ClpThreadPool(clpWantedThreads);
+      clpPool.store(pool, std::memory_order_release);
+    }
+  }
+  return pool;
+}
+void ClpThreadPool::setNumberThreads(int numberThreads)
+{
+  if (numberThreads <= 0) {
+    numberThreads = static_cast< int >(std::thread::hardware_concurrency());
+    if (numberThreads <= 0)
+      numberThreads = 1;
+  }
+  std::lock_guard< std::mutex > lock(clpPoolMutex);
+  clpWantedThreads = numberThreads;
+  ClpThreadPool *pool = clpPool.load(std::memory_order_relaxed);
+  if (pool && pool->numberThreads() != numberThreads) {
+    clpPool.store(NULL, std::memory_order_release);
+    delete pool;
+  }
+}
+int ClpThreadPool::wantedNumberThreads()
+{
+  std::lock_guard< std::mutex > lock(clpPoolMutex);
+  return clpWantedThreads;
+}
+int ClpThreadPool::threadIndex()
+{
+  return clpThreadIndex;
+}
+//-------------------------------------------------------------------
+// Constructor
+//-------------------------------------------------------------------
+ClpThreadPool::ClpThreadPool(int numberThreads)
+  : numberThreads_(numberThreads > 1 ? numberThreads : 1)
+  , queues_(NULL)
+  , numberQueued_(0)
+  , stop_(false)
+  , numberWaiting_(0)
+{
+  queues_ = new Queue[numberThreads_];
+  workers_.reserve(numberThreads_ - 1);
+  for (int i = 1; i < numberThreads_; i++)
+    workers_.push_back(std::thread(&ClpThreadPool::workerLoop, this, i));
+}
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+ClpThreadPool::~ClpThreadPool()
+{
+  {
+    std::lock_guard< std::mutex > lock(wakeMutex_);
+    stop_.store(true);
+  }
+  wakeCondition_.notify_all();
+  for (size_t i = 0; i < workers_.size(); i++)
+    workers_[i].join();
+  // Nothing should be left but do not leak if it is
+  for (int i = 0; i < numberThreads_; i++) {
+    for (size_t j = 0; j < queues_[i].tasks.size(); j++)
+      delete queues_[i].tasks[j];
+  }
+  delete[] queues_;
+}
+void ClpThreadPool::push(ClpTaskGroup *group, std::function< void() > &&function)
+{
+  Task *task = new Task;
+  task->function = std::move(function);
+  task->group = group;
+  // workers of another pool use the shared deque
+  int which = clpThreadPool == this ? clpThreadIndex : 0;
+  {
+    std::lock_guard< std::mutex > lock(queues_[which].mutex);
+    queues_[which].tasks.push_back(task);
+  }
+  bool anyWaiting;
+  {
+    std::lock_guard< std::mutex > lock(wakeMutex_);
+    numberQueued_.fetch_add(1);
+    anyWaiting = numberWaiting_ > 0;
+  }
+  wakeCondition_.notify_one();
+  if (anyWaiting)
+    doneCondition_.notify_all();
+}
+ClpThreadPool::Task *
+ClpThreadPool::popTask(int whichThread)
+{
+  Task *task = NULL;
+  {
+    // own work - newest first
+    Queue &queue = queues_[whichThread];
+    std::lock_guard< std::mutex > lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      task = queue.tasks.back();
+      queue.tasks.pop_back();
+    }
+  }
+  for (int i = 1; !task && i < numberThreads_; i++) {
+    // steal - oldest first as that is likely to be biggest
+    Queue &queue = queues_[(whichThread + i) % numberThreads_];
+    std::lock_guard< std::mutex > lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      task = queue.tasks.front();
+      queue.tasks.pop_front();
+    }
+  }
+  if (task)
+    numberQueued_.fetch_sub(1);
+  return task;
+}
+void ClpThreadPool::runTask(Task *task)
+{
+  ClpTaskGroup *group = task->group;
+  task->function();
+  delete task;
+  // group may go away as soon as count reaches zero - do not touch it after
+  if (group->numberActive_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    std::lock_guard< std::mutex > lock(wakeMutex_);
+    if (numberWaiting_)
+      doneCondition_.notify_all();
+  }
+}
+bool ClpThreadPool::runPendingTask()
+{
+  int which = clpThreadPool == this ? clpThreadIndex : 0;
+  Task *task = popTask(which);
+  if (!task)
+    return false;
+  runTask(task);
+  return true;
+}
+void ClpThreadPool::workerLoop(int whichThread)
+{
+  clpThreadIndex = whichThread;
+  clpThreadPool = this;
+  while (!stop_.load()) {
+    Task *task = popTask(whichThread);
+    if (task) {
+      runTask(task);
+    } else {
+      std::unique_lock< std::mutex > lock(wakeMutex_);
+      while (!stop_.load() && numberQueued_.load() <= 0)
+        wakeCondition_.wait(lock);
+    }
+  }
+}
+void ClpThreadPool::waitForWork(const ClpTaskGroup *group)
+{
+  std::unique_lock< std::mutex > lock(wakeMutex_);
+  numberWaiting_++;
+  while (group->numberActive_.load(std::memory_order_acquire) > 0
+    && numberQueued_.load() <= 0)
+    doneCondition_.wait(lock);
+  numberWaiting_--;
+}
+//-------------------------------------------------------------------
+// Task group
+//-------------------------------------------------------------------
+ClpTaskGroup::ClpTaskGroup(ClpThreadPool *pool)
+  : pool_(pool ? pool : ClpThreadPool::pool())
+  , numberActive_(0)
+{
+}
+ClpTaskGroup::~ClpTaskGroup()
+{
+  wait();
+}
+void ClpTaskGroup::wait()
+{
+  while (numberActive_.load(std::memory_order_acquire) > 0) {
+    // help if possible - otherwise sleep until something changes
+    if (!pool_->runPendingTask())
+      pool_->waitForWork(this);
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
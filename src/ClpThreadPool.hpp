@@ -0,0 +1,257 @@
+// Copyright (C) 2026, COIN-OR Foundation and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef ClpThreadPool_H
+#define ClpThreadPool_H
+
+#include "ClpConfig.h"
+
+#include <atomic>
+#include <cstddef>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ClpTaskGroup;
+
+/** Work-stealing task pool for the parallel parts of Clp
+
+This replaces the cilk runtime the Abc code was written against, using
+nothing beyond std::thread.  Each worker thread owns a deque of tasks.
+A worker pushes and pops its own tasks at the back, so nested spawns run
+depth first as they would with cilk, and when its deque is empty it
+steals from the front of another deque.  Threads which are not workers
+(normally the thread which called the solver) share one extra deque.
+
+A thread waiting on a ClpTaskGroup runs pending tasks while there are
+any, so recursive spawn/wait can not deadlock however few threads
+there are.  Once there is nothing it can steal it sleeps until its
+tasks finish or more work is queued.
+
+With one thread (the default) no workers are created and a task is run
+as soon as it is spawned, so the behaviour is exactly that of the serial
+code.  The number of threads is a process wide setting -
+see setNumberThreads().
+*/
+
+class CLPLIB_EXPORT ClpThreadPool {
+
+public:
+  /**@name Process wide pool */
+  //@{
+  /// Pool used by Clp (created on first use)
+  static ClpThreadPool *pool();
+  /** Set number of threads (including the calling thread) for pool().
+      0 means one per hardware thread.  Any existing pool is shut down
+      so this must not be called while tasks are running.
+  */
+  static void setNumberThreads(int numberThreads);
+  /// Number of threads pool() has or will have (including caller)
+  static int wantedNumberThreads();
+  /** Index of current thread - 0 for any thread which is not a worker,
+      1 to numberThreads()-1 for workers.  Useful for per thread scratch.
+  */
+  static int threadIndex();
+  //@}
+
+  /**@name Constructors and destructor */
+  //@{
+  /// Create pool with numberThreads-1 workers
+  explicit ClpThreadPool(int numberThreads);
+  /// Stops and joins workers
+  ~ClpThreadPool();
+  //@}
+
+  /**@name Gets and running tasks */
+  //@{
+  /// Number of threads (including caller)
+  inline int numberThreads() const
+  {
+    return numberThreads_;
+  }
+  /// True if spawned tasks are just run inline
+  inline bool serial() const
+  {
+    return numberThreads_ <= 1;
+  }
+  /// Queue a task belonging to group
+  void push(ClpTaskGroup *group, std::function< void() > &&function);
+  /// Run one queued task if there is one - returns true if a task was run
+  bool runPendingTask();
+  //@}
+
+private:
+  friend class ClpTaskGroup;
+  /// A queued task
+  struct Task {
+    std::function< void() > function;
+    ClpTaskGroup *group;
+  };
+  /// One deque of tasks
+  struct Queue {
+    std::mutex mutex;
+    std::deque< Task * > tasks;
+  };
+  /// Take a task for thread whichThread (own back first then steal)
+  Task *popTask(int whichThread);
+  /// Run task and tell group
+  void runTask(Task *task);
+  /// Worker main loop
+  void workerLoop(int whichThread);
+  /// Sleep until group has finished or there may be a task to run
+  void waitForWork(const ClpTaskGroup *group);
+
+  /// Disable copy
+  ClpThreadPool(const ClpThreadPool &);
+  ClpThreadPool &operator=(const ClpThreadPool &);
+
+  /**@name Data */
+  //@{
+  /// Number of threads including caller
+  int numberThreads_;
+  /// Deques - 0 is shared by non workers
+  Queue *queues_;
+  /// Worker threads
+  std::vector< std::thread > workers_;
+  /// Number of queued tasks (may be briefly negative)
+  std::atomic< int > numberQueued_;
+  /// Set when shutting down
+  std::atomic< bool > stop_;
+  /// For sleeping workers (and waiters)
+  std::mutex wakeMutex_;
+  std::condition_variable wakeCondition_;
+  /// For sleeping waiters - woken when a group finishes or work is queued
+  std::condition_variable doneCondition_;
+  /// Number of threads in waitForWork (protected by wakeMutex_)
+  int numberWaiting_;
+  //@}
+};
+
+/** A set of tasks which can be waited for - the cilk_spawn/cilk_sync pair
+
+    spawn() queues a task (or just runs it if the pool is serial) and
+    wait() returns when all tasks spawned by this group have finished,
+    running other pending work meanwhile and sleeping when there is none.  The destructor waits, so
+    lambdas may safely capture locals by reference.
+*/
+class CLPLIB_EXPORT ClpTaskGroup {
+
+public:
+  /// Default uses ClpThreadPool::pool()
+  ClpTaskGroup(ClpThreadPool *pool = NULL);
+  /// Waits for outstanding tasks
+  ~ClpTaskGroup();
+  /// Run function as a task
+  template < class Function >
+  inline void spawn(Function function)
+  {
+    if (pool_->serial()) {
+      function();
+    } else {
+      numberActive_.fetch_add(1, std::memory_order_relaxed);
+      pool_->push(this, std::function< void() >(function));
+    }
+  }
+  /// Wait for all spawned tasks
+  void wait();
+  /// Pool used
+  inline ClpThreadPool *pool() const
+  {
+    return pool_;
+  }
+
+private:
+  friend class ClpThreadPool;
+  /// Disable copy
+  ClpTaskGroup(const ClpTaskGroup &);
+  ClpTaskGroup &operator=(const ClpTaskGroup &);
+  /// Pool
+  ClpThreadPool *pool_;
+  /// Tasks spawned and not finished
+  std::atomic< int > numberActive_;
+};
+
+/** Run first as a task and second on this thread, then wait for both.
+    This is the "cilk_spawn first(); second(); cilk_sync;" idiom.
+*/
+template < class First, class Second >
+inline void clpParallelInvoke(First first, Second second)
+{
+  ClpTaskGroup group;
+  group.spawn(first);
+  second();
+  group.wait();
+}
+
+/** Call function(start,end) over [first,last) in chunks of at least grain.
+    Chunk boundaries depend only on numberChunks (default one per thread)
+    so callers wanting results independent of the number of threads
+    should pass it.
+*/
+template < class Function >
+inline void clpParallelFor(int first, int last, int grain, Function function,
+  int numberChunks = 0)
+{
+  int n = last - first;
+  if (n <= 0)
+    return;
+  ClpThreadPool *pool = ClpThreadPool::pool();
+  if (!numberChunks)
+    numberChunks = pool->numberThreads();
+  if (grain < 1)
+    grain = 1;
+  if (numberChunks > (n + grain - 1) / grain)
+    numberChunks = (n + grain - 1) / grain;
+  if (numberChunks <= 1) {
+    function(first, last);
+    return;
+  }
+  ClpTaskGroup group(pool);
+  int chunk = n / numberChunks;
+  int extra = n - chunk * numberChunks;
+  int start = first;
+  for (int i = 0; i < numberChunks; i++) {
+    int end = start + chunk + (i < extra ? 1 : 0);
+    if (i < numberChunks - 1) {
+      group.spawn([=, &function]() { function(start, end); });
+    } else {
+      function(start, end);
+    }
+    start = end;
+  }
+  group.wait();
+}
+
+/** Call function(i) for i in [0,numberTasks) with up to numberThreads
+    running at once.  pool() is used if it has that many threads, if not
+    a private pool lives for the length of the call - pool() is never
+    resized as others may be using it.  function(0) runs on this thread.
+*/
+template < class Function >
+inline void clpParallelTasks(int numberTasks, int numberThreads, Function function)
+{
+  if (numberTasks <= 0)
+    return;
+  ClpThreadPool *pool = ClpThreadPool::pool();
+  ClpThreadPool *privatePool = NULL;
+  if (numberTasks > 1 && numberThreads > pool->numberThreads()) {
+    privatePool = new ClpThreadPool(numberThreads < numberTasks ? numberThreads : numberTasks);
+    pool = privatePool;
+  }
+  {
+    ClpTaskGroup group(pool);
+    for (int i = 1; i < numberTasks; i++)
+      group.spawn([=, &function]() { function(i); });
+    function(0);
+    group.wait();
+  }
+  delete privatePool;
+}
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
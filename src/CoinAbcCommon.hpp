@@ -37,12 +37,18 @@ typedef unsigned int CoinSimplexUnsignedInt;
 #endif
 #if ABC_PARALLEL == 2
 //#define EARLY_FACTORIZE
+/* Task parallelism comes from ClpThreadPool (ClpTaskGroup etc).
+   Any cilk keywords left in the code just run serially. */
+#include "ClpThreadPool.hpp"
 #ifndef FAKE_CILK
-#include <cilk/cilk.h>
-#else
+#define FAKE_CILK
+#endif
 #define cilk_for for
 #define cilk_spawn
 #define cilk_sync
+// below this many entries a split is not worth a task
+#ifndef ABC_PARALLEL_GRAIN
+#define ABC_PARALLEL_GRAIN 256
 #endif
 #else
 #define cilk_for for
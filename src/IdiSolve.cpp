@@ -9,6 +9,9 @@
 #include <math.h>
 #include "CoinHelperFunctions.hpp"
 #include "Idiot.hpp"
+#ifndef OSI_IDIOT
+#include "ClpThreadPool.hpp"
+#endif
 #define FIT
 #ifdef FIT
 #define HISTORY 8
@@ -68,6 +71,143 @@ static void solveSmall(int nsolve, double **aIn, double **a, double *b)
     b[i] = value;
   }
 }
+// Most blocks in parallel sweep
+#define IDIOT_MAX_BLOCKS 64
+// Fewest columns in a block
+#define IDIOT_BLOCK_COLUMNS 1000
+// What one block of columns changes in a minor iteration
+typedef struct {
+  double *pi;
+  double *rowsol;
+  double step; /* fraction of each move made in colsol */
+  double maxDj;
+  double objvalue;
+  double kgood;
+  double kbad;
+  int nChange;
+  int nflagged;
+} IdiotSweep;
+/* Moves each free column from istart to istop (not included) in turn
+   to minimize weighted objective keeping others fixed.  pi and rowsol
+   see whole move but colsol and objvalue only step times it, so when
+   several blocks are averaged colsol still agrees with rowsol. */
+static void idiotSweep(int istart, int istop, int direction,
+  const double *COIN_RESTRICT cost, double *COIN_RESTRICT colsol,
+  const double *COIN_RESTRICT lower, const double *COIN_RESTRICT upper,
+  const double *COIN_RESTRICT elemnt, const int *COIN_RESTRICT row,
+  const CoinBigIndex *COIN_RESTRICT columnStart, const int *COIN_RESTRICT length,
+  char *COIN_RESTRICT statusWork, double weight, double djTol, double djFlag,
+  int strategy, IdiotSweep &sweep)
+{
+  double *COIN_RESTRICT pi = sweep.pi;
+  double *COIN_RESTRICT rowsol = sweep.rowsol;
+  for (int icol = istart; icol != istop; icol += direction) {
+    if (!statusWork[icol]) {
+      CoinBigIndex j;
+      double value = colsol[icol];
+      double djval = cost[icol];
+      double djval2, value2;
+      double theta, a, b;
+      if (elemnt) {
+        for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
+          int irow = row[j];
+          djval -= elemnt[j] * pi[irow];
+        }
+      } else {
+        for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
+          int irow = row[j];
+          djval -= pi[irow];
+        }
+      }
+      if (djval > 1.0e-5) {
+        value2 = (lower[icol] - value);
+      } else {
+        value2 = (upper[icol] - value);
+      }
+      djval2 = djval * value2;
+      djval = fabs(djval);
+      if (djval > djTol) {
+        if (djval2 < -1.0e-4) {
+          sweep.nChange++;
+          if (djval > sweep.maxDj)
+            sweep.maxDj = djval;
+          a = 0.0;
+          b = 0.0;
+          djval2 = cost[icol];
+          if (elemnt) {
+            for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
+              int irow = row[j];
+              double value = rowsol[irow];
+              a += elemnt[j] * elemnt[j];
+              b += value * elemnt[j];
+            }
+          } else {
+            for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
+              int irow = row[j];
+              double value = rowsol[irow];
+              a += 1.0;
+              b += value;
+            }
+          }
+          a *= weight;
+          b = b * weight + 0.5 * djval2;
+          /* solve */
+          theta = -b / a;
+          if ((strategy & 4) != 0) {
+            double valuep, thetap;
+            value2 = a * theta * theta + 2.0 * b * theta;
+            thetap = 2.0 * theta;
+            valuep = a * thetap * thetap + 2.0 * b * thetap;
+            if (valuep < value2 + djTol) {
+              theta = thetap;
+              sweep.kgood++;
+            } else {
+              sweep.kbad++;
+            }
+          }
+          if (theta > 0.0) {
+            if (theta < upper[icol] - colsol[icol]) {
+              value2 = theta;
+            } else {
+              value2 = upper[icol] - colsol[icol];
+            }
+          } else {
+            if (theta > lower[icol] - colsol[icol]) {
+              value2 = theta;
+            } else {
+              value2 = lower[icol] - colsol[icol];
+            }
+          }
+          colsol[icol] += value2 * sweep.step;
+          sweep.objvalue += cost[icol] * value2 * sweep.step;
+          if (elemnt) {
+            for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
+              int irow = row[j];
+              double value;
+              rowsol[irow] += elemnt[j] * value2;
+              value = rowsol[irow];
+              pi[irow] = -2.0 * weight * value;
+            }
+          } else {
+            for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
+              int irow = row[j];
+              double value;
+              rowsol[irow] += value2;
+              value = rowsol[irow];
+              pi[irow] = -2.0 * weight * value;
+            }
+          }
+        } else {
+          /* dj but at bound */
+          if (djval > djFlag) {
+            statusWork[icol] = 1;
+            sweep.nflagged++;
+          }
+        }
+      }
+    }
+  }
+}
 IdiotResult
 Idiot::objval(int nrows, int ncols, double *rowsol, double *colsol,
   double *pi, double * /*djs*/, const double *cost,
@@ -166,7 +306,7 @@ Idiot::IdiSolve(
 #else
   int nsolve = NSOLVE + 1; /* allow for null vector */
 #endif
-  int nflagged;
+  int nflagged = 0;
   double *COIN_RESTRICT thetaX;
   double *COIN_RESTRICT djX;
   double *COIN_RESTRICT bX;
@@ -198,25 +338,25 @@ Idiot::IdiSolve(
   for (i = 0; i < DROP; i++) {
     obj[i] = 1.0e70;
   }
-  //#define FOUR_GOES 2
-#ifdef FOUR_GOES
-  double *COIN_RESTRICT pi2 = new double[3 * nrows];
-  double *COIN_RESTRICT rowsol2 = new double[3 * nrows];
-  double *COIN_RESTRICT piX[4];
-  double *COIN_RESTRICT rowsolX[4];
-  int startsX[2][5];
-  int nChangeX[4];
-  double maxDjX[4];
-  double objvalueX[4];
-  int nflaggedX[4];
-  piX[0] = pi;
-  piX[1] = pi2;
-  piX[2] = pi2 + nrows;
-  piX[3] = piX[2] + nrows;
-  rowsolX[0] = rowsol;
-  rowsolX[1] = rowsol2;
-  rowsolX[2] = rowsol2 + nrows;
-  rowsolX[3] = rowsolX[2] + nrows;
+  // blocks of columns swept in parallel - first block uses pi and rowsol
+  int numberBlocks = 1;
+  IdiotSweep sweepX[IDIOT_MAX_BLOCKS];
+  int startsX[2][IDIOT_MAX_BLOCKS + 1];
+  double *COIN_RESTRICT blockWork = NULL;
+#ifndef OSI_IDIOT
+  numberBlocks = CoinMin(CoinMin(numberBlocks_, IDIOT_MAX_BLOCKS),
+    ncols / IDIOT_BLOCK_COLUMNS);
+  if (numberBlocks > 1) {
+    blockWork = new double[2 * (numberBlocks - 1) * nrows];
+    sweepX[0].pi = pi;
+    sweepX[0].rowsol = rowsol;
+    for (int iBlock = 1; iBlock < numberBlocks; iBlock++) {
+      sweepX[iBlock].pi = blockWork + 2 * (iBlock - 1) * nrows;
+      sweepX[iBlock].rowsol = sweepX[iBlock].pi + nrows;
+    }
+  } else {
+    numberBlocks = 1;
+  }
 #endif
   allsum = new double *[nsolve];
   aX = new double *[nsolve];
@@ -417,27 +557,27 @@ Idiot::IdiSolve(
         stop[0] = ncols;
         start[1] = 0;
         stop[1] = kcol;
-#ifdef FOUR_GOES
-        for (int itry = 0; itry < 2; itry++) {
-          int chunk = (stop[itry] - start[itry] + FOUR_GOES - 1) / FOUR_GOES;
-          startsX[itry][0] = start[itry];
-          for (int i = 1; i < 5; i++)
-            startsX[itry][i] = CoinMin(stop[itry], startsX[itry][i - 1] + chunk);
+        if (numberBlocks > 1) {
+          for (int itry = 0; itry < 2; itry++) {
+            int chunk = (stop[itry] - start[itry] + numberBlocks - 1) / numberBlocks;
+            startsX[itry][0] = start[itry];
+            for (int i = 1; i <= numberBlocks; i++)
+              startsX[itry][i] = CoinMin(stop[itry], startsX[itry][i - 1] + chunk);
+          }
         }
-#endif
       } else {
         start[0] = kcol;
         stop[0] = -1;
         start[1] = ncols - 1;
         stop[1] = kcol;
-#ifdef FOUR_GOES
-        for (int itry = 0; itry < 2; itry++) {
-          int chunk = (start[itry] - stop[itry] + FOUR_GOES - 1) / FOUR_GOES;
-          startsX[itry][0] = start[itry];
-          for (int i = 1; i < 5; i++)
-            startsX[itry][i] = CoinMax(stop[itry], startsX[itry][i - 1] - chunk);
+        if (numberBlocks > 1) {
+          for (int itry = 0; itry < 2; itry++) {
+            int chunk = (start[itry] - stop[itry] + numberBlocks - 1) / numberBlocks;
+            startsX[itry][0] = start[itry];
+            for (int i = 1; i <= numberBlocks; i++)
+              startsX[itry][i] = CoinMax(stop[itry], startsX[itry][i - 1] - chunk);
+          }
         }
-#endif
       }
       int itry = 0;
       /*if ((strategy&16)==0) {
@@ -941,204 +1081,85 @@ Idiot::IdiSolve(
     doFull = 0;
     maxDj = 0.0;
     // go through forwards or backwards and starting at odd places
-#ifdef FOUR_GOES
-    for (int i = 1; i < FOUR_GOES; i++) {
-      cilk_spawn memcpy(piX[i], pi, nrows * sizeof(double));
-      cilk_spawn memcpy(rowsolX[i], rowsol, nrows * sizeof(double));
-    }
-    for (int i = 0; i < FOUR_GOES; i++) {
-      nChangeX[i] = 0;
-      maxDjX[i] = 0.0;
-      objvalueX[i] = 0.0;
-      nflaggedX[i] = 0;
-    }
-    cilk_sync;
-#endif
-    //printf("PASS\n");
-#ifdef FOUR_GOES
-    cilk_for(int iPar = 0; iPar < FOUR_GOES; iPar++)
-    {
-      double *COIN_RESTRICT pi = piX[iPar];
-      double *COIN_RESTRICT rowsol = rowsolX[iPar];
-      for (int itry = 0; itry < 2; itry++) {
-        int istop;
-        int istart;
-#if 0
-		    int chunk = (start[itry]+stop[itry]+FOUR_GOES-1)/FOUR_GOES;
-                    if (iPar == 0) {
-		      istart=start[itry];
-		      istop=(start[itry]+stop[itry])>>1;
-                    } else {
-		      istart=(start[itry]+stop[itry])>>1;
-		      istop = stop[itry];
-                    }
-#endif
-#if 0
-		    printf("istart %d istop %d direction %d array %d %d new %d %d\n",
-		    	   istart,istop,direction,start[itry],stop[itry],
-		    	   startsX[itry][iPar],startsX[itry][iPar+1]);
-#endif
-        istart = startsX[itry][iPar];
-        istop = startsX[itry][iPar + 1];
-#else
-    for (int itry = 0; itry < 2; itry++) {
-      int istart = start[itry];
-      int istop = stop[itry];
-#endif
-        for (int icol = istart; icol != istop; icol += direction) {
-          if (!statusWork[icol]) {
-            CoinBigIndex j;
-            double value = colsol[icol];
-            double djval = cost[icol];
-            double djval2, value2;
-            double theta, a, b, c;
-            if (elemnt) {
-              for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
-                int irow = row[j];
-                djval -= elemnt[j] * pi[irow];
-              }
-            } else {
-              for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
-                int irow = row[j];
-                djval -= pi[irow];
-              }
-            }
-            /*printf("xx iter %d seq %d djval %g value %g\n",
-                                iter,i,djval,value);*/
-            if (djval > 1.0e-5) {
-              value2 = (lower[icol] - value);
-            } else {
-              value2 = (upper[icol] - value);
-            }
-            djval2 = djval * value2;
-            djval = fabs(djval);
-            if (djval > djTol) {
-              if (djval2 < -1.0e-4) {
-#ifndef FOUR_GOES
-                nChange++;
-                if (djval > maxDj)
-                  maxDj = djval;
-#else
-              nChangeX[iPar]++;
-              if (djval > maxDjX[iPar])
-                maxDjX[iPar] = djval;
-#endif
-                /*if (djval>3.55e6) {
-                                        		printf("big\n");
-                                        		}*/
-                a = 0.0;
-                b = 0.0;
-                c = 0.0;
-                djval2 = cost[icol];
-                if (elemnt) {
-                  for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
-                    int irow = row[j];
-                    double value = rowsol[irow];
-                    c += value * value;
-                    a += elemnt[j] * elemnt[j];
-                    b += value * elemnt[j];
-                  }
-                } else {
-                  for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
-                    int irow = row[j];
-                    double value = rowsol[irow];
-                    c += value * value;
-                    a += 1.0;
-                    b += value;
-                  }
-                }
-                a *= weight;
-                b = b * weight + 0.5 * djval2;
-                c *= weight;
-                /* solve */
-                theta = -b / a;
-#ifndef FOUR_GOES
-                if ((strategy & 4) != 0) {
-                  double valuep, thetap;
-                  value2 = a * theta * theta + 2.0 * b * theta;
-                  thetap = 2.0 * theta;
-                  valuep = a * thetap * thetap + 2.0 * b * thetap;
-                  if (valuep < value2 + djTol) {
-                    theta = thetap;
-                    kgood++;
-                  } else {
-                    kbad++;
-                  }
-                }
-#endif
-                if (theta > 0.0) {
-                  if (theta < upper[icol] - colsol[icol]) {
-                    value2 = theta;
-                  } else {
-                    value2 = upper[icol] - colsol[icol];
-                  }
-                } else {
-                  if (theta > lower[icol] - colsol[icol]) {
-                    value2 = theta;
-                  } else {
-                    value2 = lower[icol] - colsol[icol];
-                  }
-                }
-                colsol[icol] += value2;
-#ifndef FOUR_GOES
-                objvalue += cost[icol] * value2;
-#else
-              objvalueX[iPar] += cost[icol] * value2;
-#endif
-                if (elemnt) {
-                  for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
-                    int irow = row[j];
-                    double value;
-                    rowsol[irow] += elemnt[j] * value2;
-                    value = rowsol[irow];
-                    pi[irow] = -2.0 * weight * value;
-                  }
-                } else {
-                  for (j = columnStart[icol]; j < columnStart[icol] + length[icol]; j++) {
-                    int irow = row[j];
-                    double value;
-                    rowsol[irow] += value2;
-                    value = rowsol[irow];
-                    pi[irow] = -2.0 * weight * value;
-                  }
-                }
-              } else {
-                /* dj but at bound */
-                if (djval > djFlag) {
-                  statusWork[icol] = 1;
-#ifndef FOUR_GOES
-                  nflagged++;
-#else
-                nflaggedX[iPar]++;
-#endif
-                }
-              }
-            }
+#ifndef OSI_IDIOT
+    if (numberBlocks > 1) {
+      /* Each block sweeps its share of both ranges against its own copy
+         of pi and rowsol.  Copies are then averaged in block order and
+         each column makes 1/numberBlocks of its move - so new point is
+         average of block points (no worse than old) and result only
+         depends on numberBlocks. */
+      clpParallelFor(0, numberBlocks, 1, [&](int first, int last) {
+        for (int iBlock = first; iBlock < last; iBlock++) {
+          IdiotSweep &block = sweepX[iBlock];
+          if (iBlock) {
+            CoinMemcpyN(pi, nrows, block.pi);
+            CoinMemcpyN(rowsol, nrows, block.rowsol);
           }
+          block.step = 1.0 / numberBlocks;
+          block.maxDj = 0.0;
+          block.objvalue = 0.0;
+          block.kgood = 0.0;
+          block.kbad = 0.0;
+          block.nChange = 0;
+          block.nflagged = 0;
         }
-#ifdef FOUR_GOES
+      },
+        numberBlocks);
+      // block 0 works in place so must wait for copies
+      clpParallelFor(0, numberBlocks, 1, [&](int first, int last) {
+        for (int iBlock = first; iBlock < last; iBlock++) {
+          for (int itry = 0; itry < 2; itry++)
+            idiotSweep(startsX[itry][iBlock], startsX[itry][iBlock + 1], direction,
+              cost, colsol, lower, upper, elemnt, row, columnStart, length,
+              statusWork, weight, djTol, djFlag, strategy, sweepX[iBlock]);
+        }
+      },
+        numberBlocks);
+      for (int iBlock = 0; iBlock < numberBlocks; iBlock++) {
+        const IdiotSweep &block = sweepX[iBlock];
+        nChange += block.nChange;
+        maxDj = CoinMax(maxDj, block.maxDj);
+        objvalue += block.objvalue;
+        nflagged += block.nflagged;
+        kgood += block.kgood;
+        kbad += block.kbad;
       }
+      double scale = 1.0 / numberBlocks;
+      clpParallelFor(0, nrows, 4096, [&](int first, int last) {
+        for (int i = first; i < last; i++) {
+          double sumPi = pi[i];
+          double sumRow = rowsol[i];
+          for (int iBlock = 1; iBlock < numberBlocks; iBlock++) {
+            sumPi += sweepX[iBlock].pi[i];
+            sumRow += sweepX[iBlock].rowsol[i];
+          }
+          pi[i] = sumPi * scale;
+          rowsol[i] = sumRow * scale;
+        }
+      });
+    } else {
 #endif
-    }
-#ifdef FOUR_GOES
-    for (int i = 0; i < FOUR_GOES; i++) {
-      nChange += nChangeX[i];
-      maxDj = CoinMax(maxDj, maxDjX[i]);
-      objvalue += objvalueX[i];
-      nflagged += nflaggedX[i];
-    }
-    cilk_for(int i = 0; i < nrows; i++)
-    {
-#if FOUR_GOES == 2
-      rowsol[i] = 0.5 * (rowsolX[0][i] + rowsolX[1][i]);
-      pi[i] = 0.5 * (piX[0][i] + piX[1][i]);
-#elif FOUR_GOES == 3
-      pi[i] = 0.33333333333333 * (piX[0][i] + piX[1][i] + piX[2][i]);
-      rowsol[i] = 0.3333333333333 * (rowsolX[0][i] + rowsolX[1][i] + rowsolX[2][i]);
-#else
-      pi[i] = 0.25 * (piX[0][i] + piX[1][i] + piX[2][i] + piX[3][i]);
-      rowsol[i] = 0.25 * (rowsolX[0][i] + rowsolX[1][i] + rowsolX[2][i] + rowsolX[3][i]);
-#endif
+      IdiotSweep sweep;
+      sweep.pi = pi;
+      sweep.rowsol = rowsol;
+      sweep.step = 1.0;
+      sweep.maxDj = maxDj;
+      sweep.objvalue = objvalue;
+      sweep.kgood = kgood;
+      sweep.kbad = kbad;
+      sweep.nChange = nChange;
+      sweep.nflagged = nflagged;
+      for (int itry = 0; itry < 2; itry++)
+        idiotSweep(start[itry], stop[itry], direction,
+          cost, colsol, lower, upper, elemnt, row, columnStart, length,
+          statusWork, weight, djTol, djFlag, strategy, sweep);
+      maxDj = sweep.maxDj;
+      objvalue = sweep.objvalue;
+      kgood = sweep.kgood;
+      kbad = sweep.kbad;
+      nChange = sweep.nChange;
+      nflagged = sweep.nflagged;
+#ifndef OSI_IDIOT
     }
 #endif
     if (extraBlock) {
@@ -1247,10 +1268,7 @@ RETURN:
   delete[] aworkX;
   delete[] allsum;
   delete[] cost;
-#ifdef FOUR_GOES
-  delete[] pi2;
-  delete[] rowsol2;
-#endif
+  delete[] blockWork;
   for (i = 0; i < HISTORY + 1; i++) {
     delete[] history[i];
   }
@@ -2273,6 +2273,7 @@ Idiot::Idiot()
   maxIts2_ = 100;
   reasonableInfeas_ = static_cast< double >(nrows) * 0.05;
   lightWeight_ = 0;
+  numberBlocks_ = 1;
 }
 // Constructor from model
 Idiot::Idiot(OsiSolverInterface &model)
@@ -2315,6 +2316,7 @@ Idiot::Idiot(OsiSolverInterface &model)
   maxIts2_ = 100;
   reasonableInfeas_ = static_cast< double >(nrows) * 0.05;
   lightWeight_ = 0;
+  numberBlocks_ = 1;
 }
 // Copy constructor.
 Idiot::Idiot(const Idiot &rhs)
@@ -2351,6 +2353,7 @@ Idiot::Idiot(const Idiot &rhs)
   maxIts2_ = rhs.maxIts2_;
   strategy_ = rhs.strategy_;
   lightWeight_ = rhs.lightWeight_;
+  numberBlocks_ = rhs.numberBlocks_;
 }
 // Assignment operator. This copies the data
 Idiot &
@@ -2390,6 +2393,7 @@ Idiot::operator=(const Idiot &rhs)
     maxIts2_ = rhs.maxIts2_;
     strategy_ = rhs.strategy_;
     lightWeight_ = rhs.lightWeight_;
+    numberBlocks_ = rhs.numberBlocks_;
   }
   return *this;
 }
@@ -201,6 +201,19 @@ public:
   {
     lightWeight_ = value;
   }
+  /** Number of blocks of columns swept at the same time each minor
+         iteration (as tasks on ClpThreadPool).  Each block moves from the
+         same point and the moves are averaged (a Jacobi style step) so
+         result depends on this but not on number of threads in pool.
+         Default 1 (the serial Gauss-Seidel sweep). */
+  inline int getNumberBlocks() const
+  {
+    return numberBlocks_;
+  }
+  inline void setNumberBlocks(int value)
+  {
+    numberBlocks_ = value;
+  }
   /// strategy
   inline int getStrategy() const
   {
@@ -331,6 +344,7 @@ private:
 		 524288 - don't treat structural slacks as slacks */
 
   int lightWeight_; // 0 - normal, 1 lightweight
+  int numberBlocks_; /* blocks of columns swept at same time */
 };
 #endif
 
@@ -14,9 +14,12 @@
 #include <cmath>
 #include <cfloat>
 #include <string>
+#include <vector>
+#include <atomic>
 #include <iostream>
 
 #include "CoinMpsIO.hpp"
+#include "CoinFileIO.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinPackedVector.hpp"
 #include "CoinStructuredModel.hpp"
@@ -35,14 +38,24 @@
 #include "ClpSimplexOther.hpp"
 #include "ClpSimplexNonlinear.hpp"
 #include "ClpInterior.hpp"
+#include "ClpCholeskyBase.hpp"
+#include "ClpCholeskyDense.hpp"
+#include "ClpCholeskySymbolic.hpp"
 #include "ClpLinearObjective.hpp"
+#include "ClpQuadraticObjective.hpp"
 #include "ClpDualRowSteepest.hpp"
 #include "ClpDualRowDantzig.hpp"
 #include "ClpPrimalColumnSteepest.hpp"
 #include "ClpPrimalColumnDantzig.hpp"
 #include "ClpModelParameters.hpp"
 #include "ClpNetworkMatrix.hpp"
+#include "ClpNetworkSimplex.hpp"
+#include "ClpNode.hpp"
 #include "ClpPlusMinusOneMatrix.hpp"
+#include "ClpEventHandler.hpp"
+#include "ClpThreadPool.hpp"
+#include "ClpSimdKernels.hpp"
+#include "ClpMpsReader.hpp"
 #include "MyMessageHandler.hpp"
 #include "MyEventHandler.hpp"
 
@@ -85,9 +98,9 @@ static std::string nameBarrier = "barrier-MUMPS";
 static int barrierAvailable = 0;
 static std::string nameBarrier = "barrier-slow";
 #endif
-#define NUMBER_ALGORITHMS 12
+#define NUMBER_ALGORITHMS 13
 // If you just want a subset then set some to 1
-static int switchOff[NUMBER_ALGORITHMS] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+static int switchOff[NUMBER_ALGORITHMS] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 // shortName - 0 no , 1 yes
 ClpSolve setupForSolve(int algorithm, std::string &nameAlgorithm,
   int shortName)
@@ -101,6 +114,7 @@ ClpSolve setupForSolve(int algorithm, std::string &nameAlgorithm,
         6,7 automatic with and without
         8,9 primal with idiot 1 and 5
         10,11 primal with 70, dual with volume
+        12 race of dual, primal and barrier
      */
   switch (algorithm) {
   case 0:
@@ -207,6 +221,13 @@ ClpSolve setupForSolve(int algorithm, std::string &nameAlgorithm,
     solveOptions.setSolveType(ClpSolve::notImplemented);
 #endif
     break;
+  case 12:
+    if (shortName)
+      nameAlgorithm = "race";
+    else
+      nameAlgorithm = "race-dual-primal-barrier";
+    solveOptions.setSolveType(ClpSolve::useRace);
+    break;
   default:
     abort();
   }
@@ -217,6 +238,108 @@ ClpSolve setupForSolve(int algorithm, std::string &nameAlgorithm,
   }
   return solveOptions;
 }
+/* Generated LP - knapsack type rows (at most 0.3 of row total) on
+   0-1 columns, each column in numberPerColumn rows.  Same every time so
+   runs with different settings can be compared.  If numberBlocks > 1
+   the other rows are split into blocks with each column in one block and
+   also in the last row (which links the blocks). */
+static void generatedProblem(ClpModel &model, int numberRows, int numberColumns,
+  int numberPerColumn, int numberBlocks = 1)
+{
+  int rowsPerBlock = numberBlocks > 1 ? (numberRows - 1) / numberBlocks : numberRows;
+  int maximumElements = numberColumns * (numberPerColumn + 1);
+  CoinBigIndex *start = new CoinBigIndex[numberColumns + 1];
+  int *row = new int[maximumElements];
+  double *element = new double[maximumElements];
+  double *objective = new double[numberColumns];
+  double *columnLower = new double[numberColumns];
+  double *columnUpper = new double[numberColumns];
+  double *rowLower = new double[numberRows];
+  double *rowUpper = new double[numberRows];
+  CoinZeroN(rowUpper, numberRows);
+  CoinBigIndex n = 0;
+  start[0] = 0;
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    int firstRow = numberBlocks > 1 ? (iColumn % numberBlocks) * rowsPerBlock : 0;
+    for (int j = 0; j < numberPerColumn; j++) {
+      int iRow = firstRow + (iColumn * 37 + j * 29) % rowsPerBlock;
+      row[n] = iRow;
+      element[n] = 1.0 + ((iColumn + 3 * j) % 9);
+      rowUpper[iRow] += element[n];
+      n++;
+    }
+    if (numberBlocks > 1) {
+      row[n] = numberRows - 1;
+      element[n] = 1.0;
+      rowUpper[numberRows - 1] += 1.0;
+      n++;
+    }
+    start[iColumn + 1] = n;
+    objective[iColumn] = -1.0 - (iColumn % 7);
+    columnLower[iColumn] = 0.0;
+    columnUpper[iColumn] = 1.0;
+  }
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    rowLower[iRow] = -COIN_DBL_MAX;
+    rowUpper[iRow] *= 0.3;
+  }
+  CoinPackedMatrix matrix(true, numberRows, numberColumns, n,
+    element, row, start, NULL);
+  model.loadProblem(matrix, columnLower, columnUpper, objective,
+    rowLower, rowUpper);
+  delete[] start;
+  delete[] row;
+  delete[] element;
+  delete[] objective;
+  delete[] columnLower;
+  delete[] columnUpper;
+  delete[] rowLower;
+  delete[] rowUpper;
+}
+/* Dual steepest edge which checks each bucketed row choice against a
+   scan of all rows (numberWanted covers all rows in mode 1) */
+class ClpDualRowBucketCheck : public ClpDualRowSteepest {
+public:
+  ClpDualRowBucketCheck()
+    : ClpDualRowSteepest(1)
+    , numberChecked_(0)
+  {
+    setBucketMode(1);
+  }
+  virtual ClpDualRowPivot *clone(bool copyData = true) const
+  {
+    if (copyData)
+      return new ClpDualRowBucketCheck(*this);
+    else
+      return new ClpDualRowBucketCheck();
+  }
+  virtual int pivotRow()
+  {
+    int chosenRow = ClpDualRowSteepest::pivotRow();
+    if (!bucketOf_)
+      return chosenRow;
+    int *saveBucketOf = bucketOf_;
+    bucketOf_ = NULL;
+    int scanRow = ClpDualRowSteepest::pivotRow();
+    bucketOf_ = saveBucketOf;
+    assert((chosenRow < 0) == (scanRow < 0));
+    if (chosenRow >= 0 && chosenRow != scanRow) {
+      // may be a tie
+      assert(fabs(ratio(chosenRow) - ratio(scanRow)) <= 1.0e-12 * ratio(scanRow));
+    }
+    numberChecked_++;
+    return chosenRow;
+  }
+  /// Infeasibility/weight as used in choice
+  double ratio(int iRow) const
+  {
+    double value = infeasible_->denseVector()[iRow];
+    if (iRow == model_->pivotRow())
+      value *= 1.0e-10;
+    return value / CoinMin(weights_[iRow], 1.0e50);
+  }
+  int numberChecked_;
+};
 static void printSol(ClpSimplex &model)
 {
   int numberRows = model.numberRows();
@@ -1393,6 +1516,274 @@ int mainTest(int argc, const char *argv[], int algorithm,
     testingMessage("Some tests failed\n");
   return 0;
 }
+//----------------------------------------------------------------
+// Benchmark
+//----------------------------------------------------------------
+/* Counts factorizations - clones share the count so presolved models
+   count (and it is atomic as race solves clones at same time) */
+class ClpBenchmarkEventHandler : public ClpEventHandler {
+public:
+  ClpBenchmarkEventHandler(std::atomic< int > *count)
+    : ClpEventHandler()
+    , count_(count)
+  {
+  }
+  virtual int event(Event whichEvent)
+  {
+    if (whichEvent == endOfFactorization)
+      (*count_)++;
+    return -1;
+  }
+  virtual ClpEventHandler *clone() const
+  {
+    return new ClpBenchmarkEventHandler(*this);
+  }
+
+private:
+  std::atomic< int > *count_;
+};
+// String as JSON string (with quotes)
+static std::string clpJsonString(const std::string &value)
+{
+  std::string result = "\"";
+  for (size_t i = 0; i < value.size(); i++) {
+    unsigned char c = static_cast< unsigned char >(value[i]);
+    if (c == '"' || c == '\\') {
+      result += '\\';
+      result += static_cast< char >(c);
+    } else if (c < 0x20) {
+      char escaped[8];
+      sprintf(escaped, "\\u%04x", c);
+      result += escaped;
+    } else {
+      result += static_cast< char >(c);
+    }
+  }
+  result += '"';
+  return result;
+}
+// Splits at separator
+static std::vector< std::string > clpSplit(const std::string &value, char separator)
+{
+  std::vector< std::string > fields;
+  std::string::size_type start = 0;
+  while (start <= value.size()) {
+    std::string::size_type end = value.find(separator, start);
+    if (end == std::string::npos)
+      end = value.size();
+    if (end > start)
+      fields.push_back(value.substr(start, end - start));
+    start = end + 1;
+  }
+  return fields;
+}
+/* Named sets of netlib instances for benchmark.
+   Returns false if name is not a set.
+*/
+static bool clpBenchmarkSet(const std::string &name,
+  std::vector< std::string > &instances)
+{
+  static const char *smallSet[] = { "afiro", "adlittle", "blend", "sc50a",
+    "sc50b", "sc105", "sc205", "share1b", "share2b", "kb2", "scagr7",
+    "stocfor1", "boeing2", "israel", "vtp.base", NULL };
+  static const char *mediumSet[] = { "25fv47", "bnl1", "degen2", "czprob",
+    "ganges", "maros", "perold", "pilot4", "scfxm3", "sctap3", "ship12l",
+    "fit1d", "greenbeb", "nesm", "cycle", NULL };
+  static const char *largeSet[] = { "80bau3b", "bnl2", "d2q06c", "degen3",
+    "dfl001", "fit2p", "greenbea", "maros-r7", "pilot", "pilot87",
+    "stocfor3", "truss", NULL };
+  const char **sets[3] = { smallSet, mediumSet, largeSet };
+  const char *setNames[3] = { "small", "medium", "large" };
+  bool found = false;
+  for (int iSet = 0; iSet < 3; iSet++) {
+    if (name == setNames[iSet] || name == "netlib") {
+      for (int i = 0; sets[iSet][i]; i++)
+        instances.push_back(sets[iSet][i]);
+      found = true;
+    }
+  }
+  return found;
+}
+/* Runs instances under algorithms and thread counts and writes results.
+   spec is a comma separated list of instance names or set names
+   (small, medium, large, netlib) and options -
+     algorithms=a+b+...  dual, primal, barrier, either, race,
+                         abc-dual, abc-primal (default dual+primal+barrier)
+     threads=n+m+...     thread counts (default as now)
+     repeats=n           number of times each is run (default 3)
+     output=name         results go to name.json and name.csv
+                         (default benchmark)
+*/
+int mainBenchmark(const std::string &spec, const std::string &dirNetlib,
+  ClpSolve solveOptionsIn)
+{
+  std::vector< std::string > instances;
+  std::vector< std::string > algorithms;
+  std::vector< int > threads;
+  int numberRepeats = 3;
+  std::string outputName = "benchmark";
+  std::vector< std::string > fields = clpSplit(spec, ',');
+  for (size_t i = 0; i < fields.size(); i++) {
+    std::string::size_type eqPos = fields[i].find('=');
+    if (eqPos == std::string::npos) {
+      if (!clpBenchmarkSet(fields[i], instances))
+        instances.push_back(fields[i]);
+      continue;
+    }
+    std::string key = fields[i].substr(0, eqPos);
+    std::string value = fields[i].substr(eqPos + 1);
+    if (key == "algorithms") {
+      algorithms = clpSplit(value, '+');
+    } else if (key == "threads") {
+      std::vector< std::string > counts = clpSplit(value, '+');
+      for (size_t j = 0; j < counts.size(); j++)
+        threads.push_back(CoinMax(1, atoi(counts[j].c_str())));
+    } else if (key == "repeats") {
+      numberRepeats = CoinMax(1, atoi(value.c_str()));
+    } else if (key == "output") {
+      outputName = value;
+    } else {
+      std::cerr << "Unknown benchmark option " << key << std::endl;
+      return 1;
+    }
+  }
+  if (instances.empty())
+    clpBenchmarkSet("small", instances);
+  if (algorithms.empty()) {
+    algorithms.push_back("dual");
+    algorithms.push_back("primal");
+    algorithms.push_back("barrier");
+  }
+  int saveThreads = ClpThreadPool::wantedNumberThreads();
+  if (threads.empty())
+    threads.push_back(saveThreads);
+  std::string jsonName = outputName + ".json";
+  std::string csvName = outputName + ".csv";
+  FILE *fpJson = fopen(jsonName.c_str(), "w");
+  FILE *fpCsv = fopen(csvName.c_str(), "w");
+  if (!fpJson || !fpCsv) {
+    std::cerr << "Unable to open " << jsonName << " or " << csvName << std::endl;
+    if (fpJson)
+      fclose(fpJson);
+    if (fpCsv)
+      fclose(fpCsv);
+    return 1;
+  }
+  fprintf(fpJson, "{\n  \"version\": %s,\n  \"repeats\": %d,\n  \"runs\": [",
+    clpJsonString(CLP_VERSION).c_str(), numberRepeats);
+  fprintf(fpCsv, "instance,rows,columns,elements,algorithm,threads,repeat,"
+                 "status,objective,iterations,factorizations,read_seconds,"
+                 "wall_seconds,cpu_seconds\n");
+  int numberRuns = 0;
+  int numberFailures = 0;
+  for (size_t iInstance = 0; iInstance < instances.size(); iInstance++) {
+    std::string fileName = dirNetlib + instances[iInstance] + ".mps";
+    if (!fileCoinReadable(fileName)) {
+      fileName = dirNetlib + instances[iInstance];
+      if (!fileCoinReadable(fileName)) {
+        std::cerr << "  skipping " << instances[iInstance]
+                  << " as can not be read" << std::endl;
+        continue;
+      }
+    }
+    ClpSimplex base;
+    base.setLogLevel(0);
+    double readTime = CoinGetTimeOfDay();
+    if (base.readMps(fileName.c_str(), true, false)) {
+      std::cerr << "  skipping " << instances[iInstance]
+                << " as errors in file" << std::endl;
+      continue;
+    }
+    readTime = CoinGetTimeOfDay() - readTime;
+    for (size_t iAlgorithm = 0; iAlgorithm < algorithms.size(); iAlgorithm++) {
+      const std::string &algorithm = algorithms[iAlgorithm];
+      ClpSolve solveOptions = solveOptionsIn;
+#ifdef ABC_INHERIT
+      bool useAbc = false;
+#endif
+      if (algorithm == "dual") {
+        solveOptions.setSolveType(ClpSolve::useDual);
+      } else if (algorithm == "primal") {
+        solveOptions.setSolveType(ClpSolve::usePrimalorSprint);
+      } else if (algorithm == "barrier") {
+        solveOptions.setSolveType(ClpSolve::useBarrier);
+        if (barrierAvailable == 1)
+          solveOptions.setSpecialOption(4, 4);
+        else if (barrierAvailable == 2)
+          solveOptions.setSpecialOption(4, 2);
+      } else if (algorithm == "either") {
+        solveOptions.setSolveType(ClpSolve::automatic);
+      } else if (algorithm == "race") {
+        solveOptions.setSolveType(ClpSolve::useRace);
+      } else if (algorithm == "abc-dual" || algorithm == "abc-primal") {
+#ifdef ABC_INHERIT
+        solveOptions.setSolveType(algorithm == "abc-dual" ? ClpSolve::useDual : ClpSolve::usePrimal);
+        useAbc = true;
+#else
+        std::cerr << "  skipping " << algorithm << " as not built with ABC" << std::endl;
+        continue;
+#endif
+      } else {
+        std::cerr << "  skipping unknown algorithm " << algorithm << std::endl;
+        continue;
+      }
+      for (size_t iThread = 0; iThread < threads.size(); iThread++) {
+        ClpThreadPool::setNumberThreads(threads[iThread]);
+        for (int iRepeat = 0; iRepeat < numberRepeats; iRepeat++) {
+          ClpSimplex model(base);
+          std::atomic< int > numberFactorizations(0);
+          ClpBenchmarkEventHandler handler(&numberFactorizations);
+          model.passInEventHandler(&handler);
+#ifdef ABC_INHERIT
+          if (useAbc)
+            model.setAbcState(CoinMin(threads[iThread], 15));
+#endif
+          if (model.maximumSeconds() < 0.0)
+            model.setMaximumSeconds(3600.0);
+          double wallTime = CoinGetTimeOfDay();
+          double cpuTime = CoinCpuTime();
+          model.initialSolve(solveOptions);
+          cpuTime = CoinCpuTime() - cpuTime;
+          wallTime = CoinGetTimeOfDay() - wallTime;
+          if (model.problemStatus())
+            numberFailures++;
+          std::cerr << "  " << instances[iInstance] << " " << algorithm
+                    << " threads " << threads[iThread] << " took " << wallTime
+                    << " seconds (" << model.numberIterations()
+                    << " iterations) - status " << model.problemStatus() << std::endl;
+          fprintf(fpJson, "%s\n    {\"instance\": %s, \"rows\": %d, \"columns\": %d, "
+                          "\"elements\": %d, \"algorithm\": %s, \"threads\": %d, "
+                          "\"repeat\": %d, \"status\": %d, \"objective\": %.12g, "
+                          "\"iterations\": %d, \"factorizations\": %d, "
+                          "\"read_seconds\": %.6f, \"wall_seconds\": %.6f, "
+                          "\"cpu_seconds\": %.6f}",
+            numberRuns ? "," : "", clpJsonString(instances[iInstance]).c_str(),
+            base.numberRows(), base.numberColumns(),
+            static_cast< int >(base.getNumElements()),
+            clpJsonString(algorithm).c_str(),
+            threads[iThread], iRepeat, model.problemStatus(),
+            model.objectiveValue(), model.numberIterations(),
+            numberFactorizations.load(), readTime, wallTime, cpuTime);
+          fprintf(fpCsv, "%s,%d,%d,%d,%s,%d,%d,%d,%.12g,%d,%d,%.6f,%.6f,%.6f\n",
+            instances[iInstance].c_str(), base.numberRows(), base.numberColumns(),
+            static_cast< int >(base.getNumElements()), algorithm.c_str(),
+            threads[iThread], iRepeat, model.problemStatus(),
+            model.objectiveValue(), model.numberIterations(),
+            numberFactorizations.load(), readTime, wallTime, cpuTime);
+          numberRuns++;
+        }
+      }
+    }
+  }
+  fprintf(fpJson, "\n  ]\n}\n");
+  fclose(fpJson);
+  fclose(fpCsv);
+  ClpThreadPool::setNumberThreads(saveThreads);
+  std::cerr << numberRuns << " benchmark runs (" << numberFailures
+            << " not optimal) written to " << jsonName << " and "
+            << csvName << std::endl;
+  return numberFailures ? 1 : 0;
+}
 
 // Display message on stdout and stderr
 static void testingMessage(const char *const msg)
@@ -1892,6 +2283,230 @@ void ClpSimplexUnitTest(const std::string &dirSample)
       solution.setDualRowPivotAlgorithm(steep);
       solution.setDblParam(ClpObjOffset, m.objectiveOffset());
       solution.dual();
+      // vector kernels in exact mode must not change anything
+      int saveLevel = clpSimdLevel();
+      bool saveExact = clpSimdExact();
+      clpSetSimdExact(true);
+      int iterations[CLP_SIMD_AVX512 + 1];
+      double objValue[CLP_SIMD_AVX512 + 1];
+      for (int level = CLP_SIMD_NONE; level <= clpSimdAvailable(); level++) {
+        clpSetSimdLevel(level);
+        ClpSimplex solution2(model);
+        solution2.setLogLevel(0);
+        solution2.setDualRowPivotAlgorithm(steep);
+        solution2.dual();
+        iterations[level] = solution2.numberIterations();
+        objValue[level] = solution2.objectiveValue();
+        assert(iterations[level] == iterations[0]);
+        assert(objValue[level] == objValue[0]);
+      }
+      clpSetSimdLevel(saveLevel);
+      clpSetSimdExact(saveExact);
+      // bucketed row choice must reach the same optimum
+      {
+        ClpDualRowSteepest steepBuckets;
+        steepBuckets.setBucketMode(1);
+        ClpSimplex solution3(model);
+        solution3.setLogLevel(0);
+        solution3.setDualRowPivotAlgorithm(steepBuckets);
+        solution3.dual();
+        assert(solution3.status() == 0);
+        assert(fabs(solution3.objectiveValue() - objValue[0]) < 1.0e-7 * (1.0 + fabs(objValue[0])));
+      }
+      // bucketed row choice must be that of full scan
+      {
+        ClpDualRowBucketCheck steepCheck;
+        ClpSimplex solution3(model);
+        solution3.setLogLevel(0);
+        solution3.setDualRowPivotAlgorithm(steepCheck);
+        solution3.dual();
+        assert(solution3.status() == 0);
+        assert(fabs(solution3.objectiveValue() - objValue[0]) < 1.0e-7 * (1.0 + fabs(objValue[0])));
+        ClpDualRowBucketCheck *check = dynamic_cast< ClpDualRowBucketCheck * >(solution3.dualRowPivot());
+        assert(check && check->numberChecked_ > 0);
+      }
+      // exact initial weights - norms done in panels on several
+      // threads must be exactly those done serially
+      {
+        ClpDualRowSteepest steepExact(1);
+        ClpSimplex solution3(model);
+        solution3.setLogLevel(0);
+        solution3.setDualRowPivotAlgorithm(steepExact);
+        solution3.dual(0, 1); // keep factorization
+        assert(solution3.status() == 0);
+        int numberRows = solution3.numberRows();
+        double *serialNorms = new double[numberRows];
+        double *panelNorms = new double[numberRows];
+        int saveThreads = ClpThreadPool::wantedNumberThreads();
+        ClpThreadPool::setNumberThreads(1);
+        solution3.factorization()->transposeNorms(0, numberRows, serialNorms);
+        ClpThreadPool::setNumberThreads(4);
+        // small panels so threads are used
+        CoinFillN(panelNorms, numberRows, -1.0);
+        solution3.factorization()->transposeNorms(0, numberRows, panelNorms, 64);
+        for (int iRow = 0; iRow < numberRows; iRow++) {
+          assert(serialNorms[iRow] > 0.0);
+          assert(panelNorms[iRow] == serialNorms[iRow]);
+        }
+        // and part of rows (only those must be touched)
+        int firstRow = numberRows / 3;
+        CoinFillN(panelNorms, numberRows, -1.0);
+        solution3.factorization()->transposeNorms(firstRow, numberRows, panelNorms, 64);
+        for (int iRow = 0; iRow < numberRows; iRow++) {
+          if (iRow < firstRow)
+            assert(panelNorms[iRow] == -1.0);
+          else
+            assert(panelNorms[iRow] == serialNorms[iRow]);
+        }
+        ClpThreadPool::setNumberThreads(saveThreads);
+        delete[] serialNorms;
+        delete[] panelNorms;
+      }
+    }
+  }
+  // test threaded dual pricing gives same path as serial
+  {
+    int saveThreads = ClpThreadPool::wantedNumberThreads();
+    int numberIterations[2];
+    double objectiveValue[2];
+    for (int iPass = 0; iPass < 2; iPass++) {
+      ClpThreadPool::setNumberThreads(iPass ? 4 : 1);
+      ClpSimplex solution;
+      // enough columns for blocks to be done as tasks
+      generatedProblem(solution, 400, 24000, 5);
+      ClpPackedMatrix *clpMatrix = dynamic_cast< ClpPackedMatrix * >(solution.clpMatrix());
+      assert(clpMatrix);
+      clpMatrix->makeSpecialColumnCopy();
+      solution.dual();
+      assert(!solution.status());
+      numberIterations[iPass] = solution.numberIterations();
+      objectiveValue[iPass] = solution.objectiveValue();
+    }
+    ClpThreadPool::setNumberThreads(saveThreads);
+    assert(numberIterations[0] == numberIterations[1]);
+    assert(objectiveValue[0] == objectiveValue[1]);
+  }
+  // test idiot crash with blocks of columns swept at same time
+  {
+    int saveThreads = ClpThreadPool::wantedNumberThreads();
+    int numberIterations[3];
+    double crashObjective[3];
+    double objectiveValue[3];
+    for (int iPass = 0; iPass < 3; iPass++) {
+      // serial sweep, four blocks with one thread, four blocks with four
+      ClpThreadPool::setNumberThreads(iPass == 2 ? 4 : 1);
+      ClpSimplex solution;
+      generatedProblem(solution, 300, 8000, 5);
+      solution.setLogLevel(0);
+      Idiot info(solution);
+      info.setNumberBlocks(iPass ? 4 : 1);
+      info.crash(30, solution.messageHandler(), solution.messagesPointer(), false);
+      const double *columnSolution = solution.primalColumnSolution();
+      const double *objective = solution.objective();
+      double value = 0.0;
+      for (int i = 0; i < solution.numberColumns(); i++)
+        value += objective[i] * columnSolution[i];
+      crashObjective[iPass] = value;
+      solution.primal(1);
+      assert(!solution.status());
+      numberIterations[iPass] = solution.numberIterations();
+      objectiveValue[iPass] = solution.objectiveValue();
+    }
+    ClpThreadPool::setNumberThreads(saveThreads);
+    // blocks give a different start but not a different optimum
+    CoinRelFltEq eq(1.0e-7);
+    assert(eq(objectiveValue[0], objectiveValue[1]));
+    // and do not depend on number of threads
+    assert(crashObjective[1] == crashObjective[2]);
+    assert(numberIterations[1] == numberIterations[2]);
+    assert(objectiveValue[1] == objectiveValue[2]);
+  }
+  // test fast MPS reader with tiny chunks against CoinMpsIO
+  {
+    {
+      // written with two elements a line and integer markers
+      ClpSimplex model;
+      generatedProblem(model, 50, 200, 5);
+      for (int iColumn = 0; iColumn < 200; iColumn += 3)
+        model.setInteger(iColumn);
+      model.writeMps("chunks.mps");
+    }
+    const char *fileNames[] = { "chunks", "exmip1", "p0033", "afiro" };
+    for (int iFile = 0; iFile < 4; iFile++) {
+      std::string fn = iFile ? dirSample + fileNames[iFile] + ".mps" : "chunks.mps";
+      if (!fileCoinReadable(fn))
+        continue;
+      CoinMpsIO m;
+      m.messageHandler()->setLogLevel(0);
+      if (m.readMps(fn.c_str(), "") != 0)
+        continue;
+      int numberRows = m.getNumRows();
+      int numberColumns = m.getNumCols();
+      CoinRelFltEq eq(1.0e-12);
+      for (int iPass = 0; iPass < 2; iPass++) {
+        ClpMpsReader reader;
+        // so columns, continuation lines and markers cross chunks
+        if (iPass)
+          reader.setChunkSize(16);
+        int returnCode = reader.readMps(fn.c_str());
+        // a sample may need CoinMpsIO (e.g. integer with no upper bound)
+        if (returnCode == 1 && iFile && !iPass)
+          break;
+        assert(!returnCode);
+        assert(!iPass || reader.numberChunks() > 1);
+        assert(reader.numberRows() == numberRows);
+        assert(reader.numberColumns() == numberColumns);
+        CoinPackedMatrix *matrix = reader.takeMatrix();
+        assert(matrix->isEquivalent(*m.getMatrixByCol()));
+        delete matrix;
+        for (int iRow = 0; iRow < numberRows; iRow++) {
+          assert(reader.rowLower()[iRow] == m.getRowLower()[iRow]
+            || eq(reader.rowLower()[iRow], m.getRowLower()[iRow]));
+          assert(reader.rowUpper()[iRow] == m.getRowUpper()[iRow]
+            || eq(reader.rowUpper()[iRow], m.getRowUpper()[iRow]));
+          assert(!strcmp(reader.rowName(iRow), m.rowName(iRow)));
+        }
+        const char *integerColumns = reader.integerColumns();
+        for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+          assert(reader.columnLower()[iColumn] == m.getColLower()[iColumn]
+            || eq(reader.columnLower()[iColumn], m.getColLower()[iColumn]));
+          assert(reader.columnUpper()[iColumn] == m.getColUpper()[iColumn]
+            || eq(reader.columnUpper()[iColumn], m.getColUpper()[iColumn]));
+          assert(reader.objective()[iColumn] == m.getObjCoefficients()[iColumn]
+            || eq(reader.objective()[iColumn], m.getObjCoefficients()[iColumn]));
+          assert(!strcmp(reader.columnName(iColumn), m.columnName(iColumn)));
+          bool isInteger = integerColumns && integerColumns[iColumn];
+          assert(isInteger == m.isInteger(iColumn));
+        }
+      }
+    }
+    remove("chunks.mps");
+    // an element given twice must be left to CoinMpsIO
+    {
+      std::string fileName = "duplicate.mps";
+      FILE *fp = fopen(fileName.c_str(), "w");
+      assert(fp);
+      fprintf(fp, "NAME          DUPLICATE\n"
+                  "ROWS\n"
+                  " N  COST\n"
+                  " L  LIM1\n"
+                  " L  LIM2\n"
+                  "COLUMNS\n"
+                  "    X1        COST         1.0   LIM1         1.0\n"
+                  "    X1        LIM2         1.0   LIM1         2.0\n"
+                  "    X2        COST         1.0   LIM2         1.0\n"
+                  "RHS\n"
+                  "    RHS       LIM1         4.0   LIM2         4.0\n"
+                  "ENDATA\n");
+      fclose(fp);
+      for (int iPass = 0; iPass < 2; iPass++) {
+        ClpMpsReader reader;
+        // duplicate in one chunk and across chunks
+        if (iPass)
+          reader.setChunkSize(16);
+        assert(reader.readMps(fileName.c_str()) == 1);
+      }
+      remove(fileName.c_str());
     }
   }
   // test normal solution
@@ -1979,6 +2594,319 @@ void ClpSimplexUnitTest(const std::string &dirSample)
       std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
     }
   }
+  // test batched scenarios
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      model.dual();
+      int numberRows = model.numberRows();
+      int numberColumns = model.numberColumns();
+      double *saveUpper = CoinCopyOfArray(model.rowUpper(), numberRows);
+      const int numberScenarios = 6;
+      double *rowUpper[numberScenarios];
+      double *objective[numberScenarios];
+      double objValue[numberScenarios];
+      int status[numberScenarios];
+      for (int i = 0; i < numberScenarios; i++) {
+        rowUpper[i] = CoinCopyOfArray(m.getRowUpper(), numberRows);
+        objective[i] = CoinCopyOfArray(m.getObjCoefficients(), numberColumns);
+        // relax rows and make costs dearer so all stay optimal
+        for (int iRow = 0; iRow < numberRows; iRow++) {
+          if (rowUpper[i][iRow] < 1.0e20)
+            rowUpper[i][iRow] += 0.5 * i;
+        }
+        for (int iColumn = i; iColumn < numberColumns; iColumn += numberScenarios)
+          objective[i][iColumn] += 0.1 * i;
+      }
+      CoinRelFltEq eq(1.0e-7);
+      for (int numberThreads = 1; numberThreads < 4; numberThreads += 2) {
+        int numberBad = model.solveScenarios(numberScenarios, NULL, rowUpper,
+          objective, objValue, status, NULL, NULL, NULL, numberThreads);
+        assert(!numberBad);
+        for (int i = 0; i < numberScenarios; i++) {
+          // against a cold solve
+          ClpSimplex check;
+          check.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+            objective[i], m.getRowLower(), rowUpper[i]);
+          check.setLogLevel(0);
+          check.dual();
+          assert(!status[i] && eq(objValue[i], check.objectiveValue()));
+        }
+        // data put back
+        assert(!memcmp(model.rowUpper(), saveUpper, numberRows * sizeof(double)));
+      }
+      delete[] saveUpper;
+      for (int i = 0; i < numberScenarios; i++) {
+        delete[] rowUpper[i];
+        delete[] objective[i];
+      }
+    } else {
+      std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
+    }
+  }
+  // test threaded strong branching same as serial
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      model.dual();
+      int numberColumns = model.numberColumns();
+      const double *solution = model.primalColumnSolution();
+      int which[20];
+      int numberVariables = 0;
+      for (int iColumn = 0; iColumn < numberColumns && numberVariables < 20; iColumn++) {
+        if (fabs(solution[iColumn] - floor(solution[iColumn] + 0.5)) > 1.0e-3)
+          which[numberVariables++] = iColumn;
+      }
+      double down[2][20], up[2][20];
+      int sbStatus[2][40], sbIterations[2][40];
+      double **sbSolution[2];
+      for (int iPass = 0; iPass < 2; iPass++) {
+        sbSolution[iPass] = new double *[2 * numberVariables];
+        for (int i = 0; i < 2 * numberVariables; i++)
+          sbSolution[iPass][i] = new double[numberColumns];
+        for (int i = 0; i < numberVariables; i++) {
+          down[iPass][i] = floor(solution[which[i]]);
+          up[iPass][i] = ceil(solution[which[i]]);
+        }
+        int returnCode = model.strongBranching(numberVariables, which,
+          up[iPass], down[iPass], sbSolution[iPass],
+          sbStatus[iPass], sbIterations[iPass], false, false, 0,
+          iPass ? 3 : 1);
+        assert(returnCode >= -1);
+      }
+      for (int i = 0; i < numberVariables; i++) {
+        assert(down[0][i] == down[1][i] && up[0][i] == up[1][i]);
+        for (int j = 2 * i; j < 2 * i + 2; j++) {
+          assert(sbStatus[0][j] == sbStatus[1][j]);
+          assert(sbIterations[0][j] == sbIterations[1][j]);
+          assert(!memcmp(sbSolution[0][j], sbSolution[1][j],
+            numberColumns * sizeof(double)));
+        }
+      }
+      for (int iPass = 0; iPass < 2; iPass++) {
+        for (int i = 0; i < 2 * numberVariables; i++)
+          delete[] sbSolution[iPass][i];
+        delete[] sbSolution[iPass];
+      }
+    } else {
+      std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
+    }
+  }
+  // test parallel fathom same as serial (and brute force)
+  {
+    // small two row knapsack - maximize value
+    const int numberColumns = 16;
+    const int numberRows = 2;
+    double objective[numberColumns];
+    double columnLower[numberColumns];
+    double columnUpper[numberColumns];
+    CoinBigIndex start[numberColumns + 1];
+    int row[2 * numberColumns];
+    double element[2 * numberColumns];
+    double rowLower[numberRows] = { -COIN_DBL_MAX, -COIN_DBL_MAX };
+    double rowUpper[numberRows] = { 37.0, 41.0 };
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      objective[iColumn] = -(5.0 + ((7 * iColumn + 3) % 11));
+      columnLower[iColumn] = 0.0;
+      columnUpper[iColumn] = 1.0;
+      start[iColumn] = 2 * iColumn;
+      row[2 * iColumn] = 0;
+      element[2 * iColumn] = 3.0 + ((5 * iColumn + 1) % 7);
+      row[2 * iColumn + 1] = 1;
+      element[2 * iColumn + 1] = 2.0 + ((3 * iColumn + 2) % 9);
+    }
+    start[numberColumns] = 2 * numberColumns;
+    double bestValue = COIN_DBL_MAX;
+    for (int mask = 0; mask < (1 << numberColumns); mask++) {
+      double value = 0.0;
+      double use0 = 0.0;
+      double use1 = 0.0;
+      for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+        if ((mask & (1 << iColumn)) != 0) {
+          value += objective[iColumn];
+          use0 += element[2 * iColumn];
+          use1 += element[2 * iColumn + 1];
+        }
+      }
+      if (use0 <= rowUpper[0] && use1 <= rowUpper[1])
+        bestValue = CoinMin(bestValue, value);
+    }
+    CoinRelFltEq eq(1.0e-7);
+    int numberIntegers = numberColumns;
+    double pseudo[numberColumns];
+    int zero[numberColumns];
+    for (int i = 0; i < numberIntegers; i++) {
+      pseudo[i] = 1.0;
+      zero[i] = 0;
+    }
+    for (int numberThreads = 1; numberThreads < 5; numberThreads += 3) {
+      ClpSimplex model;
+      model.loadProblem(numberColumns, numberRows, start, row, element,
+        columnLower, columnUpper, objective, rowLower, rowUpper);
+      for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+        model.setInteger(iColumn);
+      model.setLogLevel(0);
+      model.dual();
+      assert(!model.status());
+      ClpNodeStuff info;
+      info.fillPseudoCosts(pseudo, pseudo, zero, zero, zero, zero, zero,
+        numberIntegers);
+      info.numberThreads_ = numberThreads;
+      int returnCode = model.fathom(&info);
+      assert(returnCode == 1);
+      assert(info.nNodes_ >= 0);
+      assert(eq(model.objectiveValue(), bestValue));
+    }
+  }
+  // test delta hot start same as full
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      model.dual();
+      int numberColumns = model.numberColumns();
+      CoinRelFltEq eq(1.0e-7);
+      void *base;
+      model.markHotStart(base);
+      const double *solution = model.primalColumnSolution();
+      int iColumn = 0;
+      while (iColumn < numberColumns - 1 && solution[iColumn] < 1.0e-3)
+        iColumn++;
+      double saveBound = model.columnUpper()[iColumn];
+      model.setColumnUpper(iColumn, 0.5 * solution[iColumn]);
+      void *delta;
+      void *full;
+      model.markHotStart(delta, base);
+      model.markHotStart(full);
+      assert(model.hotStartSize(delta) < model.hotStartSize(full));
+      model.solveFromHotStart(full);
+      double objFull = model.objectiveValue();
+      int statusFull = model.problemStatus();
+      model.solveFromHotStart(delta);
+      assert(model.problemStatus() == statusFull);
+      assert(eq(model.objectiveValue(), objFull));
+      model.unmarkHotStart(full);
+      model.unmarkHotStart(delta);
+      model.unmarkHotStart(base);
+      model.setColumnUpper(iColumn, saveBound);
+    } else {
+      std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
+    }
+  }
+  // test reused presolve
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      int numberRows = model.numberRows();
+      int numberColumns = model.numberColumns();
+      ClpPresolve savedPresolve;
+      ClpSolve solveOptions;
+      solveOptions.setSavedPresolve(&savedPresolve);
+      // no dual, tighten or implied free - otherwise nothing is kept
+      solveOptions.setPresolveActions(1 | 16 | 64);
+      CoinRelFltEq eq(1.0e-7);
+      int numberChanged = 0;
+      for (int iPass = 0; iPass < 6; iPass++) {
+        // same values first time round then change some row bounds and
+        // costs which presolve left alone
+        int numberChangedNow = 0;
+        if (iPass > 1) {
+          double *rowLower = model.rowLower();
+          double *rowUpper = model.rowUpper();
+          for (int iRow = iPass % 3; iRow < numberRows; iRow += 3) {
+            if (!savedPresolve.reusable(numberColumns + iRow))
+              continue;
+            if (rowUpper[iRow] < 1.0e20)
+              rowUpper[iRow] += 0.5;
+            else if (rowLower[iRow] > -1.0e20)
+              rowLower[iRow] -= 0.5;
+            else
+              continue;
+            numberChangedNow++;
+          }
+          double *objective = model.objective();
+          for (int iColumn = iPass % 3; iColumn < numberColumns; iColumn += 3) {
+            if (savedPresolve.reusable(iColumn)) {
+              objective[iColumn] += 0.1;
+              numberChangedNow++;
+            }
+          }
+        }
+        int numberReused = savedPresolve.numberReused();
+        model.initialSolve(solveOptions);
+        ClpSimplex check;
+        check.loadProblem(*model.matrix(), model.columnLower(), model.columnUpper(),
+          model.objective(), model.rowLower(), model.rowUpper());
+        check.setLogLevel(0);
+        check.dual();
+        assert(!model.status() && eq(model.objectiveValue(), check.objectiveValue()));
+        if (iPass == 1)
+          assert(savedPresolve.numberReused() == 1);
+        if (numberChangedNow) {
+          // presolve must have been reused and saved basis saves work
+          numberChanged += numberChangedNow;
+          assert(savedPresolve.numberReused() == numberReused + 1);
+          assert(model.numberIterations() < check.numberIterations());
+        }
+      }
+      assert(numberChanged);
+      /* Now with full presolve.  Raise each cost in turn, which can
+         flip the sign of a reduced cost dual presolve relied on two or
+         more rows and columns away, and check answer against a fresh
+         solve.  Reuse is only allowed where presolve said so. */
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      ClpPresolve fullPresolve;
+      ClpSolve fullOptions;
+      fullOptions.setSavedPresolve(&fullPresolve);
+      model.initialSolve(fullOptions);
+      assert(!model.status());
+      for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+        double *objective = model.objective();
+        bool reusable = fullPresolve.reusable(iColumn);
+        int numberReused = fullPresolve.numberReused();
+        double saveCost = objective[iColumn];
+        objective[iColumn] += 1.0;
+        model.initialSolve(fullOptions);
+        ClpSimplex check;
+        check.loadProblem(*model.matrix(), model.columnLower(), model.columnUpper(),
+          model.objective(), model.rowLower(), model.rowUpper());
+        check.setLogLevel(0);
+        check.dual();
+        assert(!check.status());
+        assert(!model.status() && eq(model.objectiveValue(), check.objectiveValue()));
+        if (!reusable)
+          assert(fullPresolve.numberReused() == numberReused);
+        model.objective()[iColumn] = saveCost;
+      }
+    } else {
+      std::cerr << "Error reading afiro from sample data. Skipping test." << std::endl;
+    }
+  }
   // test unbounded
   {
     CoinMpsIO m;
@@ -2339,7 +3267,224 @@ void ClpSimplexUnitTest(const std::string &dirSample)
       solution.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
         m.getObjCoefficients(),
         m.getRowLower(), m.getRowUpper());
+      solution.setCholesky(new ClpCholeskyBase());
       solution.primalDual();
+      // Change objective a little and warm start (reusing ordering)
+      double *objective = solution.objective();
+      int numberColumns = solution.numberColumns();
+      for (int i = 0; i < numberColumns; i++)
+        objective[i] *= 1.0 + 0.01 * (i % 3);
+      ClpInterior cold(solution);
+      cold.primalDual();
+      solution.setWarmStart();
+      assert(solution.warmStart());
+      solution.primalDual();
+      assert(!solution.warmStart());
+      CoinRelFltEq eq(1.0e-5);
+      assert(eq(solution.objectiveValue(), cold.objectiveValue()));
+      // warm start dropped if model gets another row before solve
+      solution.setWarmStart();
+      int column0 = 0;
+      double one = 1.0;
+      solution.addRow(1, &column0, &one, -1.0e6, 1.0e6);
+      solution.primalDual();
+      assert(!solution.warmStart());
+      assert(eq(solution.objectiveValue(), cold.objectiveValue()));
+    } else {
+      std::cerr << "Error reading exmip1 from sample data. Skipping test." << std::endl;
+    }
+  }
+  // Test barrier path (number of correctors) is the same every run
+  {
+    // small factorization so old fixed correctors
+    int numberIterations[2];
+    double objectiveValue[2];
+    for (int iPass = 0; iPass < 2; iPass++) {
+      ClpInterior solution;
+      generatedProblem(solution, 200, 500, 7);
+      solution.setCholesky(new ClpCholeskyBase());
+      solution.primalDual();
+      assert(!solution.status());
+      numberIterations[iPass] = solution.numberIterations();
+      objectiveValue[iPass] = solution.objectiveValue();
+    }
+    // correctors used to depend on timing
+    assert(numberIterations[0] == numberIterations[1]);
+    assert(objectiveValue[0] == objectiveValue[1]);
+  }
+  // Test centrality correctors solved together
+  {
+    int saveThreads = ClpThreadPool::wantedNumberThreads();
+    int numberIterations[2];
+    double objectiveValue[2];
+    for (int iPass = 0; iPass < 2; iPass++) {
+      ClpThreadPool::setNumberThreads(iPass ? 4 : 1);
+      ClpInterior solution;
+      generatedProblem(solution, 600, 1500, 10);
+      ClpCholeskyBase *cholesky = new ClpCholeskyBase();
+      solution.setCholesky(cholesky);
+      solution.primalDual();
+      assert(!solution.status());
+      // factorization big enough for number of correctors to be chosen
+      double sizeFactor = cholesky->size();
+      assert(sizeFactor * sizeFactor / cholesky->numberRows() >= 1.0e6);
+      numberIterations[iPass] = solution.numberIterations();
+      objectiveValue[iPass] = solution.objectiveValue();
+      // several regions at once must match one at a time
+      int numberRows = cholesky->numberRows();
+      CoinWorkDouble *regions[5];
+      CoinWorkDouble *check[5];
+      for (int k = 0; k < 5; k++) {
+        regions[k] = new CoinWorkDouble[numberRows];
+        check[k] = new CoinWorkDouble[numberRows];
+        for (int iRow = 0; iRow < numberRows; iRow++)
+          regions[k][iRow] = 1.0 + 0.01 * ((iRow * (k + 3)) % 17) - 0.1 * k;
+        CoinMemcpyN(regions[k], numberRows, check[k]);
+        cholesky->solve(check[k]);
+      }
+      cholesky->solveMultiple(regions, 5);
+      for (int k = 0; k < 5; k++) {
+        for (int iRow = 0; iRow < numberRows; iRow++) {
+          double difference = static_cast< double >(regions[k][iRow] - check[k][iRow]);
+          assert(fabs(difference) <= 1.0e-9 * (1.0 + fabs(static_cast< double >(check[k][iRow]))));
+        }
+        delete[] regions[k];
+        delete[] check[k];
+      }
+    }
+    ClpThreadPool::setNumberThreads(saveThreads);
+    assert(numberIterations[0] == numberIterations[1]);
+    assert(objectiveValue[0] == objectiveValue[1]);
+    ClpSimplex model;
+    generatedProblem(model, 600, 1500, 10);
+    model.dual();
+    CoinRelFltEq eq(1.0e-5);
+    assert(eq(objectiveValue[0], model.objectiveValue()));
+  }
+  // Test dense Cholesky - tasks and vector leaf
+  {
+    int saveThreads = ClpThreadPool::wantedNumberThreads();
+    int saveLevel = clpSimdLevel();
+    int numberIterations[3];
+    double objectiveValue[3];
+    for (int iPass = 0; iPass < 3; iPass++) {
+      // one thread, four threads, then one thread with no vector leaf
+      ClpThreadPool::setNumberThreads(iPass == 1 ? 4 : 1);
+      clpSetSimdLevel(iPass == 2 ? CLP_SIMD_NONE : saveLevel);
+      ClpInterior solution;
+      generatedProblem(solution, 200, 500, 7);
+      solution.setCholesky(new ClpCholeskyDense());
+      solution.primalDual();
+      assert(!solution.status());
+      numberIterations[iPass] = solution.numberIterations();
+      objectiveValue[iPass] = solution.objectiveValue();
+    }
+    ClpThreadPool::setNumberThreads(saveThreads);
+    clpSetSimdLevel(saveLevel);
+    // tasks split the same way whatever the number of threads
+    assert(numberIterations[0] == numberIterations[1]);
+    assert(objectiveValue[0] == objectiveValue[1]);
+    // fused multiply add changes rounding only
+    CoinRelFltEq eq(1.0e-7);
+    assert(eq(objectiveValue[2], objectiveValue[0]));
+  }
+  // Test sparse Cholesky - independent subtrees as tasks
+  {
+    int saveThreads = ClpThreadPool::wantedNumberThreads();
+    int numberIterations[2];
+    double objectiveValue[2];
+    for (int iPass = 0; iPass < 2; iPass++) {
+      ClpThreadPool::setNumberThreads(iPass ? 4 : 1);
+      ClpInterior solution;
+      // blocks only joined by last row so tree splits
+      generatedProblem(solution, 801, 2400, 7, 8);
+      ClpCholeskyBase *cholesky = new ClpCholeskyBase();
+      solution.setCholesky(cholesky);
+      solution.primalDual();
+      assert(!solution.status());
+      assert(cholesky->numberSubtrees() > 1);
+      numberIterations[iPass] = solution.numberIterations();
+      objectiveValue[iPass] = solution.objectiveValue();
+    }
+    ClpThreadPool::setNumberThreads(saveThreads);
+    // subtrees are done in same order whatever the number of threads
+    assert(numberIterations[0] == numberIterations[1]);
+    assert(objectiveValue[0] == objectiveValue[1]);
+  }
+  // Test symbolic Cholesky cache (and saving it)
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "exmip1";
+    if (m.readMps(fn.c_str(), "mps") == 0) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      ClpCholeskySymbolic cache;
+      model.setCholeskySymbolic(&cache);
+      model.barrier(true);
+      assert(cache.fingerprint());
+      double objective1 = model.objectiveValue();
+      std::string fileName = "exmip1.symbolic";
+      assert(!cache.writeFile(fileName.c_str()));
+      ClpCholeskySymbolic cache2;
+      assert(!cache2.readFile(fileName.c_str()));
+      {
+        // damaged file (last row index out of range) must be refused
+        ClpCholeskySymbolic cache3;
+        FILE *fp = fopen(fileName.c_str(), "r+b");
+        assert(fp);
+        CoinBigIndex bad = model.numberRows() + 1000;
+        fseek(fp, -static_cast< long >(sizeof(CoinBigIndex)), SEEK_END);
+        fwrite(&bad, sizeof(CoinBigIndex), 1, fp);
+        fclose(fp);
+        assert(cache3.readFile(fileName.c_str()) == 2);
+        assert(!cache3.fingerprint());
+        // so symbolic is just done again
+        ClpSimplex model3(model);
+        model3.setCholeskySymbolic(&cache3);
+        model3.barrier(true);
+        CoinRelFltEq eq(1.0e-7);
+        assert(eq(model3.objectiveValue(), objective1));
+        assert(cache3.fingerprint() == cache.fingerprint());
+        model3.setCholeskySymbolic(NULL);
+      }
+      remove(fileName.c_str());
+      assert(cache2.fingerprint() == cache.fingerprint());
+      assert(cache2.numberRows() == cache.numberRows());
+      // Same pattern so symbolic should come from cache
+      model.setCholeskySymbolic(&cache2);
+      model.barrier(true);
+      CoinRelFltEq eq(1.0e-7);
+      assert(eq(model.objectiveValue(), objective1));
+      assert(cache2.fingerprint() == cache.fingerprint());
+      model.setCholeskySymbolic(NULL);
+      // Same sizes but one more element - cache must not be used
+      CoinPackedMatrix matrix4(*m.getMatrixByCol());
+      bool added = false;
+      for (int iColumn = 0; iColumn < matrix4.getNumCols() && !added; iColumn++) {
+        for (int iRow = 0; iRow < matrix4.getNumRows(); iRow++) {
+          if (!matrix4.getCoefficient(iRow, iColumn)) {
+            matrix4.modifyCoefficient(iRow, iColumn, 1.0e-3);
+            added = true;
+            break;
+          }
+        }
+      }
+      assert(added);
+      ClpSimplex model4;
+      model4.loadProblem(matrix4, m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      ClpSimplex check4(model4);
+      check4.setLogLevel(0);
+      check4.dual();
+      model4.setCholeskySymbolic(&cache2);
+      model4.barrier(true);
+      assert(eq(model4.objectiveValue(), check4.objectiveValue()));
+      // refilled for new pattern
+      assert(cache2.fingerprint() && cache2.fingerprint() != cache.fingerprint());
+      model4.setCholeskySymbolic(NULL);
     } else {
       std::cerr << "Error reading exmip1 from sample data. Skipping test." << std::endl;
     }
@@ -2515,6 +3660,34 @@ void ClpSimplexUnitTest(const std::string &dirSample)
       time1 = CoinCpuTime();
       model.dual();
       std::cout << "Network problem, ClpNetworkMatrix took " << CoinCpuTime() - time1 << " seconds" << std::endl;
+      double dualObjective = model.objectiveValue();
+      // network simplex on network matrix and on (detected) packed matrix
+      ClpSolve solveOptions;
+      solveOptions.setSolveType(ClpSolve::useNetwork);
+      for (int iPass = 0; iPass < 2; iPass++) {
+        if (iPass)
+          model.loadProblem(matrix,
+            lowerColumn, upperColumn, objective,
+            lower, upper);
+        model.createStatus();
+        ClpNetworkSimplex network;
+        // both matrices must be accepted as networks
+        assert(!network.load(&model));
+        assert(!network.solve(model.maximumIterations()));
+        assert(!network.copyBack(&model));
+        // tree was optimal so clean up should not need to pivot
+        assert(!model.numberIterations());
+        assert(fabs(model.objectiveValue() - dualObjective) < 1.0e-7 * (1.0 + fabs(dualObjective)));
+        // and through ClpSolve
+        model.createStatus();
+        time1 = CoinCpuTime();
+        model.initialSolve(solveOptions);
+        std::cout << "Network problem, network simplex on "
+                  << (iPass ? "ClpPackedMatrix" : "ClpNetworkMatrix") << " took "
+                  << CoinCpuTime() - time1 << " seconds" << std::endl;
+        assert(!model.status());
+        assert(fabs(model.objectiveValue() - dualObjective) < 1.0e-7 * (1.0 + fabs(dualObjective)));
+      }
       delete[] lower;
       delete[] upper;
       delete[] head;
@@ -2643,6 +3816,28 @@ void ClpSimplexUnitTest(const std::string &dirSample)
 #endif
       CoinRelFltEq eq(1.0e-4);
       assert(eq(objValue, -400.92));
+      {
+        // half matrix used as symmetric must match full copy
+        ClpQuadraticObjective *halfObjective = static_cast< ClpQuadraticObjective * >(model.objectiveAsObject());
+        ClpQuadraticObjective fullObjective(*halfObjective, 1);
+        const double *solution = model.primalColumnSolution();
+        const double *change = halfObjective->linearObjective();
+        double *gradientHalf = new double[numberColumns];
+        double *gradientFull = new double[numberColumns];
+        CoinZeroN(gradientHalf, numberColumns);
+        CoinZeroN(gradientFull, numberColumns);
+        double sumsHalf[3];
+        double sumsFull[3];
+        halfObjective->quadraticProducts(solution, change, gradientHalf, sumsHalf);
+        fullObjective.quadraticProducts(solution, change, gradientFull, sumsFull);
+        CoinRelFltEq eq2(1.0e-10);
+        for (int i = 0; i < 3; i++)
+          assert(eq2(sumsHalf[i], sumsFull[i]));
+        for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+          assert(eq2(gradientHalf[iColumn], gradientFull[iColumn]));
+        delete[] gradientHalf;
+        delete[] gradientFull;
+      }
       // and again for barrier
       model.barrier(false);
       //printSol(model);
@@ -2687,6 +3882,82 @@ void ClpSimplexUnitTest(const std::string &dirSample)
     }
   }
 #endif
+  {
+    // big quadratic objective so products are done in chunks
+    int numberColumns = 600;
+    int numberDense = 500;
+    CoinBigIndex *start = new CoinBigIndex[numberColumns + 1];
+    int *column = new int[numberDense * (numberDense + 1) / 2 + 3 * numberColumns];
+    double *element = new double[numberDense * (numberDense + 1) / 2 + 3 * numberColumns];
+    double *linear = new double[numberColumns];
+    double *x = new double[numberColumns];
+    CoinBigIndex numberElements = 0;
+    start[0] = 0;
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      linear[iColumn] = 1.0 - 0.01 * (iColumn % 7);
+      x[iColumn] = 0.5 + 0.001 * ((iColumn * 37) % 101);
+      if (iColumn < numberDense) {
+        // dense block (rows consecutive)
+        for (int iRow = 0; iRow <= iColumn; iRow++) {
+          column[numberElements] = iRow;
+          element[numberElements++] = (iRow == iColumn) ? 2.0 : 1.0 / (1.0 + iColumn - iRow);
+        }
+      } else {
+        column[numberElements] = iColumn - numberDense;
+        element[numberElements++] = 0.1;
+        column[numberElements] = iColumn - 50;
+        element[numberElements++] = -0.2;
+        column[numberElements] = iColumn;
+        element[numberElements++] = 1.5;
+      }
+      start[iColumn + 1] = numberElements;
+    }
+    ClpQuadraticObjective halfObjective(linear, numberColumns, start, column, element);
+    ClpQuadraticObjective fullObjective(halfObjective, 1);
+    double *gradient[3];
+    double sums[3][3];
+    int saveThreads = ClpThreadPool::wantedNumberThreads();
+    for (int iPass = 0; iPass < 3; iPass++) {
+      ClpThreadPool::setNumberThreads(iPass ? 4 : 1);
+      gradient[iPass] = new double[numberColumns];
+      CoinZeroN(gradient[iPass], numberColumns);
+      if (iPass < 2)
+        halfObjective.quadraticProducts(x, linear, gradient[iPass], sums[iPass]);
+      else
+        fullObjective.quadraticProducts(x, linear, gradient[iPass], sums[iPass]);
+    }
+    CoinRelFltEq eq(1.0e-10);
+    for (int iPass = 1; iPass < 3; iPass++) {
+      for (int i = 0; i < 3; i++)
+        assert(eq(sums[iPass][i], sums[0][i]));
+      for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+        assert(eq(gradient[iPass][iColumn], gradient[0][iColumn]));
+    }
+    // change matrix in place - dense column no longer consecutive
+    int *row = halfObjective.quadraticObjective()->getMutableIndices();
+    const CoinBigIndex *columnStart = halfObjective.quadraticObjective()->getVectorStarts();
+    row[columnStart[100]] = 101;
+    ClpQuadraticObjective newObjective(halfObjective);
+    for (int iPass = 0; iPass < 2; iPass++) {
+      ClpThreadPool::setNumberThreads(iPass ? 4 : 1);
+      CoinZeroN(gradient[0], numberColumns);
+      CoinZeroN(gradient[1], numberColumns);
+      halfObjective.quadraticProducts(x, linear, gradient[0], sums[0]);
+      newObjective.quadraticProducts(x, linear, gradient[1], sums[1]);
+      for (int i = 0; i < 3; i++)
+        assert(eq(sums[0][i], sums[1][i]));
+      for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+        assert(eq(gradient[0][iColumn], gradient[1][iColumn]));
+    }
+    ClpThreadPool::setNumberThreads(saveThreads);
+    for (int iPass = 0; iPass < 3; iPass++)
+      delete[] gradient[iPass];
+    delete[] start;
+    delete[] column;
+    delete[] element;
+    delete[] linear;
+    delete[] x;
+  }
   // Test CoinStructuredModel
   {
 
@@ -2784,6 +4055,23 @@ void ClpSimplexUnitTest(const std::string &dirSample)
     fullModel.dual();
     fullModel.dropNames();
     fullModel.writeMps("test.mps");
+    // Dantzig-Wolfe with blocks as tasks must follow same path as serially
+    {
+      int saveThreads = ClpThreadPool::wantedNumberThreads();
+      double objectiveValue[2];
+      for (int iPass = 0; iPass < 2; iPass++) {
+        ClpThreadPool::setNumberThreads(iPass ? 4 : 1);
+        ClpSimplex model;
+        model.setLogLevel(0);
+        model.solve(&structured);
+        assert(!model.status());
+        objectiveValue[iPass] = model.objectiveValue();
+      }
+      ClpThreadPool::setNumberThreads(saveThreads);
+      assert(objectiveValue[0] == objectiveValue[1]);
+      CoinRelFltEq eq(1.0e-7);
+      assert(eq(objectiveValue[0], fullModel.objectiveValue()));
+    }
     // Make up very simple nested model - not realistic
     // Create a structured model
     CoinStructuredModel structured2;